@@ -2,14 +2,182 @@
 
 #include "Core.h"
 
+#include <immintrin.h>
+
 #if(_WIN64)
 
 #include <Windows.h>
 #undef WIN32_LEAN_AND_MEAN
+#pragma comment(lib, "Synchronization.lib")
+#elif __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif
 
 namespace GTSL
 {
+	enum class MemoryOrder : uint8 {
+		RELAXED, ACQUIRE, RELEASE, ACQUIRE_RELEASE, SEQUENTIAL
+	};
+
+#if __linux__
+	constexpr int ToNativeMemoryOrder(const MemoryOrder memoryOrder) {
+		switch (memoryOrder) {
+		case MemoryOrder::RELAXED: return __ATOMIC_RELAXED;
+		case MemoryOrder::ACQUIRE: return __ATOMIC_ACQUIRE;
+		case MemoryOrder::RELEASE: return __ATOMIC_RELEASE;
+		case MemoryOrder::ACQUIRE_RELEASE: return __ATOMIC_ACQ_REL;
+		case MemoryOrder::SEQUENTIAL: return __ATOMIC_SEQ_CST;
+		}
+
+		return __ATOMIC_SEQ_CST;
+	}
+#endif
+
+	/**
+	 * \brief Atomically loads a 4 or 8 byte integral.
+	 * \param value Reference to the value to load.
+	 * \param memoryOrder Ordering constraint, only ACQUIRE, RELAXED and SEQUENTIAL are valid.
+	 * \return Loaded value.
+	 */
+	template<typename T>
+	T AtomicLoad(const T& value, const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+#if _WIN64
+		const T result = *static_cast<const volatile T*>(&value); _ReadWriteBarrier();
+		if (memoryOrder == MemoryOrder::SEQUENTIAL) { _mm_mfence(); }
+		return result;
+#elif __linux__
+		return __atomic_load_n(&value, ToNativeMemoryOrder(memoryOrder));
+#endif
+	}
+
+	/**
+	 * \brief Atomically stores a 4 or 8 byte integral.
+	 * \param value Reference to the value to write to.
+	 * \param newValue Value to write.
+	 * \param memoryOrder Ordering constraint, only RELEASE, RELAXED and SEQUENTIAL are valid.
+	 */
+	template<typename T>
+	void AtomicStore(T& value, const T newValue, const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+#if _WIN64
+		_ReadWriteBarrier(); *static_cast<volatile T*>(&value) = newValue;
+		if (memoryOrder == MemoryOrder::SEQUENTIAL) { _mm_mfence(); }
+#elif __linux__
+		__atomic_store_n(&value, newValue, ToNativeMemoryOrder(memoryOrder));
+#endif
+	}
+
+	/**
+	 * \brief Atomically adds delta to value.
+	 * \return Value before the addition.
+	 */
+	template<typename T>
+	T AtomicFetchAdd(T& value, const T delta, const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+#if _WIN64
+		if constexpr (sizeof(T) == 4) {
+			return static_cast<T>(_InterlockedExchangeAdd(AtomicAddressAs<long>(value), static_cast<long>(delta)));
+		} else {
+			return static_cast<T>(_InterlockedExchangeAdd64(AtomicAddressAs<long long>(value), static_cast<long long>(delta)));
+		}
+#elif __linux__
+		return __atomic_fetch_add(&value, delta, ToNativeMemoryOrder(memoryOrder));
+#endif
+	}
+
+	/**
+	 * \brief Atomically replaces value with newValue.
+	 * \return Value before the exchange.
+	 */
+	template<typename T>
+	T AtomicExchange(T& value, const T newValue, const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+#if _WIN64
+		if constexpr (sizeof(T) == 4) {
+			return static_cast<T>(_InterlockedExchange(AtomicAddressAs<long>(value), static_cast<long>(newValue)));
+		} else {
+			return static_cast<T>(_InterlockedExchange64(AtomicAddressAs<long long>(value), static_cast<long long>(newValue)));
+		}
+#elif __linux__
+		return __atomic_exchange_n(&value, newValue, ToNativeMemoryOrder(memoryOrder));
+#endif
+	}
+
+	/**
+	 * \brief Atomically replaces value with desired if value is equal to *expected, else writes the current value to expected.
+	 * \return Whether the exchange took place.
+	 */
+	template<typename T>
+	bool AtomicCompareExchange(T& value, T* expected, const T desired, const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+#if _WIN64
+		T previous;
+		if constexpr (sizeof(T) == 4) {
+			previous = static_cast<T>(_InterlockedCompareExchange(AtomicAddressAs<long>(value), static_cast<long>(desired), static_cast<long>(*expected)));
+		} else {
+			previous = static_cast<T>(_InterlockedCompareExchange64(AtomicAddressAs<long long>(value), static_cast<long long>(desired), static_cast<long long>(*expected)));
+		}
+		if (previous == *expected) { return true; }
+		*expected = previous; return false;
+#elif __linux__
+		const auto failureOrder = memoryOrder == MemoryOrder::RELEASE ? MemoryOrder::RELAXED : memoryOrder == MemoryOrder::ACQUIRE_RELEASE ? MemoryOrder::ACQUIRE : memoryOrder;
+		return __atomic_compare_exchange_n(&value, expected, desired, false, ToNativeMemoryOrder(memoryOrder), ToNativeMemoryOrder(failureOrder));
+#endif
+	}
+
+	inline void AtomicFence(const MemoryOrder memoryOrder = MemoryOrder::SEQUENTIAL) noexcept {
+#if _WIN64
+		if (memoryOrder == MemoryOrder::SEQUENTIAL) { _mm_mfence(); } else { _ReadWriteBarrier(); }
+#elif __linux__
+		__atomic_thread_fence(ToNativeMemoryOrder(memoryOrder));
+#endif
+	}
+
+	/**
+	 * \brief Hints the processor that the calling thread is in a spin wait loop.
+	 */
+	inline void SpinPause() noexcept {
+		_mm_pause();
+	}
+
+	/**
+	 * \brief Blocks the calling thread while value is equal to expected, can wake up spuriously so callers must re-check value.
+	 * \param value Reference to the value to wait on.
+	 * \param expected Value to block on.
+	 */
+	inline void AtomicWait(const uint32& value, uint32 expected) noexcept {
+#if _WIN64
+		WaitOnAddress(const_cast<uint32*>(&value), &expected, sizeof(uint32), INFINITE);
+#elif __linux__
+		syscall(SYS_futex, &value, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#endif
+	}
+
+	/**
+	 * \brief Wakes one thread blocked in AtomicWait on value.
+	 */
+	inline void AtomicNotifyOne(uint32& value) noexcept {
+#if _WIN64
+		WakeByAddressSingle(&value);
+#elif __linux__
+		syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+	}
+
+	/**
+	 * \brief Wakes every thread blocked in AtomicWait on value.
+	 */
+	inline void AtomicNotifyAll(uint32& value) noexcept {
+#if _WIN64
+		WakeByAddressAll(&value);
+#elif __linux__
+		syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, 0x7fffffff, nullptr, nullptr, 0);
+#endif
+	}
+
 	template <class _Integral, class _Ty>
 	[[nodiscard]] volatile _Integral* AtomicAddressAs(_Ty& _Source) noexcept {
 		// gets a pointer to the argument as an integral type (to pass to intrinsics)
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Core.h"
+#include "Assert.h"
+#include "Atomic.hpp"
+#include "Delegate.hpp"
+
+namespace GTSL
+{
+	/**
+	 * \brief Blocks the calling thread while value is equal to expected. Spins for spinCount iterations first, as most waits in lockstep workloads are short, then sleeps on the kernel.
+	 * \param value Value to wait on.
+	 * \param expected Value to wait while equal to.
+	 * \param sleepers Counter of threads sleeping on value, lets the waking side skip the system call when nobody sleeps.
+	 * \param spinCount Number of spin iterations before sleeping.
+	 */
+	inline void WaitWhileEqual(const uint32& value, const uint32 expected, uint32& sleepers, const uint32 spinCount) noexcept {
+		for (uint32 i = 0; i < spinCount; ++i) {
+			if (AtomicLoad(value, MemoryOrder::ACQUIRE) != expected) { return; }
+			SpinPause();
+		}
+
+		AtomicFetchAdd(sleepers, 1u);
+		while (AtomicLoad(value, MemoryOrder::ACQUIRE) == expected) { AtomicWait(value, expected); }
+		AtomicFetchAdd(sleepers, ~0u, MemoryOrder::RELAXED);
+	}
+
+	/**
+	 * \brief Reusable barrier for a fixed number of threads. Sense reversing, every crossing flips the barrier's phase, which is what waiting threads watch,
+	 * so the arrival counter can be reused by the next phase immediately.
+	 */
+	class Barrier {
+	public:
+		static constexpr uint32 DEFAULT_SPIN_COUNT = 4096;
+
+		/**
+		 * \param threadCount Number of threads which have to arrive for the barrier to be crossed.
+		 * \param spinCount Number of spin iterations a waiting thread performs before sleeping.
+		 */
+		explicit Barrier(const uint32 threadCount, const uint32 spinCount = DEFAULT_SPIN_COUNT) noexcept : threadCount(threadCount), spinCount(spinCount) {
+			GTSL_ASSERT(threadCount, "Thread count must be greater than 0.")
+		}
+
+		Barrier(const Barrier&) = delete;
+		Barrier& operator=(const Barrier&) = delete;
+
+		/**
+		 * \brief Arrives at the barrier and waits until every other thread has arrived.
+		 * \return True for exactly one thread per phase, the last one to arrive.
+		 */
+		bool ArriveAndWait() noexcept { return arriveAndWait([]() {}); }
+
+		/**
+		 * \brief Returns the number of times the barrier has been crossed.
+		 */
+		[[nodiscard]] uint32 GetPhase() const noexcept { return AtomicLoad(phase, MemoryOrder::ACQUIRE); }
+
+		[[nodiscard]] uint32 GetThreadCount() const noexcept { return threadCount; }
+
+	protected:
+		template<typename F>
+		bool arriveAndWait(F&& onCompletion) noexcept {
+			const uint32 currentPhase = AtomicLoad(phase, MemoryOrder::ACQUIRE);
+
+			if (AtomicFetchAdd(arrived, 1u, MemoryOrder::ACQUIRE_RELEASE) + 1 == threadCount) {
+				onCompletion();
+				AtomicStore(arrived, 0u, MemoryOrder::RELAXED);
+				AtomicStore(phase, currentPhase + 1, MemoryOrder::SEQUENTIAL);
+				if (AtomicLoad(sleepers, MemoryOrder::SEQUENTIAL)) { AtomicNotifyAll(phase); }
+				return true;
+			}
+
+			WaitWhileEqual(phase, currentPhase, sleepers, spinCount);
+			return false;
+		}
+
+	private:
+		alignas(64) uint32 arrived = 0;
+		alignas(64) uint32 phase = 0;
+		uint32 sleepers = 0;
+		uint32 threadCount, spinCount;
+	};
+
+	/**
+	 * \brief Barrier which runs a callback on the last arriving thread, before any other thread is released, every time it is crossed.
+	 */
+	class PhaseBarrier : protected Barrier {
+	public:
+		/**
+		 * \param threadCount Number of threads which have to arrive for the barrier to be crossed.
+		 * \param onPhaseCompletion Delegate called by the last thread to arrive on every phase.
+		 * \param spinCount Number of spin iterations a waiting thread performs before sleeping.
+		 */
+		PhaseBarrier(const uint32 threadCount, const Delegate<void()> onPhaseCompletion, const uint32 spinCount = DEFAULT_SPIN_COUNT) noexcept : Barrier(threadCount, spinCount), onPhaseCompletion(onPhaseCompletion) {}
+
+		/**
+		 * \brief Arrives at the barrier and waits until every other thread has arrived and the completion delegate has run.
+		 * \return True for exactly one thread per phase, the one which ran the completion delegate.
+		 */
+		bool ArriveAndWait() noexcept { return arriveAndWait([this]() { onPhaseCompletion(); }); }
+
+		using Barrier::GetPhase;
+		using Barrier::GetThreadCount;
+
+	private:
+		Delegate<void()> onPhaseCompletion;
+	};
+
+	/**
+	 * \brief Single use count down latch, threads can wait for the count to reach zero.
+	 */
+	class Latch {
+	public:
+		explicit Latch(const uint32 count, const uint32 spinCount = Barrier::DEFAULT_SPIN_COUNT) noexcept : count(count), spinCount(spinCount) {}
+
+		Latch(const Latch&) = delete;
+		Latch& operator=(const Latch&) = delete;
+
+		/**
+		 * \brief Decrements the count by n, wakes every waiting thread if it reaches zero.
+		 */
+		void CountDown(const uint32 n = 1) noexcept {
+			const uint32 previous = AtomicFetchAdd(count, 0u - n, MemoryOrder::SEQUENTIAL);
+			GTSL_ASSERT(previous >= n, "Latch counted down past zero.")
+			if (previous == n && AtomicLoad(sleepers, MemoryOrder::SEQUENTIAL)) { AtomicNotifyAll(count); }
+		}
+
+		/**
+		 * \brief Returns whether the count reached zero, never blocks.
+		 */
+		[[nodiscard]] bool TryWait() const noexcept { return AtomicLoad(count, MemoryOrder::ACQUIRE) == 0; }
+
+		/**
+		 * \brief Blocks until the count reaches zero.
+		 */
+		void Wait() noexcept {
+			for (uint32 current = AtomicLoad(count, MemoryOrder::ACQUIRE); current; current = AtomicLoad(count, MemoryOrder::ACQUIRE)) {
+				WaitWhileEqual(count, current, sleepers, spinCount);
+			}
+		}
+
+		void ArriveAndWait(const uint32 n = 1) noexcept { CountDown(n); Wait(); }
+
+	private:
+		alignas(64) uint32 count;
+		uint32 sleepers = 0;
+		uint32 spinCount;
+	};
+}
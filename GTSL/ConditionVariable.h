@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Mutex.h"
+#include "Time.h"
 
 #if(_WIN64)
 
@@ -20,10 +21,23 @@ namespace GTSL
 #if(_WIN64)
 			InitializeConditionVariable(&conditionVariable);
 #elif __linux__
+			pthread_condattr_t attributes; // timed waits measure against the monotonic clock so wall clock changes don't stretch or cut them
+			pthread_condattr_init(&attributes);
+			pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+			pthread_cond_init(&conditionVariable, &attributes);
+			pthread_condattr_destroy(&attributes);
 #endif
 		}
 
-		~ConditionVariable() = default;
+		ConditionVariable(const ConditionVariable&) = delete;
+		ConditionVariable& operator=(const ConditionVariable&) = delete;
+
+		~ConditionVariable() {
+#if(_WIN64)
+#elif __linux__
+			pthread_cond_destroy(&conditionVariable);
+#endif
+		}
 
 		void Wait(Mutex& mutex) {
 #if(_WIN64)
@@ -46,6 +60,22 @@ namespace GTSL
 			while (!predicate()) { Wait(lock); }
 		}
 
+		/**
+		 * \brief Waits until notified or until timeout elapses.
+		 * \return False if the wait timed out.
+		 */
+		bool Wait(Mutex& mutex, const Nanoseconds timeout) {
+#if(_WIN64)
+			return SleepConditionVariableCS(&conditionVariable, PCRITICAL_SECTION(&mutex), static_cast<DWORD>((timeout.GetCount() + 999999ull) / 1000000ull)); // rounded up, a sub millisecond timeout mustn't turn into a busy poll
+#elif __linux__
+			timespec deadline;
+			clock_gettime(CLOCK_MONOTONIC, &deadline);
+			const uint64 nanoseconds = static_cast<uint64>(deadline.tv_nsec) + timeout.GetCount();
+			deadline.tv_sec += static_cast<time_t>(nanoseconds / 1000000000ull); deadline.tv_nsec = static_cast<long>(nanoseconds % 1000000000ull);
+			return pthread_cond_timedwait(&conditionVariable, &mutex.mutex, &deadline) == 0;
+#endif
+		}
+
 		void NotifyAll() {
 #if(_WIN64)
 			WakeAllConditionVariable(&conditionVariable);
@@ -66,7 +96,7 @@ namespace GTSL
 #if _WIN64
 		CONDITION_VARIABLE conditionVariable;
 #elif __linux__
-		pthread_cond_t conditionVariable = PTHREAD_COND_INITIALIZER;
+		pthread_cond_t conditionVariable;
 #endif
 	};
 	
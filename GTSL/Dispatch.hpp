@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Core.h"
+#include "SIMD.hpp"
+
+#ifdef _WIN64
+#include <intrin.h>
+#elif __linux__
+#include <cpuid.h>
+#endif
+
+namespace GTSL
+{
+	struct CPUVectorInfo {
+		bool HW_MMX = false, HW_x64 = false, HW_ABM = false, HW_RDRAND = false, HW_BMI1 = false, HW_BMI2 = false, HW_ADX = false, HW_PREFETCHWT1 = false, HW_MPX = false;
+
+		//  SIMD: 128-bit
+		bool HW_SSE = false, HW_SSE2 = false, HW_SSE3 = false, HW_SSSE3 = false, HW_SSE41 = false, HW_SSE42 = false, HW_SSE4a = false, HW_AES = false, HW_SHA = false;
+
+		//  SIMD: 256-bit
+		bool HW_AVX = false, HW_XOP = false, HW_FMA3 = false, HW_FMA4 = false, HW_AVX2 = false, HW_F16C = false;
+
+		//  SIMD: 512-bit
+		bool HW_AVX512_F = false, HW_AVX512_PF = false, HW_AVX512_ER = false, HW_AVX512_CD = false, HW_AVX512_VL = false, HW_AVX512_BW = false, HW_AVX512_DQ = false, HW_AVX512_IFMA = false, HW_AVX512_VBMI = false;
+
+		//  OS support, whether the OS saves the 256/512-bit registers on context switches. Wide instructions are unusable without it even if the CPU has them.
+		bool OS_AVX = false, OS_AVX512 = false;
+	};
+
+	/**
+	 * \brief Queries which instruction set extensions the CPU has and the OS supports, with CPUID.
+	 */
+	inline CPUVectorInfo GetCPUVectorInfo() {
+		CPUVectorInfo vectorInfo;
+#if _WIN64
+		//https://stackoverflow.com/questions/6121792/how-to-check-if-a-cpu-supports-the-sse3-instruction-set
+
+		int info[4];
+		__cpuidex(info, 0, 0);
+		const int nIds = info[0];
+
+		__cpuidex(info, 0x8000000, 0);
+		const uint32 nExIds = info[0];
+
+		//  Detect Features
+		if (nIds >= 0x00000001) {
+			__cpuidex(info, 0x00000001, 0);
+			vectorInfo.HW_MMX = (info[3] & (static_cast<int>(1) << 23)) != 0;
+			vectorInfo.HW_SSE = (info[3] & (static_cast<int>(1) << 25)) != 0;
+			vectorInfo.HW_SSE2 = (info[3] & (static_cast<int>(1) << 26)) != 0;
+			vectorInfo.HW_SSE3 = (info[2] & (static_cast<int>(1) << 0)) != 0;
+
+			vectorInfo.HW_SSSE3 = (info[2] & (static_cast<int>(1) << 9)) != 0;
+			vectorInfo.HW_SSE41 = (info[2] & (static_cast<int>(1) << 19)) != 0;
+			vectorInfo.HW_SSE42 = (info[2] & (static_cast<int>(1) << 20)) != 0;
+			vectorInfo.HW_AES = (info[2] & (static_cast<int>(1) << 25)) != 0;
+
+			vectorInfo.HW_AVX = (info[2] & (static_cast<int>(1) << 28)) != 0;
+			vectorInfo.HW_FMA3 = (info[2] & (static_cast<int>(1) << 12)) != 0;
+			vectorInfo.HW_F16C = (info[2] & (static_cast<int>(1) << 29)) != 0;
+
+			vectorInfo.HW_RDRAND = (info[2] & (static_cast<int>(1) << 30)) != 0;
+
+			if (info[2] & (static_cast<int>(1) << 27)) { // OSXSAVE
+				const uint64 xcr0 = _xgetbv(0);
+				vectorInfo.OS_AVX = (xcr0 & 0x6) == 0x6;
+				vectorInfo.OS_AVX512 = (xcr0 & 0xE6) == 0xE6;
+			}
+		}
+		if (nIds >= 0x00000007) {
+			__cpuidex(info, 0x00000007, 0);
+			vectorInfo.HW_AVX2 = (info[1] & (static_cast<int>(1) << 5)) != 0;
+
+			vectorInfo.HW_BMI1 = (info[1] & (static_cast<int>(1) << 3)) != 0;
+			vectorInfo.HW_BMI2 = (info[1] & (static_cast<int>(1) << 8)) != 0;
+			vectorInfo.HW_ADX = (info[1] & (static_cast<int>(1) << 19)) != 0;
+			vectorInfo.HW_MPX = (info[1] & (static_cast<int>(1) << 14)) != 0;
+			vectorInfo.HW_SHA = (info[1] & (static_cast<int>(1) << 29)) != 0;
+			vectorInfo.HW_PREFETCHWT1 = (info[2] & (static_cast<int>(1) << 0)) != 0;
+
+			vectorInfo.HW_AVX512_F = (info[1] & (static_cast<int>(1) << 16)) != 0;
+			vectorInfo.HW_AVX512_CD = (info[1] & (static_cast<int>(1) << 28)) != 0;
+			vectorInfo.HW_AVX512_PF = (info[1] & (static_cast<int>(1) << 26)) != 0;
+			vectorInfo.HW_AVX512_ER = (info[1] & (static_cast<int>(1) << 27)) != 0;
+			vectorInfo.HW_AVX512_VL = (info[1] & (static_cast<int>(1) << 31)) != 0;
+			vectorInfo.HW_AVX512_BW = (info[1] & (static_cast<int>(1) << 30)) != 0;
+			vectorInfo.HW_AVX512_DQ = (info[1] & (static_cast<int>(1) << 17)) != 0;
+			vectorInfo.HW_AVX512_IFMA = (info[1] & (static_cast<int>(1) << 21)) != 0;
+			vectorInfo.HW_AVX512_VBMI = (info[2] & (static_cast<int>(1) << 1)) != 0;
+		}
+		if (nExIds >= 0x80000001) {
+			__cpuidex(info, 0x80000001, 0);
+			vectorInfo.HW_x64 = (info[3] & (static_cast<int>(1) << 29)) != 0;
+			vectorInfo.HW_ABM = (info[2] & (static_cast<int>(1) << 5)) != 0;
+			vectorInfo.HW_SSE4a = (info[2] & (static_cast<int>(1) << 6)) != 0;
+			vectorInfo.HW_FMA4 = (info[2] & (static_cast<int>(1) << 16)) != 0;
+			vectorInfo.HW_XOP = (info[2] & (static_cast<int>(1) << 11)) != 0;
+		}
+#elif __linux__
+		uint32 info[4] = {0};
+		__cpuid(0, info[0], info[1], info[2], info[3]);
+		const uint32 nIds = info[0];
+
+		__cpuid(0x80000000, info[0], info[1], info[2], info[3]);
+		const uint32 nExIds = info[0];
+
+		//  Detect Features
+		if (nIds >= 0x00000001) {
+			__cpuid(0x00000001, info[0], info[1], info[2], info[3]);
+			vectorInfo.HW_MMX = (info[3] & (static_cast<int>(1) << 23)) != 0;
+			vectorInfo.HW_SSE = (info[3] & (static_cast<int>(1) << 25)) != 0;
+			vectorInfo.HW_SSE2 = (info[3] & (static_cast<int>(1) << 26)) != 0;
+			vectorInfo.HW_SSE3 = (info[2] & (static_cast<int>(1) << 0)) != 0;
+
+			vectorInfo.HW_SSSE3 = (info[2] & (static_cast<int>(1) << 9)) != 0;
+			vectorInfo.HW_SSE41 = (info[2] & (static_cast<int>(1) << 19)) != 0;
+			vectorInfo.HW_SSE42 = (info[2] & (static_cast<int>(1) << 20)) != 0;
+			vectorInfo.HW_AES = (info[2] & (static_cast<int>(1) << 25)) != 0;
+
+			vectorInfo.HW_AVX = (info[2] & (static_cast<int>(1) << 28)) != 0;
+			vectorInfo.HW_FMA3 = (info[2] & (static_cast<int>(1) << 12)) != 0;
+			vectorInfo.HW_F16C = (info[2] & (static_cast<int>(1) << 29)) != 0;
+
+			vectorInfo.HW_RDRAND = (info[2] & (static_cast<int>(1) << 30)) != 0;
+
+			if (info[2] & (static_cast<int>(1) << 27)) { // OSXSAVE
+				uint32 xcr0Low, xcr0High;
+				__asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+				vectorInfo.OS_AVX = (xcr0Low & 0x6) == 0x6;
+				vectorInfo.OS_AVX512 = (xcr0Low & 0xE6) == 0xE6;
+			}
+		}
+		if (nIds >= 0x00000007) {
+			__cpuid_count(0x00000007, 0, info[0], info[1], info[2], info[3]);
+
+			vectorInfo.HW_AVX2 = (info[1] & (static_cast<int>(1) << 5)) != 0;
+
+			vectorInfo.HW_BMI1 = (info[1] & (static_cast<int>(1) << 3)) != 0;
+			vectorInfo.HW_BMI2 = (info[1] & (static_cast<int>(1) << 8)) != 0;
+			vectorInfo.HW_ADX = (info[1] & (static_cast<int>(1) << 19)) != 0;
+			vectorInfo.HW_MPX = (info[1] & (static_cast<int>(1) << 14)) != 0;
+			vectorInfo.HW_SHA = (info[1] & (static_cast<int>(1) << 29)) != 0;
+			vectorInfo.HW_PREFETCHWT1 = (info[2] & (static_cast<int>(1) << 0)) != 0;
+
+			vectorInfo.HW_AVX512_F = (info[1] & (static_cast<int>(1) << 16)) != 0;
+			vectorInfo.HW_AVX512_CD = (info[1] & (static_cast<int>(1) << 28)) != 0;
+			vectorInfo.HW_AVX512_PF = (info[1] & (static_cast<int>(1) << 26)) != 0;
+			vectorInfo.HW_AVX512_ER = (info[1] & (static_cast<int>(1) << 27)) != 0;
+			vectorInfo.HW_AVX512_VL = (info[1] & (static_cast<int>(1) << 31)) != 0;
+			vectorInfo.HW_AVX512_BW = (info[1] & (static_cast<int>(1) << 30)) != 0;
+			vectorInfo.HW_AVX512_DQ = (info[1] & (static_cast<int>(1) << 17)) != 0;
+			vectorInfo.HW_AVX512_IFMA = (info[1] & (static_cast<int>(1) << 21)) != 0;
+			vectorInfo.HW_AVX512_VBMI = (info[2] & (static_cast<int>(1) << 1)) != 0;
+		}
+		if (nExIds >= 0x80000001) {
+			__cpuid_count(0x80000001, 0, info[0], info[1], info[2], info[3]);
+
+			vectorInfo.HW_x64 = (info[3] & (static_cast<int>(1) << 29)) != 0;
+			vectorInfo.HW_ABM = (info[2] & (static_cast<int>(1) << 5)) != 0;
+			vectorInfo.HW_SSE4a = (info[2] & (static_cast<int>(1) << 6)) != 0;
+			vectorInfo.HW_FMA4 = (info[2] & (static_cast<int>(1) << 16)) != 0;
+			vectorInfo.HW_XOP = (info[2] & (static_cast<int>(1) << 11)) != 0;
+		}
+#endif
+		return vectorInfo;
+	}
+
+	/**
+	 * \brief Widest instruction set family usable on the running machine, ordered so higher levels include the lower ones.
+	 */
+	enum class SIMDLevel : uint8 {
+		SCALAR, SSE4, AVX2, AVX512
+	};
+
+	/**
+	 * \brief Returns the widest instruction set family supported by both the CPU and the OS. Queried once and cached.
+	 * AVX2 requires FMA3, F16C, BMI1, BMI2 and LZCNT along with it, AVX512 requires the F, BW, VL, DQ and CD subsets, to match the GTSL_TARGET_* macros.
+	 */
+	inline SIMDLevel GetSIMDLevel() {
+		static const SIMDLevel level = []() {
+			const auto vectorInfo = GetCPUVectorInfo();
+
+			if (!vectorInfo.HW_SSE41 || !vectorInfo.HW_SSE42) { return SIMDLevel::SCALAR; }
+			if (!vectorInfo.OS_AVX || !vectorInfo.HW_AVX2 || !vectorInfo.HW_FMA3 || !vectorInfo.HW_F16C || !vectorInfo.HW_BMI2 || !vectorInfo.HW_BMI1 || !vectorInfo.HW_ABM) { return SIMDLevel::SSE4; }
+			if (!vectorInfo.OS_AVX512 || !vectorInfo.HW_AVX512_F || !vectorInfo.HW_AVX512_BW || !vectorInfo.HW_AVX512_VL || !vectorInfo.HW_AVX512_DQ || !vectorInfo.HW_AVX512_CD) { return SIMDLevel::AVX2; }
+
+			return SIMDLevel::AVX512;
+		}();
+
+		return level;
+	}
+
+	template<typename T>
+	class Dispatcher;
+
+	/**
+	 * \brief Picks one of several implementations of a function, each compiled for a different instruction set(see GTSL_TARGET_*), based on what the running machine supports.
+	 * Selection happens once, on construction, calls are then a plain indirect call. Meant to be stored in a function local static next to the kernels.
+	 * \tparam R Return type of the function.
+	 * \tparam ARGS Argument types of the function.
+	 */
+	template<typename R, typename... ARGS>
+	class Dispatcher<R(ARGS...)> {
+	public:
+		using Function = R(*)(ARGS...);
+
+		/**
+		 * \param scalar Implementation which runs anywhere, must not be null.
+		 * \param sse4 SSE4.2 implementation, can be null.
+		 * \param avx2 AVX2 implementation, can be null.
+		 * \param avx512 AVX-512 implementation, can be null.
+		 * \param maxLevel Widest level to consider, defaults to what the machine supports. Lower it to force narrower implementations.
+		 */
+		Dispatcher(const Function scalar, const Function sse4, const Function avx2, const Function avx512, const SIMDLevel maxLevel = GetSIMDLevel()) {
+			GTSL_ASSERT(scalar, "A scalar implementation is required.")
+
+			const Function functions[] = { scalar, sse4, avx2, avx512 };
+
+			for (uint8 i = static_cast<uint8>(maxLevel) + 1; i-- > 0;) {
+				if (functions[i]) { function = functions[i]; level = static_cast<SIMDLevel>(i); break; }
+			}
+		}
+
+		R operator()(ARGS... args) const { return function(args...); }
+
+		/**
+		 * \brief Returns the level of the selected implementation.
+		 */
+		[[nodiscard]] SIMDLevel GetLevel() const { return level; }
+
+	private:
+		Function function = nullptr;
+		SIMDLevel level = SIMDLevel::SCALAR;
+	};
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Core.h"
+#include "Atomic.hpp"
+#include "Allocator.hpp"
+#include "Assert.h"
+#include "Mutex.h"
+#include "Thread.hpp"
+
+namespace GTSL
+{
+	/**
+	 * \brief Epoch based memory reclamation, lets readers traverse shared structures without writing to any shared cache line.
+	 * Readers announce they are inside a read side critical section in their own slot(indexed by Thread::ThisTreadID()),
+	 * writers unlink objects and Retire them, retired objects are freed once every thread that could have seen them has left it's critical section.
+	 * Every thread using an instance must have a distinct id lower than MAX_THREADS.
+	 * \tparam ALLOCATOR Allocator used for the deferred free lists and to free retired objects, must be safe to call from multiple threads.
+	 * \tparam MAX_THREADS Maximum number of threads that can use this reclaimer.
+	 */
+	template<class ALLOCATOR, uint32 MAX_THREADS = 64>
+	class EpochReclaimer {
+	public:
+		EpochReclaimer(const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator) {}
+
+		EpochReclaimer(const EpochReclaimer&) = delete;
+		EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+		~EpochReclaimer() {
+			for (auto& slot : slots) {
+				for (uint32 i = 0; i < slot.Length; ++i) { free(slot.Retired[i]); }
+				if (slot.Retired) { Deallocate(allocator, slot.Capacity, slot.Retired); }
+			}
+		}
+
+		/**
+		 * \brief Enters a read side critical section on the calling thread, can be nested.
+		 */
+		void Enter() noexcept {
+			auto& slot = getSlot();
+
+			if (slot.Nesting++ == 0) {
+				AtomicStore(slot.Epoch, (AtomicLoad(globalEpoch, MemoryOrder::RELAXED) << 1) | ACTIVE, MemoryOrder::SEQUENTIAL);
+			}
+		}
+
+		/**
+		 * \brief Leaves a read side critical section on the calling thread.
+		 */
+		void Exit() noexcept {
+			auto& slot = getSlot();
+			GTSL_ASSERT(slot.Nesting, "Exit called without matching Enter.")
+
+			if (--slot.Nesting == 0) {
+				AtomicStore(slot.Epoch, 0ull, MemoryOrder::RELEASE);
+			}
+		}
+
+		/**
+		 * \brief Defers destruction and deallocation of object, which must have been allocated through this reclaimer's allocator, until no reader can reference it.
+		 * The object must already be unreachable for new readers.
+		 * \param object Pointer to the object to retire.
+		 */
+		template<typename T>
+		void Retire(T* object) {
+			retire(object, sizeof(T), alignof(T), [](void* data) { Destroy(*static_cast<T*>(data)); });
+		}
+
+		/**
+		 * \brief Defers deallocation of a raw block of memory allocated through this reclaimer's allocator.
+		 * \param size Size of the allocation.
+		 * \param alignment Alignment of the allocation.
+		 * \param data Pointer to the allocation.
+		 */
+		void Retire(const uint64 size, const uint64 alignment, void* data) {
+			retire(data, size, alignment, nullptr);
+		}
+
+		/**
+		 * \brief Tries to advance the global epoch and frees every object the calling thread retired which is no longer reachable.
+		 * \return Number of freed objects.
+		 */
+		uint32 Collect() {
+			auto& slot = getSlot();
+
+			TryAdvance();
+
+			const uint64 epoch = AtomicLoad(globalEpoch, MemoryOrder::ACQUIRE);
+
+			uint32 freed = 0; // retired entries are stored in epoch order, safe ones are always a prefix
+			while (freed < slot.Length && slot.Retired[freed].Epoch + 2 <= epoch) { free(slot.Retired[freed++]); }
+
+			for (uint32 i = freed; i < slot.Length; ++i) { slot.Retired[i - freed] = slot.Retired[i]; }
+			slot.Length -= freed;
+
+			return freed;
+		}
+
+		/**
+		 * \brief Advances the global epoch if every thread in a critical section has observed the current one.
+		 * \return Whether the epoch was advanced.
+		 */
+		bool TryAdvance() noexcept {
+			AtomicFence(MemoryOrder::SEQUENTIAL);
+
+			uint64 epoch = AtomicLoad(globalEpoch, MemoryOrder::ACQUIRE);
+
+			for (const auto& slot : slots) {
+				const uint64 slotEpoch = AtomicLoad(slot.Epoch, MemoryOrder::ACQUIRE);
+				if ((slotEpoch & ACTIVE) && (slotEpoch >> 1) != epoch) { return false; }
+			}
+
+			return AtomicCompareExchange(globalEpoch, &epoch, epoch + 1, MemoryOrder::ACQUIRE_RELEASE);
+		}
+
+		/**
+		 * \brief Returns the number of objects retired by the calling thread which have not been freed yet.
+		 */
+		[[nodiscard]] uint32 GetPendingCount() noexcept { return getSlot().Length; }
+
+		[[nodiscard]] uint64 GetEpoch() const noexcept { return AtomicLoad(globalEpoch, MemoryOrder::ACQUIRE); }
+
+		/**
+		 * \brief Number of pending objects per thread after which Retire will attempt a collection.
+		 */
+		static constexpr uint32 COLLECT_THRESHOLD = 64;
+
+	private:
+		static constexpr uint64 ACTIVE = 1;
+
+		struct RetiredObject {
+			void* Data; void(*Destructor)(void*);
+			uint64 Size, Alignment, Epoch;
+		};
+
+		struct alignas(64) ThreadSlot {
+			uint64 Epoch = 0;
+			uint32 Nesting = 0;
+			uint32 Length = 0, Capacity = 0;
+			RetiredObject* Retired = nullptr;
+		};
+
+		alignas(64) uint64 globalEpoch = 0;
+		ThreadSlot slots[MAX_THREADS];
+		[[no_unique_address]] ALLOCATOR allocator;
+
+		ThreadSlot& getSlot() noexcept {
+			GTSL_ASSERT(Thread::ThisTreadID() < MAX_THREADS, "Thread id is out of bounds for this reclaimer.")
+			return slots[Thread::ThisTreadID()];
+		}
+
+		void retire(void* data, const uint64 size, const uint64 alignment, void(*destructor)(void*)) {
+			auto& slot = getSlot();
+
+			if (slot.Length == slot.Capacity) {
+				AllocateOrResize(allocator, &slot.Retired, &slot.Capacity, slot.Capacity ? slot.Capacity * 2 : COLLECT_THRESHOLD, slot.Length);
+			}
+
+			slot.Retired[slot.Length++] = RetiredObject{ data, destructor, size, alignment, AtomicLoad(globalEpoch, MemoryOrder::ACQUIRE) };
+
+			if (slot.Length >= COLLECT_THRESHOLD) { Collect(); }
+		}
+
+		void free(const RetiredObject& retiredObject) {
+			if (retiredObject.Destructor) { retiredObject.Destructor(retiredObject.Data); }
+			allocator.Deallocate(retiredObject.Size, retiredObject.Alignment, retiredObject.Data);
+		}
+	};
+
+	template<class ALLOCATOR, uint32 MAX_THREADS>
+	class ReadLock<EpochReclaimer<ALLOCATOR, MAX_THREADS>>
+	{
+	public:
+		ReadLock(EpochReclaimer<ALLOCATOR, MAX_THREADS>& epochReclaimer) noexcept : epochReclaimer(&epochReclaimer) { epochReclaimer.Enter(); }
+		~ReadLock() noexcept { epochReclaimer->Exit(); }
+
+	private:
+		EpochReclaimer<ALLOCATOR, MAX_THREADS>* epochReclaimer{ nullptr };
+	};
+}
@@ -3,6 +3,7 @@
 #include "Buffer.hpp"
 #include "Core.h"
 #include "Flags.h"
+#include "Hashing.hpp"
 
 #include "Range.hpp"
 #include "StringCommon.h"
@@ -15,6 +16,7 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -112,6 +114,37 @@ namespace GTSL {
 #endif
 		}
 
+		/**
+		 * \brief Writes every piece in order, gathered by the system from where they are, so separate pieces don't have to be joined first.
+		 * \return Bytes written.
+		 */
+		uint64 Write(const Range<const Range<const byte*>*> pieces) const {
+			uint64 written = 0;
+#if (_WIN64)
+			for (const auto& e : pieces) {
+				DWORD bytes{ 0 };
+				WriteFile(fileHandle, e.begin(), static_cast<uint32>(e.Bytes()), &bytes, nullptr);
+				written += bytes;
+			}
+#elif (__linux__)
+			constexpr uint32 BATCH = 64;
+			iovec vectors[BATCH];
+
+			for (uint64 i = 0; i < pieces.ElementCount();) {
+				uint32 count = 0; uint64 expected = 0;
+				for (; count < BATCH && i < pieces.ElementCount(); ++count, ++i) {
+					vectors[count].iov_base = const_cast<byte*>(pieces[i].begin()); vectors[count].iov_len = pieces[i].Bytes();
+					expected += pieces[i].Bytes();
+				}
+
+				const auto bytes = ::writev(fileHandle, vectors, static_cast<int>(count));
+				if (bytes > 0) { written += bytes; }
+				if (bytes < 0 || static_cast<uint64>(bytes) != expected) { break; }
+			}
+#endif
+			return written;
+		}
+
 		template<class B>
 		uint32 Write(B& buffer, OptionalParameter<uint64> offset = {0}, OptionalParameter<uint64> size = {}) const {
 #if (_WIN64)
@@ -194,6 +227,20 @@ namespace GTSL {
 #endif
 		}
 
+		/**
+		 * \brief Hashes the file's whole contents, read from the start in chunks, to identify files by what they hold rather than by when they were written.
+		 * Leaves the file pointer at the end of the file.
+		 */
+		Hash128 GetContentHash() {
+			SetPointer(0);
+
+			StreamingHasher hasher;
+			byte chunk[64 * 1024];
+			for (int64 bytes = static_cast<int64>(Read(sizeof(chunk), chunk)); bytes > 0; bytes = static_cast<int64>(Read(sizeof(chunk), chunk))) { hasher.Update(bytes, chunk); }
+
+			return hasher.Get128();
+		}
+
 		explicit operator bool() const { 
 #if (_WIN64)
 			return fileHandle && fileHandle != reinterpret_cast<void*>(0xffffffffffffffff);
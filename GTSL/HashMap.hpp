@@ -10,6 +10,7 @@
 #include "Allocator.hpp"
 #include "ArrayCommon.hpp"
 #include "Bitman.h"
+#include "Hashing.hpp"
 #include "Result.h"
 #include "Serialize.hpp"
 
@@ -18,6 +19,7 @@
 #endif
 
 namespace GTSL {
+	// integers are their own hash, as maps store keys as their hashes, they are mixed with MixHash only to pick buckets
 	template<Integral T>
 	struct Hash<T> { const T& value; Hash(const T& val) : value(val) {} operator uint64() const { return static_cast<uint64>(value); } };
 
@@ -130,12 +132,12 @@ namespace GTSL {
 
 		template<typename... ARGS>
 		V& Emplace(const K key, ARGS&&... args) {
-			auto bucketIndex = ModuloByPowerOf2(Hash(key), this->bucketCount);
+			auto bucketIndex = ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount);
 			GTSL_ASSERT(findKeyInBucket(bucketIndex, key) == nullptr, "Key already exists!")
 			
 			if (getBucketLength(bucketIndex) + 1 > bucketCapacity) {
 				resize();
-				bucketIndex = ModuloByPowerOf2(Hash(key), this->bucketCount);
+				bucketIndex = ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount);
 			}
 
 			uint32 i = 0;
@@ -175,34 +177,34 @@ namespace GTSL {
 			}
 		}
 
-		[[nodiscard]] bool Find(const K key) const { return findKeyInBucket(ModuloByPowerOf2(Hash(key), this->bucketCount), key); }
+		[[nodiscard]] bool Find(const K key) const { return findKeyInBucket(ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount), key); }
 
 		[[nodiscard]] Result<V&> TryGet(const K key) {
-			const auto bucket = ModuloByPowerOf2(Hash(key), this->bucketCount);
+			const auto bucket = ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount);
 			auto result = getIndexForKeyInBucket(bucket, key);
 			return GTSL::Result<V&>(*(getValuesBucketPointer(bucket) + result.Get()), result.State());
 		}
 
 		[[nodiscard]] Result<const V&> TryGet(const K key) const {
-			const auto bucket = ModuloByPowerOf2(Hash(key), this->bucketCount);
+			const auto bucket = ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount);
 			auto result = getIndexForKeyInBucket(bucket, key);
 			return GTSL::Result<const V&>(*(getValuesBucketPointer(bucket) + result.Get()), result.State());
 		}
 
 		V& At(const K key) {
-			const auto bucketIndex = ModuloByPowerOf2(Hash(key), bucketCount); const auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
+			const auto bucketIndex = ModuloByPowerOf2(MixHash(Hash(key)), bucketCount); const auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
 			GTSL_ASSERT(elementIndex.State(), "No element with that key!");
 			return getValuesBucket(bucketIndex)[elementIndex.Get()];
 		}
 
 		const V& At(const K key) const {
-			const auto bucketIndex = ModuloByPowerOf2(Hash(key), bucketCount); const auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
+			const auto bucketIndex = ModuloByPowerOf2(MixHash(Hash(key)), bucketCount); const auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
 			GTSL_ASSERT(elementIndex.State(), "No element with that key!");
 			return getValuesBucket(bucketIndex)[elementIndex.Get()];
 		}
 
 		void Remove(const K key) {
-			auto bucketIndex = ModuloByPowerOf2(Hash(key), this->bucketCount); auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
+			auto bucketIndex = ModuloByPowerOf2(MixHash(Hash(key)), this->bucketCount); auto elementIndex = getIndexForKeyInBucket(bucketIndex, key);
 			GTSL_ASSERT(elementIndex.State(), "Key doesn't exist!")
 			PopElement(bucketCapacity, getBucketLength(bucketIndex), getKeysBucketPointer(bucketIndex) + 1, elementIndex.Get());
 			PopElement(bucketCapacity, getBucketLength(bucketIndex), getValuesBucketPointer(bucketIndex), elementIndex.Get());
@@ -261,7 +263,7 @@ namespace GTSL {
 
 			for(uint32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex) {
 				for(uint32 bucketElementIndex = 0; bucketElementIndex < getBucketLength(bucketIndex); ++bucketElementIndex) {
-					auto newBucketIndex = ModuloByPowerOf2(getKeysBucket(bucketIndex)[bucketElementIndex], newBucketCount);
+					auto newBucketIndex = ModuloByPowerOf2(MixHash(getKeysBucket(bucketIndex)[bucketElementIndex]), newBucketCount);
 					auto& newBucketLength = *getKeysBucketLength(newAlloc, newBucketIndex, newBucketCapacity);
 
 					uint32 i = 0;
@@ -407,12 +409,12 @@ namespace GTSL {
 		}
 
 		void Emplace(K key) {
-			auto bucketIndex = ModuloByPowerOf2(static_cast<uint64>(key), bucketCount);
+			auto bucketIndex = ModuloByPowerOf2(MixHash(static_cast<uint64>(key)), bucketCount);
 			auto bucketLength = getBucketLength(bucketIndex, keys, bucketCapacity);
 
 			if (bucketLength + 1 > bucketCapacity) {
 				resize();
-				bucketIndex = ModuloByPowerOf2(static_cast<uint64>(key), bucketCount);
+				bucketIndex = ModuloByPowerOf2(MixHash(static_cast<uint64>(key)), bucketCount);
 				bucketLength = getBucketLength(bucketIndex, keys, bucketCapacity);
 			}
 
@@ -421,7 +423,7 @@ namespace GTSL {
 		}
 
 		[[nodiscard]] bool Find(const K key) const {
-			auto bucketIndex = ModuloByPowerOf2(static_cast<uint64>(key), bucketCount);
+			auto bucketIndex = ModuloByPowerOf2(MixHash(static_cast<uint64>(key)), bucketCount);
 			for(uint64 i = 0; i < getBucketLength(bucketIndex, keys, bucketCapacity); ++i) {
 				if(bucketEntry(bucketIndex, i, keys, bucketCapacity) == static_cast<uint64>(key)) {
 					return true;
@@ -471,7 +473,7 @@ namespace GTSL {
 
 			for (uint32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex) {
 				for (uint32 bucketElementIndex = 0; bucketElementIndex < getBucketLength(bucketIndex, keys, bucketCapacity); ++bucketElementIndex) {
-					auto newBucketIndex = ModuloByPowerOf2(bucketEntry(bucketIndex, bucketElementIndex, keys, bucketCapacity), newBucketCount);
+					auto newBucketIndex = ModuloByPowerOf2(MixHash(bucketEntry(bucketIndex, bucketElementIndex, keys, bucketCapacity)), newBucketCount);
 					auto& newBucketLength = getBucketLength(newBucketIndex, newAlloc, newBucketCapacity);
 					bucketEntry(newBucketIndex, newBucketLength, newAlloc, newBucketCapacity) = bucketEntry(bucketIndex, bucketElementIndex, keys, bucketCapacity);
 					++newBucketLength;
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "Core.h"
+#include "Range.hpp"
+#include "SIMD.hpp"
+
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+namespace GTSL
+{
+	struct Hash128 {
+		uint64 Low = 0, High = 0;
+
+		constexpr bool operator==(const Hash128&) const = default;
+	};
+
+	//Full 64x64 bit product of a and b. Usable in constant expressions.
+	constexpr void multiply128(const uint64 a, const uint64 b, uint64& low, uint64& high) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		if (!std::is_constant_evaluated()) { low = _umul128(a, b, &high); return; }
+
+		const uint64 lowLow = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF), lowHigh = (a & 0xFFFFFFFF) * (b >> 32), highLow = (a >> 32) * (b & 0xFFFFFFFF), highHigh = (a >> 32) * (b >> 32);
+		const uint64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+		low = middle << 32 | (lowLow & 0xFFFFFFFF);
+		high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#else
+		const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+		low = static_cast<uint64>(product); high = static_cast<uint64>(product >> 64);
+#endif
+	}
+
+	//Multiplies a and b and folds the 128 bit product by xoring it's halves, every input bit affects most of the result.
+	constexpr uint64 multiplyFold(const uint64 a, const uint64 b) {
+		uint64 low = 0, high = 0; multiply128(a, b, low, high);
+		return low ^ high;
+	}
+
+	/**
+	 * \brief Mixes every bit of value in to every bit of the result, and is a bijection so distinct values never collide.
+	 * Use it to turn keys with structure, like aligned pointers or sequential ids, in to well spread hashes before taking their low bits.
+	 */
+	constexpr uint64 MixHash(uint64 value) {
+		value ^= value >> 30; value *= 0xbf58476d1ce4e5b9ull;
+		value ^= value >> 27; value *= 0x94d049bb133111ebull;
+		return value ^ value >> 31;
+	}
+
+	// odd and with balanced bits, so multiplying by them spreads every input bit
+	constexpr uint64 HASH_SECRET[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+	//Loads little endian integers from single byte characters, assembling them byte by byte during constant evaluation.
+	template<typename C>
+	constexpr uint64 readHashBytes(const C* data, const uint32 count) {
+		if (std::is_constant_evaluated()) {
+			uint64 value = 0;
+			for (uint32 i = 0; i < count; ++i) { value |= static_cast<uint64>(static_cast<uint8>(data[i])) << i * 8; }
+			return value;
+		}
+
+		if (count == 8) { uint64 value; std::memcpy(&value, data, 8); return value; }
+		uint32 value; std::memcpy(&value, data, 4); return value;
+	}
+
+	/**
+	 * \brief Hashes length bytes from data, in the style of wyhash. Every 16 bytes cost one 64x64 bit multiplication,
+	 * inputs over 48 bytes run three independent chains so the multiplications overlap instead of waiting on each other.
+	 * Inputs up to 16 bytes are read with a few overlapping loads, without loops.
+	 * Usable in constant expressions, so ids of string literals are computed at compile time, and gives the same value at runtime.
+	 * \tparam C Any single byte type.
+	 */
+	template<typename C> requires (sizeof(C) == 1)
+	constexpr uint64 HashBytes(const C* data, const uint64 length, uint64 seed = 0) {
+		seed ^= multiplyFold(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+
+		uint64 a = 0, b = 0;
+
+		if (length <= 16) {
+			if (length >= 4) {
+				const uint64 skip = length >> 3 << 2; // reads cover the middle of inputs over 8 bytes
+				a = readHashBytes(data, 4) << 32 | readHashBytes(data + skip, 4);
+				b = readHashBytes(data + length - 4, 4) << 32 | readHashBytes(data + length - 4 - skip, 4);
+			} else if (length) {
+				a = static_cast<uint64>(static_cast<uint8>(data[0])) << 16 | static_cast<uint64>(static_cast<uint8>(data[length >> 1])) << 8 | static_cast<uint8>(data[length - 1]);
+			}
+		} else {
+			uint64 remaining = length;
+
+			if (remaining > 48) {
+				uint64 second = seed, third = seed;
+
+				do {
+					seed = multiplyFold(readHashBytes(data, 8) ^ HASH_SECRET[1], readHashBytes(data + 8, 8) ^ seed);
+					second = multiplyFold(readHashBytes(data + 16, 8) ^ HASH_SECRET[2], readHashBytes(data + 24, 8) ^ second);
+					third = multiplyFold(readHashBytes(data + 32, 8) ^ HASH_SECRET[3], readHashBytes(data + 40, 8) ^ third);
+					data += 48; remaining -= 48;
+				} while (remaining > 48);
+
+				seed ^= second ^ third;
+			}
+
+			for (; remaining > 16; data += 16, remaining -= 16) {
+				seed = multiplyFold(readHashBytes(data, 8) ^ HASH_SECRET[1], readHashBytes(data + 8, 8) ^ seed);
+			}
+
+			a = readHashBytes(data + remaining - 16, 8); b = readHashBytes(data + remaining - 8, 8); // the last 16 bytes, overlapping already hashed ones when shorter
+		}
+
+		multiply128(a ^ HASH_SECRET[1], b ^ seed, a, b);
+		return multiplyFold(a ^ HASH_SECRET[0] ^ length, b ^ HASH_SECRET[1]);
+	}
+
+	template<typename C> requires (sizeof(C) == 1)
+	constexpr uint64 HashBytes(const Range<const C*> data, const uint64 seed = 0) { return HashBytes(data.begin(), data.ElementCount(), seed); }
+
+	//Key material for StreamingHasher, generated by a splitmix64 sequence.
+	constexpr std::array<uint64, 48> streamingHashSecret() {
+		std::array<uint64, 48> secret{};
+		for (uint64 i = 0; i < secret.size(); ++i) { secret[i] = MixHash(0x9e3779b97f4a7c15ull * (i + 1)); }
+		return secret;
+	}
+
+	inline constexpr std::array<uint64, 48> STREAMING_HASH_SECRET = streamingHashSecret();
+
+#if defined(__AVX2__)
+	using HashVector = SIMD<uint64, 4>;
+#else
+	using HashVector = SIMD<uint64, 2>;
+#endif
+
+	/**
+	 * \brief Hashes data fed in any number of pieces, giving the same value however it was split, for hashing files and buffers too large to hold at once.
+	 * Follows the design of xxh3, 8 independent 64 bit lanes consume 64 bytes per step with vector multiplications and additions only,
+	 * every 1 KiB the lanes are scrambled so bits from early data keep spreading. Produces 64 or 128 bit hashes, use 128 bits to identify content.
+	 * Not related to HashBytes, which is faster for short inputs.
+	 */
+	class StreamingHasher {
+	public:
+		explicit StreamingHasher(const uint64 seed = 0) : seed(seed) {
+			alignas(32) uint64 initial[LANES];
+			for (uint32 i = 0; i < LANES; ++i) { initial[i] = STREAMING_HASH_SECRET[INITIAL_KEY + i] ^ seed; }
+			for (uint32 i = 0; i < VECTORS; ++i) { accumulators[i] = HashVector(UnalignedPointer<const uint64>(initial + i * VECTOR_LANES)); }
+		}
+
+		void Update(const uint64 size, const byte* data) {
+			uint64 remaining = size;
+			length += size;
+
+			if (buffered) {
+				const uint64 taken = remaining < STRIPE_BYTES - buffered ? remaining : STRIPE_BYTES - buffered;
+				std::memcpy(buffer + buffered, data, taken);
+				buffered += static_cast<uint32>(taken); data += taken; remaining -= taken;
+				if (buffered < STRIPE_BYTES) { return; }
+				consume(buffer); buffered = 0;
+			}
+
+			for (; remaining >= STRIPE_BYTES; data += STRIPE_BYTES, remaining -= STRIPE_BYTES) { consume(data); }
+
+			std::memcpy(buffer, data, remaining);
+			buffered = static_cast<uint32>(remaining);
+		}
+
+		void Update(const Range<const byte*> data) { Update(data.Bytes(), data.begin()); }
+
+		/**
+		 * \brief Returns the hash of everything fed so far, more data can still be fed after.
+		 */
+		[[nodiscard]] uint64 Get64() const { return finish().Low; }
+
+		/**
+		 * \brief Returns the 128 bit hash of everything fed so far, more data can still be fed after.
+		 */
+		[[nodiscard]] Hash128 Get128() const { return finish(); }
+
+		[[nodiscard]] uint64 GetLength() const { return length; }
+
+	private:
+		static constexpr uint32 STRIPE_BYTES = 64, LANES = 8, STRIPES_PER_BLOCK = 16;
+		static constexpr uint32 VECTOR_LANES = sizeof(HashVector) / 8, VECTORS = LANES / VECTOR_LANES;
+		static constexpr uint32 SCRAMBLE_KEY = 24, MERGE_KEY = 32, INITIAL_KEY = 40; // offsets in to the secret, stripe keys slide over the first 23 words
+		static constexpr uint64 SCRAMBLE_MULTIPLIER = 0x9e3779b1ull;
+
+		HashVector accumulators[VECTORS];
+		uint64 length = 0, seed = 0;
+		uint32 stripe = 0, buffered = 0;
+		byte buffer[STRIPE_BYTES];
+
+		// every lane adds the product of the halves of it's keyed input, and the raw input of it's neighbour so no input bits are lost to the multiplication
+		static void accumulate(HashVector* accumulators, const byte* data, const uint64* key) {
+			for (uint32 i = 0; i < VECTORS; ++i) {
+				const HashVector input(UnalignedPointer<const uint64>(reinterpret_cast<const uint64*>(data) + i * VECTOR_LANES));
+				const HashVector keyed = input ^ HashVector(UnalignedPointer<const uint64>(key + i * VECTOR_LANES));
+				accumulators[i] += HashVector::MultiplyLow32(keyed, keyed.ShiftRight<32>()) + input.SwapAdjacent();
+			}
+		}
+
+		static void scramble(HashVector* accumulators) {
+			const HashVector multiplier(SCRAMBLE_MULTIPLIER);
+
+			for (uint32 i = 0; i < VECTORS; ++i) {
+				HashVector lane = accumulators[i] ^ accumulators[i].ShiftRight<47>();
+				lane ^= HashVector(UnalignedPointer<const uint64>(STREAMING_HASH_SECRET.data() + SCRAMBLE_KEY + i * VECTOR_LANES));
+				accumulators[i] = HashVector::MultiplyLow32(lane, multiplier) + HashVector::MultiplyLow32(lane.ShiftRight<32>(), multiplier).ShiftLeft<32>(); // 64 by 32 bit multiplication
+			}
+		}
+
+		void consume(const byte* data) {
+			accumulate(accumulators, data, STREAMING_HASH_SECRET.data() + stripe);
+			if (++stripe == STRIPES_PER_BLOCK) { scramble(accumulators); stripe = 0; }
+		}
+
+		Hash128 finish() const {
+			HashVector lanes[VECTORS];
+			for (uint32 i = 0; i < VECTORS; ++i) { lanes[i] = accumulators[i]; }
+
+			if (buffered) { // zero padding is unambiguous as the length is mixed in below
+				byte last[STRIPE_BYTES] = {};
+				std::memcpy(last, buffer, buffered);
+				accumulate(lanes, last, STREAMING_HASH_SECRET.data() + stripe);
+			}
+
+			alignas(32) uint64 values[LANES];
+			for (uint32 i = 0; i < VECTORS; ++i) { lanes[i].CopyTo(UnalignedPointer<uint64>(values + i * VECTOR_LANES)); }
+
+			uint64 low = length * 0x9e3779b185ebca87ull ^ seed, high = ~length * 0xc2b2ae3d27d4eb4full ^ seed;
+
+			for (uint32 i = 0; i < LANES; i += 2) {
+				low += multiplyFold(values[i] ^ STREAMING_HASH_SECRET[MERGE_KEY + i], values[i + 1] ^ STREAMING_HASH_SECRET[MERGE_KEY + i + 1]);
+				high += multiplyFold(values[i] ^ STREAMING_HASH_SECRET[INITIAL_KEY + i + 1], values[i + 1] ^ STREAMING_HASH_SECRET[INITIAL_KEY + i]);
+			}
+
+			return Hash128{ MixHash(low), MixHash(high) };
+		}
+	};
+}
@@ -1,8 +1,15 @@
 #pragma once
 
 #include "Id.h"
+#include "Delegate.hpp"
+#include "Extent.h"
+#include "PerfectHash.hpp"
+#include "SIMD.hpp"
 #include "String.hpp"
 #include "StringCommon.h"
+#include "Thread.hpp"
+#include "Vector.hpp"
+#include "Math/Quantization.hpp"
 
 namespace GTSL {
 	struct LUTData {
@@ -10,42 +17,314 @@ namespace GTSL {
 		uint32 Size;
 	};
 
+	/**
+	 * \brief Parses a .cube 3D LUT, calling f(Vector3) for every sample in file order, red varying fastest.
+	 * Walks the bytes once, comments, TITLE and other unknown keywords are skipped. The domain defaults to [0, 1].
+	 * \return Whether a size of at least 2 was declared and exactly size^3 samples were found.
+	 */
 	bool ParseLUT(StringView file, LUTData& lutData, auto&& f) {
+		enum class lutKeyword : uint8 { SIZE, DOMAIN_MIN, DOMAIN_MAX };
+		static constexpr PerfectHashMap KEYWORDS({ u8"LUT_3D_SIZE", u8"DOMAIN_MIN", u8"DOMAIN_MAX" }, { lutKeyword::SIZE, lutKeyword::DOMAIN_MIN, lutKeyword::DOMAIN_MAX });
+
+		const char8_t* c = file.GetData(); const char8_t* const end = c + file.GetBytes();
 		uint32 samples = 0;
 
-		ForEachLine(file, [&](StringView line) {
-			auto lastToken = 0ull;
+		lutData.Min = Vector3(0, 0, 0); lutData.Max = Vector3(1, 1, 1); lutData.Size = 0;
+
+		auto isBlank = [](const char8_t character) { return character == u8' ' || character == u8'\t' || character == u8'\r'; };
+		auto skipLine = [&]() { while (c < end && *c != u8'\n') { ++c; } };
+
+		auto scanVector = [&](Vector3& vector) {
+			for (uint32 i = 0; i < 3; ++i) {
+				while (c < end && isBlank(*c)) { ++c; }
+				float32 value;
+				const char8_t* const next = ParseFloat(c, end, value);
+				if (!next) { return false; }
+				vector[i] = value; c = next;
+			}
+
+			return true;
+		};
 
-			uint8 component = 0; Vector3 vec;
+		while (c < end) {
+			while (c < end && isBlank(*c)) { ++c; }
+			if (c == end) { break; }
 
-			ForEachSubstring(line, [&](StringView token) {
-				if (IsNumber(token)) {
-					if(IsDecimalNumber(token)) {
-						vec[component] = ToNumber<float32>(token).Get();
-						++component;						
-					} else {
-						if (lastToken == Hash(StringView(u8"LUT_3D_SIZE"))) {
-							lutData.Size = ToNumber<uint32>(token).Get();
-						}
+			if (*c == u8'\n') { ++c; continue; }
+			if (*c == u8'#') { skipLine(); continue; }
+
+			if ((*c >= u8'A' && *c <= u8'Z') || (*c >= u8'a' && *c <= u8'z') || *c == u8'_') {
+				const char8_t* keyword = c;
+				while (c < end && !isBlank(*c) && *c != u8'\n') { ++c; }
+				const auto found = KEYWORDS.TryGet(StringView(Byte(c - keyword), keyword));
+
+				if (found) {
+					switch (found.Get()) {
+					case lutKeyword::SIZE: {
+						while (c < end && isBlank(*c)) { ++c; }
+						uint32 size;
+						if (ParseInteger(c, end, size) && size >= 2) { lutData.Size = size; } // interpolation needs at least one cell
+						break;
+					}
+					case lutKeyword::DOMAIN_MIN: { Vector3 vector; if (scanVector(vector)) { lutData.Min = vector; } break; }
+					case lutKeyword::DOMAIN_MAX: { Vector3 vector; if (scanVector(vector)) { lutData.Max = vector; } break; }
 					}
-				} else {
-					lastToken = Hash(StringView(token));
 				}
 
-			}, u8' ');
+				skipLine(); continue;
+			}
+
+			Vector3 sample;
+			if (scanVector(sample)) { f(sample); ++samples; }
+			skipLine();
+		}
+
+		return lutData.Size != 0 and samples == (lutData.Size * lutData.Size * lutData.Size);
+	}
+
+	enum class LUTInterpolation : uint8 {
+		TRILINEAR, //Blends the 8 corners of the enclosing cell.
+		TETRAHEDRAL //Blends the 4 corners of the tetrahedron the color falls in, half the reads of trilinear and keeps the neutral axis exact.
+	};
+
+	/**
+	 * \brief 3D color lookup table, applies a grade to RGB images.
+	 * Samples are stored as padded RGBA floats, red varying fastest, so a corner's three channels share one 16 byte block and neighbouring
+	 * red values share cache lines. Images are processed 8 pixels at a time, with one gather per channel and corner where AVX2 is available, and split by rows across threads.
+	 * \tparam ALLOCATOR Allocator used for the samples and threads.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class LUT3D {
+	public:
+		explicit LUT3D(const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), samples(allocator) {}
+
+		/**
+		 * \brief Loads a .cube file, see ParseLUT.
+		 * \return Whether the file was valid, if not the LUT is left empty.
+		 */
+		bool Parse(const StringView file) {
+			LUTData data;
+			samples.Resize(0);
+
+			if (!ParseLUT(file, data, [&](const Vector3 sample) { samples.EmplaceBack(sample.X()); samples.EmplaceBack(sample.Y()); samples.EmplaceBack(sample.Z()); samples.EmplaceBack(0.0f); })) {
+				samples.Resize(0); size = 0;
+				return false;
+			}
+
+			size = data.Size; domainMin = data.Min; domainMax = data.Max;
+			return true;
+		}
+
+		/**
+		 * \brief Interpolates a single color, colors outside the domain are clamped to it's edges.
+		 */
+		[[nodiscard]] Vector3 Sample(const Vector3 color, const LUTInterpolation interpolation = LUTInterpolation::TETRAHEDRAL) const {
+			uint32 cell[3]; float32 fraction[3];
+
+			for (uint32 i = 0; i < 3; ++i) {
+				const float32 t = (color[i] - domainMin[i]) * (static_cast<float32>(size - 1) / (domainMax[i] - domainMin[i]));
+				const float32 clamped = t > 0.0f ? (t < static_cast<float32>(size - 1) ? t : static_cast<float32>(size - 1)) : 0.0f;
+				cell[i] = Math::Min(static_cast<uint32>(clamped), size - 2);
+				fraction[i] = clamped - static_cast<float32>(cell[i]);
+			}
+
+			const uint32 base = (cell[2] * size + cell[1]) * size + cell[0], steps[3] = { 1, size, size * size };
+			auto corner = [&](const uint32 offset) { const float32* s = samples.begin() + (base + offset) * 4; return Vector3(s[0], s[1], s[2]); };
+
+			if (interpolation == LUTInterpolation::TRILINEAR) {
+				auto lerp = [](const Vector3 a, const Vector3 b, const float32 t) { return a + (b - a) * t; };
+				const Vector3 c00 = lerp(corner(0), corner(steps[0]), fraction[0]), c10 = lerp(corner(steps[1]), corner(steps[0] + steps[1]), fraction[0]);
+				const Vector3 c01 = lerp(corner(steps[2]), corner(steps[0] + steps[2]), fraction[0]), c11 = lerp(corner(steps[1] + steps[2]), corner(steps[0] + steps[1] + steps[2]), fraction[0]);
+				return lerp(lerp(c00, c10, fraction[1]), lerp(c01, c11, fraction[1]), fraction[2]);
+			}
+
+			const uint32 largest = fraction[0] >= fraction[1] && fraction[0] >= fraction[2] ? 0 : (fraction[1] >= fraction[2] ? 1 : 2);
+			const uint32 smallest = fraction[2] <= fraction[1] && fraction[2] <= fraction[0] ? 2 : (fraction[1] <= fraction[0] ? 1 : 0);
+			const uint32 middle = 3 - largest - smallest, all = steps[0] + steps[1] + steps[2];
+			const float32 f1 = fraction[largest], f2 = fraction[middle], f3 = fraction[smallest];
+
+			return corner(0) * (1.0f - f1) + corner(steps[largest]) * (f1 - f2) + corner(all - steps[smallest]) * (f2 - f3) + corner(all) * f3;
+		}
 
-			if(component == 3) {
-				if(lastToken == Hash(StringView(u8"DOMAIN_MIN"))) {
-					lutData.Min = vec;									
-				} else if(lastToken == Hash(StringView(u8"DOMAIN_MAX"))) {
-					lutData.Max = vec;
+		/**
+		 * \brief Applies the LUT to an image of interleaved RGB floats.
+		 * \param rowStride Distance between the starts of consecutive rows in floats, 0 for tightly packed rows. Source and destination may be the same.
+		 * \param threadCount Number of threads used, including the calling one. Rows are split in equal chunks.
+		 * \param firstThreadId Thread id given to the first spawned thread, the rest are given consecutive ids.
+		 */
+		void Apply(const float32* source, float32* destination, const Extent2D extent, const uint32 rowStride = 0, const LUTInterpolation interpolation = LUTInterpolation::TETRAHEDRAL, const uint8 threadCount = 1, const uint8 firstThreadId = 1) const {
+			apply(source, destination, extent, rowStride, interpolation, threadCount, firstThreadId);
+		}
+
+		/**
+		 * \brief Applies the LUT to an image of interleaved 8 bit RGB, values are treated as unorm and results are rounded to nearest.
+		 * \param rowStride Distance between the starts of consecutive rows in bytes, 0 for tightly packed rows.
+		 */
+		void Apply(const uint8* source, uint8* destination, const Extent2D extent, const uint32 rowStride = 0, const LUTInterpolation interpolation = LUTInterpolation::TETRAHEDRAL, const uint8 threadCount = 1, const uint8 firstThreadId = 1) const {
+			apply(source, destination, extent, rowStride, interpolation, threadCount, firstThreadId);
+		}
+
+		[[nodiscard]] uint32 GetSize() const { return size; }
+
+		[[nodiscard]] Vector3 GetDomainMin() const { return domainMin; }
+		[[nodiscard]] Vector3 GetDomainMax() const { return domainMax; }
+
+	private:
+		template<typename T>
+		struct applyContext {
+			const LUT3D* LUT; const T* Source; T* Destination; Extent2D Extent; uint32 RowStride; LUTInterpolation Interpolation; uint8 ThreadCount;
+		};
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		Vector<float32, ALLOCATOR> samples; // size^3 RGBA entries, red varying fastest
+		uint32 size = 0;
+		Vector3 domainMin, domainMax;
+
+		template<typename T>
+		void apply(const T* source, T* destination, const Extent2D extent, const uint32 rowStride, const LUTInterpolation interpolation, const uint8 threadCount, const uint8 firstThreadId) const {
+			GTSL_ASSERT(size >= 2, "LUT wasn't loaded.")
+
+			applyContext<T> context{ this, source, destination, extent, rowStride ? rowStride : extent.Width * 3u, interpolation, threadCount > 1 ? threadCount : static_cast<uint8>(1) };
+
+			Vector<Thread, ALLOCATOR> threads(context.ThreadCount, allocator);
+			for (uint32 t = 1; t < context.ThreadCount; ++t) {
+				threads.EmplaceBack(allocator, static_cast<uint8>(firstThreadId + t - 1), Delegate<void(applyContext<T>*, uint32)>::template Create<&LUT3D::template applyWorker<T>>(), &context, t);
+			}
+
+			applyWorker<T>(&context, 0);
+
+			for (auto& thread : threads) { thread.Join(allocator); }
+		}
+
+		template<typename T>
+		static void applyWorker(applyContext<T>* context, const uint32 thread) {
+			const uint32 height = context->Extent.Height, width = context->Extent.Width;
+			const uint32 chunk = (height + context->ThreadCount - 1) / context->ThreadCount;
+			const uint32 begin = Math::Min(thread * chunk, height), end = Math::Min(begin + chunk, height);
+
+			alignas(32) float32 r[8], g[8], b[8];
+
+			for (uint32 y = begin; y < end; ++y) {
+				const T* sourceRow = context->Source + static_cast<uint64>(y) * context->RowStride; T* destinationRow = context->Destination + static_cast<uint64>(y) * context->RowStride;
+
+				for (uint32 x = 0; x < width; x += 8) {
+					const uint32 count = Math::Min(width - x, 8u);
+
+					for (uint32 i = 0; i < 8; ++i) {
+						const T* pixel = sourceRow + (x + Math::Min(i, count - 1)) * 3; // tail repeats the last pixel
+						if constexpr (IsSame<T, uint8>()) { r[i] = Math::FromUnorm8(pixel[0]); g[i] = Math::FromUnorm8(pixel[1]); b[i] = Math::FromUnorm8(pixel[2]); }
+						else { r[i] = pixel[0]; g[i] = pixel[1]; b[i] = pixel[2]; }
+					}
+
+					context->LUT->interpolate(r, g, b, context->Interpolation);
+
+					for (uint32 i = 0; i < count; ++i) {
+						T* pixel = destinationRow + (x + i) * 3;
+						if constexpr (IsSame<T, uint8>()) { pixel[0] = Math::ToUnorm8(r[i]); pixel[1] = Math::ToUnorm8(g[i]); pixel[2] = Math::ToUnorm8(b[i]); }
+						else { pixel[0] = r[i]; pixel[1] = g[i]; pixel[2] = b[i]; }
+					}
+				}
+			}
+		}
+
+		// The AVX2 kernel and it's helpers are targeted one by one and pass vectors by reference, lambdas inside a class template don't inherit the target
+		// and would take 256 bit arguments with the baseline ABI.
+		GTSL_TARGET_AVX2 static void coordinateAVX2(const LUT3D& lut, const float32* channel, const uint32 axis, float8x& cell, float8x& fraction) {
+			const float32 last = static_cast<float32>(lut.size - 1);
+			const float8x t = (float8x(AlignedPointer<const float32, 32>(channel)) - float8x(lut.domainMin[axis])) * float8x(last / (lut.domainMax[axis] - lut.domainMin[axis]));
+			const float8x clamped = float8x::Min(float8x::Max(t, float8x(0.0f)), float8x(last)); // max first so NaN maps to 0
+			cell = float8x::Min(float8x::Floor(clamped), float8x(last - 1.0f));
+			fraction = clamped - cell;
+		}
+
+		GTSL_TARGET_AVX2 static void accumulateAVX2(const LUT3D& lut, const float8x& base, const float8x& offset, const float8x& weight, float8x (&result)[3]) {
+			const SIMD<int32, 8> index = (base + offset).RoundToInt32();
+			for (uint32 c = 0; c < 3; ++c) { result[c] = float8x::MultiplyAdd(float8x::Gather(lut.samples.begin() + c, index), weight, result[c]); }
+		}
+
+		// Corner offsets are computed in float, exact for any LUT under 2^24 entries, and converted once per corner.
+		GTSL_TARGET_AVX2 static void interpolateAVX2(const LUT3D& lut, float32* r, float32* g, float32* b, const LUTInterpolation interpolation) {
+			const float8x zero(0.0f);
+
+			float8x cellR, cellG, cellB, fr, fg, fb;
+			coordinateAVX2(lut, r, 0, cellR, fr); coordinateAVX2(lut, g, 1, cellG, fg); coordinateAVX2(lut, b, 2, cellB, fb);
+
+			const float32 n = static_cast<float32>(lut.size);
+			const float8x base = ((cellB * float8x(n) + cellG) * float8x(n) + cellR) * float8x(4.0f);
+			const float8x stepR(4.0f), stepG(4.0f * n), stepB(4.0f * n * n), stepAll(4.0f * (1.0f + n + n * n));
+
+			float8x result[3];
+
+			if (interpolation == LUTInterpolation::TRILINEAR) {
+				const float8x one(1.0f), ir = one - fr, ig = one - fg, ib = one - fb;
+				accumulateAVX2(lut, base, zero, ir * ig * ib, result); accumulateAVX2(lut, base, stepR, fr * ig * ib, result);
+				accumulateAVX2(lut, base, stepG, ir * fg * ib, result); accumulateAVX2(lut, base, stepR + stepG, fr * fg * ib, result);
+				accumulateAVX2(lut, base, stepB, ir * ig * fb, result); accumulateAVX2(lut, base, stepR + stepB, fr * ig * fb, result);
+				accumulateAVX2(lut, base, stepG + stepB, ir * fg * fb, result); accumulateAVX2(lut, base, stepAll, fr * fg * fb, result);
+			} else {
+				const float8x rOverG = fr >= fg, rOverB = fr >= fb, gOverB = fg >= fb;
+
+				// later blends override earlier ones, so the masks don't need to exclude each other
+				const float8x largestStep(float8x(stepB, stepG, gOverB), stepR, rOverG & rOverB);
+				const float8x smallestStep(float8x(stepR, stepG, rOverG), stepB, rOverB & gOverB);
+				const float8x f1 = float8x::Max(fr, float8x::Max(fg, fb)), f3 = float8x::Min(fr, float8x::Min(fg, fb)), f2 = fr + fg + fb - f1 - f3;
+
+				accumulateAVX2(lut, base, zero, float8x(1.0f) - f1, result); accumulateAVX2(lut, base, largestStep, f1 - f2, result);
+				accumulateAVX2(lut, base, stepAll - smallestStep, f2 - f3, result); accumulateAVX2(lut, base, stepAll, f3, result);
+			}
+
+			result[0].CopyTo(AlignedPointer<float32, 32>(r)); result[1].CopyTo(AlignedPointer<float32, 32>(g)); result[2].CopyTo(AlignedPointer<float32, 32>(b));
+		}
+
+		static void interpolateScalar(const LUT3D& lut, float32* r, float32* g, float32* b, const LUTInterpolation interpolation) {
+			const float32 last = static_cast<float32>(lut.size - 1);
+			const uint32 n = lut.size, stepR = 4, stepG = 4 * n, stepB = 4 * n * n, stepAll = stepR + stepG + stepB;
+
+			for (uint32 i = 0; i < 8; ++i) {
+				const float32 channels[3] = { r[i], g[i], b[i] };
+				uint32 cell[3]; float32 f[3];
+
+				for (uint32 axis = 0; axis < 3; ++axis) {
+					const float32 t = (channels[axis] - lut.domainMin[axis]) * (last / (lut.domainMax[axis] - lut.domainMin[axis]));
+					const float32 clamped = Math::Min(Math::Max(t, 0.0f), last); // max first so NaN maps to 0
+					const float32 floored = Math::Min(Math::Floor(clamped), last - 1.0f);
+					cell[axis] = static_cast<uint32>(floored); f[axis] = clamped - floored;
+				}
+
+				const uint32 base = ((cell[2] * n + cell[1]) * n + cell[0]) * 4;
+				float32 result[3] = {};
+
+				auto accumulate = [&](const uint32 offset, const float32 weight) {
+					for (uint32 c = 0; c < 3; ++c) { result[c] += lut.samples[base + offset + c] * weight; }
+				};
+
+				if (interpolation == LUTInterpolation::TRILINEAR) {
+					const float32 ir = 1.0f - f[0], ig = 1.0f - f[1], ib = 1.0f - f[2];
+					accumulate(0, ir * ig * ib); accumulate(stepR, f[0] * ig * ib);
+					accumulate(stepG, ir * f[1] * ib); accumulate(stepR + stepG, f[0] * f[1] * ib);
+					accumulate(stepB, ir * ig * f[2]); accumulate(stepR + stepB, f[0] * ig * f[2]);
+					accumulate(stepG + stepB, ir * f[1] * f[2]); accumulate(stepAll, f[0] * f[1] * f[2]);
 				} else {
-					f(vec);
-					++samples;
+					const bool rOverG = f[0] >= f[1], rOverB = f[0] >= f[2], gOverB = f[1] >= f[2];
+
+					const uint32 largestStep = rOverG && rOverB ? stepR : (gOverB ? stepG : stepB);
+					const uint32 smallestStep = rOverB && gOverB ? stepB : (rOverG ? stepG : stepR);
+					const float32 f1 = Math::Max(f[0], Math::Max(f[1], f[2])), f3 = Math::Min(f[0], Math::Min(f[1], f[2])), f2 = f[0] + f[1] + f[2] - f1 - f3;
+
+					accumulate(0, 1.0f - f1); accumulate(largestStep, f1 - f2);
+					accumulate(stepAll - smallestStep, f2 - f3); accumulate(stepAll, f3);
 				}
+
+				r[i] = result[0]; g[i] = result[1]; b[i] = result[2];
 			}
-		});
+		}
 
-		return lutData.Size != 0 and samples == (lutData.Size * lutData.Size * lutData.Size);
-	}
+		/**
+		 * \brief Interpolates 8 colors in place, r, g and b must be 32 byte aligned.
+		 */
+		void interpolate(float32* r, float32* g, float32* b, const LUTInterpolation interpolation) const {
+			static const Dispatcher<void(const LUT3D&, float32*, float32*, float32*, LUTInterpolation)> interpolator(interpolateScalar, nullptr, interpolateAVX2, nullptr);
+			interpolator(*this, r, g, b, interpolation);
+		}
+	};
 }
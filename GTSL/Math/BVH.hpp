@@ -0,0 +1,610 @@
+#pragma once
+
+#include "Math.hpp"
+#include "Vectors.hpp"
+
+#include "GTSL/Core.h"
+#include "GTSL/Assert.h"
+#include "GTSL/Atomic.hpp"
+#include "GTSL/Bitman.h"
+#include "GTSL/Range.hpp"
+#include "GTSL/Thread.hpp"
+#include "GTSL/Vector.hpp"
+
+namespace GTSL
+{
+	inline constexpr float32 FLOAT_MAX = 3.402823466e+38F;
+
+	/**
+	 * \brief Axis aligned bounding box, defined by it's minimum and maximum corners.
+	 */
+	struct AABB {
+		AABB() = default;
+		AABB(const Vector3 min, const Vector3 max) : Min(min), Max(max) {}
+
+		Vector3 Min{ FLOAT_MAX }, Max{ -FLOAT_MAX };
+
+		/**
+		 * \brief Grows this box to enclose other.
+		 */
+		void Merge(const AABB& other) { Min = Math::Min(Min, other.Min); Max = Math::Max(Max, other.Max); }
+		void Merge(const Vector3 point) { Min = Math::Min(Min, point); Max = Math::Max(Max, point); }
+
+		[[nodiscard]] Vector3 GetCenter() const { return (Min + Max) * 0.5f; }
+		[[nodiscard]] Vector3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		/**
+		 * \brief Returns half the surface area of the box, which is all the surface area heuristic needs.
+		 */
+		[[nodiscard]] float32 GetHalfArea() const {
+			const auto size = Max - Min;
+			return size.X() * size.Y() + size.Y() * size.Z() + size.Z() * size.X();
+		}
+
+		[[nodiscard]] bool Overlaps(const AABB& other) const { return Min <= other.Max && Max >= other.Min; }
+	};
+
+	struct RaycastHit {
+		uint32 Primitive = ~0u; float32 Distance = FLOAT_MAX;
+
+		explicit operator bool() const { return Primitive != ~0u; }
+	};
+
+	struct ClosestHit {
+		uint32 Primitive = ~0u; float32 DistanceSquared = FLOAT_MAX;
+
+		explicit operator bool() const { return Primitive != ~0u; }
+	};
+
+	/**
+	 * \brief Bounding volume hierarchy over axis aligned boxes. Built as a binary tree with the binned surface area heuristic and then collapsed into 8 wide nodes,
+	 * whose children bounds are stored as structure of arrays so every node is tested against a query with a single float8x operation per component where AVX2 is available.
+	 * Every child slot holds either another node or a single primitive, so leaf bounds are exact and moving a primitive only needs a refit of it's ancestors.
+	 * Nodes are laid out in depth first order, children always come after their parent.
+	 * \tparam ALLOCATOR Allocator used for the nodes and primitive data.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class BVH {
+	public:
+		static constexpr uint32 WIDTH = 8;
+
+		explicit BVH(const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), nodes(allocator), parents(allocator), bounds(allocator), primitiveNodes(allocator) {}
+
+		/**
+		 * \brief Builds the hierarchy, replacing the previous one.
+		 * \param primitiveBounds Bounding box of every primitive, primitives are referred to by their index in this range.
+		 * \param threadCount Number of threads used to build, including the calling one. The top of the tree is split serially and independent subtrees are built in parallel.
+		 * \param firstThreadId Thread id given to the first spawned thread, the rest are given consecutive ids.
+		 */
+		void Build(const Range<const AABB*> primitiveBounds, const uint8 threadCount = 1, const uint8 firstThreadId = 1) {
+			const uint32 primitiveCount = static_cast<uint32>(primitiveBounds.ElementCount());
+
+			nodes.Resize(0); parents.Resize(0); bounds.Resize(0); primitiveNodes.Resize(0);
+			bounds.PushBack(primitiveBounds); primitiveNodes.EmplaceGroup(primitiveCount, INVALID);
+
+			if (!primitiveCount) { return; }
+
+			Vector<uint32, ALLOCATOR> indices(primitiveCount, allocator); Vector<Vector3, ALLOCATOR> centers(primitiveCount, allocator);
+			for (uint32 i = 0; i < primitiveCount; ++i) { indices.EmplaceBack(i); centers.EmplaceBack(bounds[i].GetCenter()); }
+
+			builder builder{ indices.begin(), centers.begin(), bounds.begin() };
+			Vector<binaryNode, ALLOCATOR> binaryNodes(primitiveCount, allocator);
+
+			uint32 root;
+
+			if (threadCount > 1 && primitiveCount >= MIN_TASK_PRIMITIVES * 2) {
+				const uint32 taskDepth = FindLastSetBit(static_cast<uint32>(threadCount - 1)).Get() + 2; // about twice as many tasks as threads, for balance
+				Vector<buildTask, ALLOCATOR> tasks(1u << taskDepth, allocator);
+
+				root = buildTop(builder, binaryNodes, 0, primitiveCount, 0, taskDepth, tasks);
+				buildWorkers(builder, tasks, threadCount, firstThreadId);
+
+				for (auto& task : tasks) { // relocate every subtree after the top nodes
+					const uint32 offset = binaryNodes.GetLength();
+					for (auto binary : task.Nodes) {
+						if (!(binary.Left & LEAF)) { binary.Left += offset; }
+						if (!(binary.Right & LEAF)) { binary.Right += offset; }
+						binaryNodes.EmplaceBack(binary);
+					}
+					task.Root = task.Root & LEAF ? task.Root : task.Root + offset;
+				}
+
+				auto resolve = [&](uint32& reference) { if ((reference & (LEAF | TASK)) == TASK) { reference = tasks[reference & ~TASK].Root; } };
+				for (uint32 i = 0; i < binaryNodes.GetLength(); ++i) { resolve(binaryNodes[i].Left); resolve(binaryNodes[i].Right); }
+				resolve(root);
+			} else {
+				root = builder.Build(binaryNodes, 0, primitiveCount, 0);
+			}
+
+			if (root & LEAF) { // a single primitive, still needs a node to hold it
+				nodes.EmplaceBack(); parents.EmplaceBack(INVALID);
+				setSlot(0, 0, root & ~LEAF, bounds[root & ~LEAF], true); nodes[0].Count = 1;
+			} else {
+				collapse(binaryNodes, root, INVALID);
+			}
+		}
+
+		/**
+		 * \brief Updates the bounds of a single primitive and refits it's ancestors, stopping as soon as a node's bounds don't change. The tree's topology is kept,
+		 * so query performance degrades as primitives move far from where they were when built.
+		 */
+		void SetBounds(const uint32 primitive, const AABB& box) {
+			bounds[primitive] = box;
+
+			uint32 node = primitiveNodes[primitive];
+			setSlot(node, findSlot(node, primitive | LEAF), primitive, box, true);
+
+			for (uint32 parent = parents[node]; parent != INVALID; node = parent, parent = parents[node]) {
+				const AABB nodeBounds = getNodeBounds(node);
+				const uint32 slot = findSlot(parent, node);
+				if (getSlotBounds(parent, slot).Min == nodeBounds.Min && getSlotBounds(parent, slot).Max == nodeBounds.Max) { break; }
+				setSlot(parent, slot, node, nodeBounds, false);
+			}
+		}
+
+		/**
+		 * \brief Updates the bounds of every primitive and refits the whole tree bottom up in a single pass, cheaper than SetBounds when most primitives moved.
+		 * \param primitiveBounds New bounds of every primitive, must have the same length as the range the tree was built with.
+		 */
+		void Refit(const Range<const AABB*> primitiveBounds) {
+			GTSL_ASSERT(primitiveBounds.ElementCount() == bounds.GetLength(), "Primitive count doesn't match the one the hierarchy was built with.")
+			for (uint32 i = 0; i < bounds.GetLength(); ++i) { bounds[i] = primitiveBounds[i]; }
+
+			for (uint32 n = nodes.GetLength(); n-- > 0;) { // children come after their parents, so a reverse walk visits them first
+				for (uint32 c = 0; c < nodes[n].Count; ++c) {
+					const uint32 child = nodes[n].Children[c];
+					if (child & LEAF) { setSlot(n, c, child & ~LEAF, bounds[child & ~LEAF], true); } else { setSlot(n, c, child, getNodeBounds(child), false); }
+				}
+			}
+		}
+
+		/**
+		 * \brief Finds the closest primitive hit by a ray. Children are visited front to back and subtrees further than the closest hit so far are skipped.
+		 * \param origin Origin of the ray.
+		 * \param direction Direction of the ray, doesn't need to be normalized, distances are measured in multiples of it.
+		 * \param maxDistance Distance past which hits are ignored.
+		 * \param intersect Called as intersect(uint32 primitive, float32 boxDistance) for every primitive whose bounds are hit, boxDistance being the distance at which the ray enters it's box.
+		 * Must return the distance at which the primitive is hit, or FLOAT_MAX if it isn't. Returning boxDistance tests against the boxes alone.
+		 * \return Closest hit, evaluates to false if nothing was hit.
+		 */
+		template<typename F>
+		RaycastHit Raycast(const Vector3 origin, const Vector3 direction, const float32 maxDistance, F&& intersect) const {
+			RaycastHit hit; hit.Distance = maxDistance;
+			if (!nodes.GetLength()) { return hit; }
+
+			const Vector3 inverseDirection(1.0f / direction.X(), 1.0f / direction.Y(), 1.0f / direction.Z());
+
+			stackEntry stack[MAX_STACK_DEPTH]; uint32 stackLength = 0;
+			stack[stackLength++] = { 0, 0.0f };
+
+			while (stackLength) {
+				const auto entry = stack[--stackLength];
+				if (entry.Key > hit.Distance) { continue; }
+
+				const auto& node = nodes[entry.Node];
+				alignas(32) float32 distances[WIDTH];
+				pushSorted(node, testRay(node, origin, inverseDirection, hit.Distance, distances), distances, stack, stackLength, [&](const uint32 primitive, const float32 boxDistance) {
+					const float32 distance = intersect(primitive, boxDistance);
+					if (distance < hit.Distance) { hit.Distance = distance; hit.Primitive = primitive; }
+				});
+			}
+
+			return hit;
+		}
+
+		/**
+		 * \brief Casts a batch of rays, see the single ray version.
+		 * \param intersect Called as intersect(uint32 ray, uint32 primitive, float32 boxDistance).
+		 */
+		template<typename F>
+		void Raycast(const Range<const Vector3*> origins, const Range<const Vector3*> directions, const float32 maxDistance, Range<RaycastHit*> hits, F&& intersect) const {
+			for (uint32 r = 0; r < origins.ElementCount(); ++r) {
+				hits[r] = Raycast(origins[r], directions[r], maxDistance, [&](const uint32 primitive, const float32 boxDistance) { return intersect(r, primitive, boxDistance); });
+			}
+		}
+
+		/**
+		 * \brief Calls onOverlap(uint32 primitive) for every primitive whose bounds overlap box. Touching boxes are considered overlapping.
+		 * \return Number of overlapping primitives.
+		 */
+		template<typename F>
+		uint32 Overlap(const AABB& box, F&& onOverlap) const {
+			if (!nodes.GetLength()) { return 0; }
+
+			uint32 stack[MAX_STACK_DEPTH]; uint32 stackLength = 0, count = 0;
+			stack[stackLength++] = 0;
+
+			while (stackLength) {
+				const auto& node = nodes[stack[--stackLength]];
+
+				for (uint32 bits = testBox(node, box) & ((1u << node.Count) - 1); bits; bits &= bits - 1) {
+					const uint32 child = node.Children[FindFirstSetBit(bits).Get()];
+					if (child & LEAF) { onOverlap(child & ~LEAF); ++count; } else { GTSL_ASSERT(stackLength < MAX_STACK_DEPTH, "Hierarchy too deep.") stack[stackLength++] = child; }
+				}
+			}
+
+			return count;
+		}
+
+		/**
+		 * \brief Calls onPair(uint32 a, uint32 b), with a < b, once for every pair of primitives whose bounds overlap.
+		 * \return Number of overlapping pairs.
+		 */
+		template<typename F>
+		uint32 FindOverlappingPairs(F&& onPair) const {
+			uint32 count = 0;
+
+			for (uint32 a = 0; a < bounds.GetLength(); ++a) {
+				Overlap(bounds[a], [&](const uint32 b) { if (a < b) { onPair(a, b); ++count; } });
+			}
+
+			return count;
+		}
+
+		/**
+		 * \brief Finds the primitive closest to a point. Children are visited closest first and subtrees further than the closest primitive so far are skipped.
+		 * \param point Point to measure distances from.
+		 * \param distanceSquared Called as distanceSquared(uint32 primitive, float32 boxDistanceSquared) for every candidate primitive, must return the squared distance
+		 * from point to the primitive. Returning boxDistanceSquared measures against the boxes alone.
+		 * \param maxDistanceSquared Squared distance past which primitives are ignored.
+		 * \return Closest primitive, evaluates to false if no primitive is closer than maxDistanceSquared.
+		 */
+		template<typename F>
+		ClosestHit FindClosest(const Vector3 point, F&& distanceSquared, const float32 maxDistanceSquared = FLOAT_MAX) const {
+			ClosestHit hit; hit.DistanceSquared = maxDistanceSquared;
+			if (!nodes.GetLength()) { return hit; }
+
+			stackEntry stack[MAX_STACK_DEPTH]; uint32 stackLength = 0;
+			stack[stackLength++] = { 0, 0.0f };
+
+			while (stackLength) {
+				const auto entry = stack[--stackLength];
+				if (entry.Key > hit.DistanceSquared) { continue; }
+
+				const auto& node = nodes[entry.Node];
+				alignas(32) float32 distances[WIDTH];
+				pushSorted(node, testPoint(node, point, hit.DistanceSquared, distances), distances, stack, stackLength, [&](const uint32 primitive, const float32 boxDistance) {
+					const float32 distance = distanceSquared(primitive, boxDistance);
+					if (distance < hit.DistanceSquared) { hit.DistanceSquared = distance; hit.Primitive = primitive; }
+				});
+			}
+
+			return hit;
+		}
+
+		[[nodiscard]] uint32 GetPrimitiveCount() const { return bounds.GetLength(); }
+		[[nodiscard]] uint32 GetNodeCount() const { return nodes.GetLength(); }
+		[[nodiscard]] const AABB& GetBounds(const uint32 primitive) const { return bounds[primitive]; }
+
+		/**
+		 * \brief Returns the bounds of the whole hierarchy.
+		 */
+		[[nodiscard]] AABB GetRootBounds() const { return nodes.GetLength() ? getNodeBounds(0) : AABB(); }
+
+	private:
+		static constexpr uint32 LEAF = 1u << 31, TASK = 1u << 30, INVALID = ~0u;
+		static constexpr uint32 BINS = 16, MIN_TASK_PRIMITIVES = 1024;
+		// Past MAX_SAH_DEPTH ranges are halved by count, so no tree is deeper than MAX_DEPTH for up to 2^32 primitives. Every level of a traversal
+		// leaves at most WIDTH - 1 siblings on the stack, which bounds it's size.
+		static constexpr uint32 MAX_SAH_DEPTH = 32, MAX_DEPTH = MAX_SAH_DEPTH + 32, MAX_STACK_DEPTH = MAX_DEPTH * (WIDTH - 1) + 1;
+
+		struct wideNode { // not over aligned, allocators only have to honor malloc's alignment and nodes are read with unaligned loads
+			float32 MinX[WIDTH], MinY[WIDTH], MinZ[WIDTH], MaxX[WIDTH], MaxY[WIDTH], MaxZ[WIDTH];
+			uint32 Children[WIDTH];
+			uint32 Count = 0;
+
+			wideNode() {
+				for (uint32 i = 0; i < WIDTH; ++i) { // empty boxes never pass any test
+					MinX[i] = MinY[i] = MinZ[i] = FLOAT_MAX; MaxX[i] = MaxY[i] = MaxZ[i] = -FLOAT_MAX; Children[i] = INVALID;
+				}
+			}
+		};
+
+		struct binaryNode {
+			AABB Bounds;
+			uint32 Left = INVALID, Right = INVALID; // node index, primitive | LEAF or task | TASK
+		};
+
+		struct stackEntry {
+			uint32 Node; float32 Key;
+		};
+
+		struct buildTask {
+			buildTask(const uint32 begin, const uint32 end, const uint32 depth, const ALLOCATOR& allocator) : Begin(begin), End(end), Depth(depth), Nodes(allocator) {}
+
+			uint32 Begin, End, Depth, Root = INVALID;
+			Vector<binaryNode, ALLOCATOR> Nodes;
+		};
+
+		/**
+		 * \brief Builds binary subtrees over disjoint ranges of the shared index array, so many can run concurrently.
+		 */
+		struct builder {
+			uint32* Indices; const Vector3* Centers; const AABB* Bounds;
+
+			uint32 Build(Vector<binaryNode, ALLOCATOR>& out, const uint32 begin, const uint32 end, const uint32 depth) const {
+				if (end - begin == 1) { return Indices[begin] | LEAF; }
+
+				const uint32 index = out.GetLength(); out.EmplaceBack();
+				const uint32 middle = split(begin, end, depth, out[index].Bounds);
+				const uint32 left = Build(out, begin, middle, depth + 1), right = Build(out, middle, end, depth + 1);
+				out[index].Left = left; out[index].Right = right;
+				return index;
+			}
+
+			/**
+			 * \brief Computes the bounds of a range and partitions it with the binned surface area heuristic along the axis of largest centroid extent.
+			 * Ranges deeper than MAX_SAH_DEPTH, only reached by very uneven distributions, are split in half instead to bound the tree's depth.
+			 * \return Index of the first element of the right partition.
+			 */
+			uint32 split(const uint32 begin, const uint32 end, const uint32 depth, AABB& rangeBounds) const {
+				AABB centerBounds;
+
+				for (uint32 i = begin; i < end; ++i) { rangeBounds.Merge(Bounds[Indices[i]]); centerBounds.Merge(Centers[Indices[i]]); }
+
+				if (depth >= MAX_SAH_DEPTH) { return begin + (end - begin) / 2; }
+
+				const auto size = centerBounds.Max - centerBounds.Min;
+				const uint8 axis = size.X() > size.Y() ? (size.X() > size.Z() ? 0 : 2) : (size.Y() > size.Z() ? 1 : 2);
+				if (size[axis] <= 0.0f) { return begin + (end - begin) / 2; } // every center is the same, any split is as good
+
+				const float32 axisMin = centerBounds.Min[axis], scale = static_cast<float32>(BINS) * 0.9999f / size[axis];
+				auto binOf = [&](const uint32 primitive) { return Math::Min(static_cast<uint32>((Centers[primitive][axis] - axisMin) * scale), BINS - 1); };
+
+				AABB binBounds[BINS]; uint32 binCounts[BINS]{};
+				for (uint32 i = begin; i < end; ++i) { const uint32 bin = binOf(Indices[i]); binBounds[bin].Merge(Bounds[Indices[i]]); ++binCounts[bin]; }
+
+				float32 rightCosts[BINS]; AABB accumulated; uint32 accumulatedCount = 0;
+				for (uint32 b = BINS - 1; b > 0; --b) { accumulated.Merge(binBounds[b]); accumulatedCount += binCounts[b]; rightCosts[b] = accumulatedCount ? accumulated.GetHalfArea() * static_cast<float32>(accumulatedCount) : 0.0f; }
+
+				uint32 bestSplit = 0; float32 bestCost = FLOAT_MAX; accumulated = AABB(); accumulatedCount = 0;
+				for (uint32 b = 1; b < BINS; ++b) {
+					accumulated.Merge(binBounds[b - 1]); accumulatedCount += binCounts[b - 1];
+					const float32 cost = (accumulatedCount ? accumulated.GetHalfArea() * static_cast<float32>(accumulatedCount) : 0.0f) + rightCosts[b];
+					if (cost < bestCost) { bestCost = cost; bestSplit = b; }
+				}
+
+				uint32 left = begin, right = end;
+				while (left < right) {
+					if (binOf(Indices[left]) < bestSplit) { ++left; } else { --right; const uint32 t = Indices[left]; Indices[left] = Indices[right]; Indices[right] = t; }
+				}
+
+				return left == begin || left == end ? begin + (end - begin) / 2 : left;
+			}
+		};
+
+		struct buildWorkerData {
+			const builder* Builder; Vector<buildTask, ALLOCATOR>* Tasks; uint32* NextTask;
+		};
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		Vector<wideNode, ALLOCATOR> nodes;
+		Vector<uint32, ALLOCATOR> parents;
+		Vector<AABB, ALLOCATOR> bounds;
+		Vector<uint32, ALLOCATOR> primitiveNodes;
+
+		/**
+		 * \brief Splits serially until taskDepth levels deep, then hands the remaining ranges out as tasks.
+		 */
+		uint32 buildTop(const builder& builder, Vector<binaryNode, ALLOCATOR>& out, const uint32 begin, const uint32 end, const uint32 depth, const uint32 taskDepth, Vector<buildTask, ALLOCATOR>& tasks) {
+			if (depth == taskDepth || end - begin < MIN_TASK_PRIMITIVES) {
+				tasks.EmplaceBack(begin, end, depth, allocator);
+				return (tasks.GetLength() - 1) | TASK;
+			}
+
+			const uint32 index = out.GetLength(); out.EmplaceBack();
+			const uint32 middle = builder.split(begin, end, depth, out[index].Bounds);
+			const uint32 left = buildTop(builder, out, begin, middle, depth + 1, taskDepth, tasks), right = buildTop(builder, out, middle, end, depth + 1, taskDepth, tasks);
+			out[index].Left = left; out[index].Right = right;
+			return index;
+		}
+
+		static void buildWorker(buildWorkerData* data) {
+			for (uint32 t = AtomicFetchAdd(*data->NextTask, 1u); t < data->Tasks->GetLength(); t = AtomicFetchAdd(*data->NextTask, 1u)) {
+				auto& task = (*data->Tasks)[t];
+				task.Root = data->Builder->Build(task.Nodes, task.Begin, task.End, task.Depth);
+			}
+		}
+
+		void buildWorkers(const builder& builder, Vector<buildTask, ALLOCATOR>& tasks, const uint8 threadCount, const uint8 firstThreadId) {
+			uint32 nextTask = 0;
+			buildWorkerData data{ &builder, &tasks, &nextTask };
+
+			Vector<Thread, ALLOCATOR> threads(threadCount, allocator);
+			for (uint8 i = 0; i + 1 < threadCount; ++i) {
+				threads.EmplaceBack(allocator, static_cast<uint8>(firstThreadId + i), Delegate<void(buildWorkerData*)>::template Create<&BVH::buildWorker>(), &data);
+			}
+
+			buildWorker(&data); // the calling thread takes tasks too
+
+			for (auto& thread : threads) { thread.Join(allocator); }
+		}
+
+		/**
+		 * \brief Turns a binary subtree into 8 wide nodes, by repeatedly opening the child with the largest surface area until the node is full.
+		 */
+		uint32 collapse(const Vector<binaryNode, ALLOCATOR>& binaryNodes, const uint32 binaryIndex, const uint32 parent) {
+			const uint32 index = nodes.GetLength();
+			nodes.EmplaceBack(); parents.EmplaceBack(parent);
+
+			uint32 children[WIDTH] = { binaryNodes[binaryIndex].Left, binaryNodes[binaryIndex].Right }, count = 2;
+
+			while (count < WIDTH) {
+				uint32 largest = INVALID; float32 largestArea = -1.0f;
+				for (uint32 c = 0; c < count; ++c) {
+					if (!(children[c] & LEAF) && binaryNodes[children[c]].Bounds.GetHalfArea() > largestArea) { largestArea = binaryNodes[children[c]].Bounds.GetHalfArea(); largest = c; }
+				}
+
+				if (largest == INVALID) { break; }
+
+				const auto& opened = binaryNodes[children[largest]];
+				children[largest] = opened.Left; children[count++] = opened.Right;
+			}
+
+			for (uint32 c = 0; c < count; ++c) {
+				if (children[c] & LEAF) {
+					setSlot(index, c, children[c] & ~LEAF, bounds[children[c] & ~LEAF], true);
+				} else {
+					const uint32 child = collapse(binaryNodes, children[c], index); // may reallocate nodes, index again afterwards
+					setSlot(index, c, child, binaryNodes[children[c]].Bounds, false);
+				}
+			}
+
+			nodes[index].Count = count;
+			return index;
+		}
+
+		void setSlot(const uint32 n, const uint32 slot, const uint32 child, const AABB& box, const bool leaf) {
+			auto& node = nodes[n];
+			node.MinX[slot] = box.Min.X(); node.MinY[slot] = box.Min.Y(); node.MinZ[slot] = box.Min.Z();
+			node.MaxX[slot] = box.Max.X(); node.MaxY[slot] = box.Max.Y(); node.MaxZ[slot] = box.Max.Z();
+			node.Children[slot] = leaf ? child | LEAF : child;
+			if (leaf) { primitiveNodes[child] = n; }
+		}
+
+		[[nodiscard]] AABB getSlotBounds(const uint32 n, const uint32 slot) const {
+			const auto& node = nodes[n];
+			return AABB({ node.MinX[slot], node.MinY[slot], node.MinZ[slot] }, { node.MaxX[slot], node.MaxY[slot], node.MaxZ[slot] });
+		}
+
+		[[nodiscard]] AABB getNodeBounds(const uint32 n) const {
+			AABB box;
+			for (uint32 c = 0; c < nodes[n].Count; ++c) { box.Merge(getSlotBounds(n, c)); }
+			return box;
+		}
+
+		[[nodiscard]] uint32 findSlot(const uint32 n, const uint32 child) const {
+			for (uint32 c = 0; c < nodes[n].Count; ++c) { if (nodes[n].Children[c] == child) { return c; } }
+			GTSL_ASSERT(false, "Child not found in node.")
+			return 0;
+		}
+
+		/**
+		 * \brief Slab tests a ray against every child of a node, writing the entry distances and returning a bit per child hit closer than maxDistance.
+		 */
+		GTSL_TARGET_AVX2 static uint32 testRayAVX2(const wideNode& node, const Vector3 origin, const Vector3 inverseDirection, const float32 maxDistance, float32 (&distances)[WIDTH]) {
+			const float8x ox(origin.X()), oy(origin.Y()), oz(origin.Z()), ix(inverseDirection.X()), iy(inverseDirection.Y()), iz(inverseDirection.Z());
+
+			const float8x tx0 = (float8x(UnalignedPointer<const float32>(node.MinX)) - ox) * ix, tx1 = (float8x(UnalignedPointer<const float32>(node.MaxX)) - ox) * ix;
+			const float8x ty0 = (float8x(UnalignedPointer<const float32>(node.MinY)) - oy) * iy, ty1 = (float8x(UnalignedPointer<const float32>(node.MaxY)) - oy) * iy;
+			const float8x tz0 = (float8x(UnalignedPointer<const float32>(node.MinZ)) - oz) * iz, tz1 = (float8x(UnalignedPointer<const float32>(node.MaxZ)) - oz) * iz;
+
+			const auto tNear = float8x::Max(float8x::Max(float8x::Min(tx0, tx1), float8x::Min(ty0, ty1)), float8x::Max(float8x::Min(tz0, tz1), float8x(0.0f)));
+			const auto tFar = float8x::Min(float8x::Min(float8x::Max(tx0, tx1), float8x::Max(ty0, ty1)), float8x::Min(float8x::Max(tz0, tz1), float8x(maxDistance)));
+
+			tNear.CopyTo(AlignedPointer<float32, 32>(distances));
+			return static_cast<uint32>((tNear <= tFar).BitMask());
+		}
+
+		static uint32 testRayScalar(const wideNode& node, const Vector3 origin, const Vector3 inverseDirection, const float32 maxDistance, float32 (&distances)[WIDTH]) {
+			uint32 bits = 0;
+
+			for (uint32 c = 0; c < WIDTH; ++c) {
+				const float32 tx0 = (node.MinX[c] - origin.X()) * inverseDirection.X(), tx1 = (node.MaxX[c] - origin.X()) * inverseDirection.X();
+				const float32 ty0 = (node.MinY[c] - origin.Y()) * inverseDirection.Y(), ty1 = (node.MaxY[c] - origin.Y()) * inverseDirection.Y();
+				const float32 tz0 = (node.MinZ[c] - origin.Z()) * inverseDirection.Z(), tz1 = (node.MaxZ[c] - origin.Z()) * inverseDirection.Z();
+
+				const float32 tNear = Math::Max(Math::Max(Math::Min(tx0, tx1), Math::Min(ty0, ty1)), Math::Max(Math::Min(tz0, tz1), 0.0f));
+				const float32 tFar = Math::Min(Math::Min(Math::Max(tx0, tx1), Math::Max(ty0, ty1)), Math::Min(Math::Max(tz0, tz1), maxDistance));
+
+				distances[c] = tNear; bits |= static_cast<uint32>(tNear <= tFar) << c;
+			}
+
+			return bits;
+		}
+
+		static uint32 testRay(const wideNode& node, const Vector3 origin, const Vector3 inverseDirection, const float32 maxDistance, float32 (&distances)[WIDTH]) {
+			static const Dispatcher<uint32(const wideNode&, Vector3, Vector3, float32, float32(&)[WIDTH])> rayTest(testRayScalar, nullptr, testRayAVX2, nullptr);
+			return rayTest(node, origin, inverseDirection, maxDistance, distances);
+		}
+
+		/**
+		 * \brief Returns a bit per child of a node whose bounds overlap box.
+		 */
+		GTSL_TARGET_AVX2 static uint32 testBoxAVX2(const wideNode& node, const AABB& box) {
+			const float8x minX(box.Min.X()), minY(box.Min.Y()), minZ(box.Min.Z()), maxX(box.Max.X()), maxY(box.Max.Y()), maxZ(box.Max.Z());
+
+			const auto overlaps = (float8x(UnalignedPointer<const float32>(node.MinX)) <= maxX) & (float8x(UnalignedPointer<const float32>(node.MaxX)) >= minX)
+				& (float8x(UnalignedPointer<const float32>(node.MinY)) <= maxY) & (float8x(UnalignedPointer<const float32>(node.MaxY)) >= minY)
+				& (float8x(UnalignedPointer<const float32>(node.MinZ)) <= maxZ) & (float8x(UnalignedPointer<const float32>(node.MaxZ)) >= minZ);
+
+			return static_cast<uint32>(overlaps.BitMask());
+		}
+
+		static uint32 testBoxScalar(const wideNode& node, const AABB& box) {
+			uint32 bits = 0;
+
+			for (uint32 c = 0; c < WIDTH; ++c) {
+				const bool overlaps = node.MinX[c] <= box.Max.X() && node.MaxX[c] >= box.Min.X() && node.MinY[c] <= box.Max.Y() && node.MaxY[c] >= box.Min.Y() && node.MinZ[c] <= box.Max.Z() && node.MaxZ[c] >= box.Min.Z();
+				bits |= static_cast<uint32>(overlaps) << c;
+			}
+
+			return bits;
+		}
+
+		static uint32 testBox(const wideNode& node, const AABB& box) {
+			static const Dispatcher<uint32(const wideNode&, const AABB&)> boxTest(testBoxScalar, nullptr, testBoxAVX2, nullptr);
+			return boxTest(node, box);
+		}
+
+		/**
+		 * \brief Writes the squared distance from point to every child of a node and returns a bit per child no further than maxDistanceSquared.
+		 */
+		GTSL_TARGET_AVX2 static uint32 testPointAVX2(const wideNode& node, const Vector3 point, const float32 maxDistanceSquared, float32 (&distances)[WIDTH]) {
+			const float8x px(point.X()), py(point.Y()), pz(point.Z()), zero(0.0f);
+
+			const auto dx = float8x::Max(float8x::Max(float8x(UnalignedPointer<const float32>(node.MinX)) - px, px - float8x(UnalignedPointer<const float32>(node.MaxX))), zero);
+			const auto dy = float8x::Max(float8x::Max(float8x(UnalignedPointer<const float32>(node.MinY)) - py, py - float8x(UnalignedPointer<const float32>(node.MaxY))), zero);
+			const auto dz = float8x::Max(float8x::Max(float8x(UnalignedPointer<const float32>(node.MinZ)) - pz, pz - float8x(UnalignedPointer<const float32>(node.MaxZ))), zero);
+			const auto boxDistances = float8x::MultiplyAdd(dx, dx, float8x::MultiplyAdd(dy, dy, dz * dz));
+
+			boxDistances.CopyTo(AlignedPointer<float32, 32>(distances));
+			return static_cast<uint32>((boxDistances <= float8x(maxDistanceSquared)).BitMask());
+		}
+
+		static uint32 testPointScalar(const wideNode& node, const Vector3 point, const float32 maxDistanceSquared, float32 (&distances)[WIDTH]) {
+			uint32 bits = 0;
+
+			for (uint32 c = 0; c < WIDTH; ++c) {
+				const float32 dx = Math::Max(Math::Max(node.MinX[c] - point.X(), point.X() - node.MaxX[c]), 0.0f);
+				const float32 dy = Math::Max(Math::Max(node.MinY[c] - point.Y(), point.Y() - node.MaxY[c]), 0.0f);
+				const float32 dz = Math::Max(Math::Max(node.MinZ[c] - point.Z(), point.Z() - node.MaxZ[c]), 0.0f);
+
+				distances[c] = dx * dx + dy * dy + dz * dz; bits |= static_cast<uint32>(distances[c] <= maxDistanceSquared) << c;
+			}
+
+			return bits;
+		}
+
+		static uint32 testPoint(const wideNode& node, const Vector3 point, const float32 maxDistanceSquared, float32 (&distances)[WIDTH]) {
+			static const Dispatcher<uint32(const wideNode&, Vector3, float32, float32(&)[WIDTH])> pointTest(testPointScalar, nullptr, testPointAVX2, nullptr);
+			return pointTest(node, point, maxDistanceSquared, distances);
+		}
+
+		/**
+		 * \brief Visits the primitives of a node's passing children and pushes it's passing child nodes, so the one with the lowest key is popped first.
+		 */
+		template<typename F>
+		void pushSorted(const wideNode& node, uint32 bits, const float32 (&keys)[WIDTH], stackEntry* stack, uint32& stackLength, F&& onPrimitive) const {
+			bits &= (1u << node.Count) - 1;
+
+			stackEntry pending[WIDTH]; uint32 pendingCount = 0;
+
+			for (; bits; bits &= bits - 1) {
+				const uint32 slot = FindFirstSetBit(bits).Get(), child = node.Children[slot];
+
+				if (child & LEAF) {
+					onPrimitive(child & ~LEAF, keys[slot]);
+				} else {
+					uint32 i = pendingCount++; // insertion sort, descending so the closest ends up on top of the stack
+					for (; i > 0 && pending[i - 1].Key < keys[slot]; --i) { pending[i] = pending[i - 1]; }
+					pending[i] = { child, keys[slot] };
+				}
+			}
+
+			GTSL_ASSERT(stackLength + pendingCount <= MAX_STACK_DEPTH, "Hierarchy too deep.")
+			for (uint32 i = 0; i < pendingCount; ++i) { stack[stackLength++] = pending[i]; }
+		}
+	};
+
+}
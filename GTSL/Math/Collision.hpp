@@ -4,7 +4,11 @@
 
 #include "Math.hpp"
 #include "Vectors.hpp"
+#include "Frustum.h"
 #include <array>
+#include <limits>
+
+#include "GTSL/Bitman.h"
 
 #include "GTSL/Pair.hpp"
 #include "GTSL/Vector.hpp"
@@ -231,4 +235,683 @@ namespace GTSL {
 
 		return collision_info;
 	}
-}
\ No newline at end of file
+
+	/**
+	 * \brief Search directions of the last GJK run on a pair, rebuilt into a simplex with the current support functions to warm start the next run.
+	 * Keep one per pair, alive across frames. A count of 1 holds the last separating direction.
+	 */
+	struct GJKCache {
+		Vector3 Directions[4]; uint8 Count = 0;
+	};
+
+	/**
+	 * \brief GJK simplex on the Minkowski difference A - B, keeping the support points of each shape so EPA can compute contact points. Newest point first.
+	 */
+	struct GJKSimplex {
+		Vector3 Points[4], SupportsA[4], SupportsB[4], Directions[4]; uint8 Count = 0;
+
+		void PushFront(const Vector3 point, const Vector3 supportA, const Vector3 supportB, const Vector3 direction) {
+			for (uint8 i = Count; i > 0; --i) { Points[i] = Points[i - 1]; SupportsA[i] = SupportsA[i - 1]; SupportsB[i] = SupportsB[i - 1]; Directions[i] = Directions[i - 1]; }
+			Points[0] = point; SupportsA[0] = supportA; SupportsB[0] = supportB; Directions[0] = direction;
+			Count = Count < 4 ? Count + 1 : 4;
+		}
+
+		/**
+		 * \brief Keeps only the given vertices, in the given order.
+		 */
+		void Keep(const uint8 a, const uint8 b = 0xFF, const uint8 c = 0xFF) {
+			const GJKSimplex old = *this;
+			const uint8 keep[3] = { a, b, c }; Count = 0;
+			for (const uint8 k : keep) {
+				if (k == 0xFF) { break; }
+				Points[Count] = old.Points[k]; SupportsA[Count] = old.SupportsA[k]; SupportsB[Count] = old.SupportsB[k]; Directions[Count] = old.Directions[k]; ++Count;
+			}
+		}
+	};
+
+	/**
+	 * \brief Point of a contact manifold, tracked across frames by it's offsets to each object's position.
+	 */
+	struct ContactPoint {
+		Vector3 PositionA, PositionB; // world space, on the surface of A and of B
+		Vector3 LocalA, LocalB; // relative to each object's position when found
+		float32 Depth = 0.0f;
+	};
+
+	/**
+	 * \brief Persistent contact manifold of a pair of objects, holds up to 4 points plus the pair's GJK cache. Keep one per pair, alive across frames.
+	 * Points are anchored to the objects' positions only, rotations aren't tracked, so rotating objects lose stale points through the breaking distance test alone.
+	 */
+	struct ContactManifold {
+		static constexpr uint8 MAX_POINTS = 4;
+
+		Vector3 Normal; // from A to B
+		ContactPoint Points[MAX_POINTS]; uint8 PointCount = 0;
+		GJKCache Cache;
+
+		/**
+		 * \brief Moves every point with the objects and drops the ones which separated or slid more than breakingDistance.
+		 */
+		void Refresh(const Vector3 positionA, const Vector3 positionB, const float32 breakingDistance) {
+			for (uint8 i = PointCount; i-- > 0;) {
+				auto& point = Points[i];
+				point.PositionA = positionA + point.LocalA; point.PositionB = positionB + point.LocalB;
+
+				const auto delta = point.PositionA - point.PositionB;
+				point.Depth = Math::DotProduct(delta, Normal);
+				const auto drift = delta - Normal * point.Depth;
+
+				if (point.Depth < -breakingDistance || Math::LengthSquared(drift) > breakingDistance * breakingDistance) { Points[i] = Points[--PointCount]; }
+			}
+		}
+
+		/**
+		 * \brief Adds a point, replacing an existing one closer than mergeDistance. When full keeps the deepest point and the set which spans the largest area.
+		 */
+		void AddPoint(const ContactPoint& point, const float32 mergeDistance) {
+			for (uint8 i = 0; i < PointCount; ++i) {
+				if (Math::DistanceSquared(Points[i].PositionA, point.PositionA) < mergeDistance * mergeDistance) { Points[i] = point; return; }
+			}
+
+			if (PointCount < MAX_POINTS) { Points[PointCount++] = point; return; }
+
+			ContactPoint candidates[MAX_POINTS + 1];
+			for (uint8 i = 0; i < MAX_POINTS; ++i) { candidates[i] = Points[i]; }
+			candidates[MAX_POINTS] = point;
+
+			uint8 deepest = 0;
+			for (uint8 i = 1; i < MAX_POINTS + 1; ++i) { if (candidates[i].Depth > candidates[deepest].Depth) { deepest = i; } }
+
+			uint8 dropped = 0; float32 largestArea = -1.0f;
+			for (uint8 d = 0; d < MAX_POINTS + 1; ++d) {
+				if (d == deepest) { continue; }
+
+				Vector3 kept[MAX_POINTS]; uint8 k = 0;
+				for (uint8 i = 0; i < MAX_POINTS + 1; ++i) { if (i != d) { kept[k++] = candidates[i].PositionA; } }
+
+				float32 area = 0.0f; // area of a quadrilateral is half the length of the cross product of it's diagonals, try every pairing as the order is unknown
+				area = Math::Max(area, Math::LengthSquared(Math::Cross(kept[0] - kept[1], kept[2] - kept[3])));
+				area = Math::Max(area, Math::LengthSquared(Math::Cross(kept[0] - kept[2], kept[1] - kept[3])));
+				area = Math::Max(area, Math::LengthSquared(Math::Cross(kept[0] - kept[3], kept[1] - kept[2])));
+
+				if (area > largestArea) { largestArea = area; dropped = d; }
+			}
+
+			for (uint8 i = 0, k = 0; i < MAX_POINTS + 1; ++i) { if (i != dropped) { Points[k++] = candidates[i]; } }
+		}
+	};
+
+	namespace detail // support and simplex helpers shared by GJK and EPA
+	{
+		inline Vector3 normalizedDirection(const Vector3 direction) { // Math::Normalized's square root isn't precise enough for support queries
+			alignas(16) float32 length[4];
+			float4x(Math::LengthSquared(direction)).SquareRoot().CopyTo(AlignedPointer<float32, 16>(length));
+			return length[0] > 0.0f ? direction * (1.0f / length[0]) : direction;
+		}
+
+		inline void supportOf(auto& objectA, auto& objectB, const Vector3 direction, Vector3& point, Vector3& supportA, Vector3& supportB) {
+			const auto normalized = normalizedDirection(direction);
+			supportA = objectA.GetSupportPointInDirection(normalized); supportB = objectB.GetSupportPointInDirection(-normalized);
+			point = supportA - supportB;
+		}
+
+		inline bool sameDirection(const Vector3 a, const Vector3 b) { return Math::DotProduct(a, b) > 0.0f; }
+
+		/**
+		 * \brief Reduces simplex to the feature closest to the origin and updates the search direction towards it.
+		 * \return Whether the simplex is a tetrahedron which encloses the origin.
+		 */
+		inline bool nextSimplex(GJKSimplex& simplex, Vector3& direction) {
+			auto line = [&]() {
+				const auto ab = simplex.Points[1] - simplex.Points[0], ao = -simplex.Points[0];
+				if (sameDirection(ab, ao)) { direction = Math::Cross(Math::Cross(ab, ao), ab); } else { simplex.Keep(0); direction = ao; }
+			};
+
+			auto triangle = [&]() {
+				const auto ab = simplex.Points[1] - simplex.Points[0], ac = simplex.Points[2] - simplex.Points[0], ao = -simplex.Points[0];
+				const auto abc = Math::Cross(ab, ac);
+
+				if (sameDirection(Math::Cross(abc, ac), ao)) {
+					if (sameDirection(ac, ao)) { simplex.Keep(0, 2); direction = Math::Cross(Math::Cross(ac, ao), ac); } else { simplex.Keep(0, 1); line(); }
+				} else if (sameDirection(Math::Cross(ab, abc), ao)) {
+					simplex.Keep(0, 1); line();
+				} else if (sameDirection(abc, ao)) {
+					direction = abc;
+				} else {
+					simplex.Keep(0, 2, 1); direction = -abc;
+				}
+			};
+
+			switch (simplex.Count) {
+			case 2: line(); return false;
+			case 3: triangle(); return false;
+			case 4: {
+				const auto ab = simplex.Points[1] - simplex.Points[0], ac = simplex.Points[2] - simplex.Points[0], ad = simplex.Points[3] - simplex.Points[0], ao = -simplex.Points[0];
+
+				if (sameDirection(Math::Cross(ab, ac), ao)) { simplex.Keep(0, 1, 2); triangle(); return false; }
+				if (sameDirection(Math::Cross(ac, ad), ao)) { simplex.Keep(0, 2, 3); triangle(); return false; }
+				if (sameDirection(Math::Cross(ad, ab), ao)) { simplex.Keep(0, 3, 1); triangle(); return false; }
+
+				return true;
+			}
+			default: direction = -simplex.Points[0]; return false;
+			}
+		}
+
+		inline bool tetrahedronContainsOrigin(const Vector3 (&points)[4]) {
+			constexpr uint8 FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+
+			for (const auto& face : FACES) {
+				const auto a = points[face[0]];
+				const auto normal = Math::Cross(points[face[1]] - a, points[face[2]] - a);
+				if (Math::DotProduct(normal, -a) * Math::DotProduct(normal, points[face[3]] - a) < 0.0f) { return false; }
+			}
+
+			return true;
+		}
+	}
+
+	/**
+	 * \brief GJK intersection test, warm started from cache, which is updated for the next call. Objects must provide GetPosition() and GetSupportPointInDirection(Vector3 normalizedDirection).
+	 * \param simplex Receives the final simplex, which encloses the origin if the objects intersect and can be handed to CollisionScratch::EPA.
+	 * \return Whether the objects intersect, objects which only touch may be reported either way.
+	 */
+	inline bool GJK(auto& objectA, auto& objectB, GJKCache& cache, GJKSimplex& simplex) {
+		constexpr uint32 MAX_ITERATIONS = 64;
+
+		auto saveCache = [&]() { cache.Count = simplex.Count; for (uint8 i = 0; i < simplex.Count; ++i) { cache.Directions[i] = simplex.Directions[i]; } };
+
+		simplex.Count = 0;
+		Vector3 direction = objectB.GetPosition() - objectA.GetPosition();
+
+		if (cache.Count == 4) { // a resting contact usually still encloses the origin with last frame's directions
+			for (uint8 i = 4; i-- > 0;) { Vector3 point, supportA, supportB; detail::supportOf(objectA, objectB, cache.Directions[i], point, supportA, supportB); simplex.PushFront(point, supportA, supportB, cache.Directions[i]); }
+			if (detail::tetrahedronContainsOrigin(simplex.Points)) { return true; }
+			simplex.Count = 0;
+		}
+
+		if (cache.Count) { direction = cache.Directions[0]; }
+		if (Math::LengthSquared(direction) == 0.0f) { direction = Vector3(1, 0, 0); }
+
+		for (uint32 i = 0; i < MAX_ITERATIONS; ++i) {
+			if (Math::LengthSquared(direction) < 1e-12f) { saveCache(); return true; } // origin lies on the simplex, objects touch
+
+			Vector3 point, supportA, supportB; detail::supportOf(objectA, objectB, direction, point, supportA, supportB);
+
+			if (Math::DotProduct(point, direction) <= 0.0f) { cache.Directions[0] = direction; cache.Count = 1; return false; } // direction separates the objects
+
+			simplex.PushFront(point, supportA, supportB, direction);
+
+			if (detail::nextSimplex(simplex, direction)) { saveCache(); return true; }
+		}
+
+		cache.Count = 0;
+		return false;
+	}
+
+	/**
+	 * \brief GJK intersection test, warm started from cache, which is updated for the next call.
+	 */
+	inline bool GJK(auto& objectA, auto& objectB, GJKCache& cache) {
+		GJKSimplex simplex;
+		return GJK(objectA, objectB, cache, simplex);
+	}
+
+	/**
+	 * \brief Fixed capacity scratch space for EPA, so penetration queries never allocate. Reuse one per thread across queries.
+	 * Every face caches it's normal and distance, and horizon edges are matched through an adjacency bit matrix instead of searching a list.
+	 */
+	class CollisionScratch {
+	public:
+		static constexpr uint32 MAX_VERTICES = 64, MAX_FACES = 2 * MAX_VERTICES, MAX_ITERATIONS = MAX_VERTICES - 4;
+
+		/**
+		 * \brief Expands a GJK simplex enclosing the origin until the face of the Minkowski difference closest to the origin is found.
+		 * \param normal Receives the contact normal, from A to B.
+		 * \param contact Receives the contact points and penetration depth.
+		 * \param tolerance Distance below which the polytope is considered converged.
+		 * \return False if the shapes only touch in a degenerate way the polytope can't be built from.
+		 */
+		bool EPA(auto& objectA, auto& objectB, const GJKSimplex& simplex, Vector3& normal, ContactPoint& contact, const float32 tolerance = 1e-4f) {
+			vertexCount = 0; faceCount = 0;
+			for (uint8 i = 0; i < simplex.Count; ++i) { addVertex(simplex.Points[i], simplex.SupportsA[i], simplex.SupportsB[i]); }
+			if (!completeTetrahedron(objectA, objectB, tolerance)) { return false; }
+
+			constexpr uint8 FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+			for (const auto& face : FACES) { // wind every face so it's normal points away from the opposite vertex
+				const bool flip = Math::DotProduct(Math::Cross(points[face[1]] - points[face[0]], points[face[2]] - points[face[0]]), points[face[3]] - points[face[0]]) > 0.0f;
+				addFace(face[0], flip ? face[2] : face[1], flip ? face[1] : face[2]);
+			}
+
+			uint32 closest = 0;
+
+			for (uint32 iteration = 0; iteration < MAX_ITERATIONS; ++iteration) {
+				closest = 0;
+				for (uint32 f = 1; f < faceCount; ++f) { if (faces[f].Distance < faces[closest].Distance) { closest = f; } }
+
+				Vector3 point, supportA, supportB; detail::supportOf(objectA, objectB, faces[closest].Normal, point, supportA, supportB);
+				if (Math::DotProduct(point, faces[closest].Normal) - faces[closest].Distance < tolerance) { break; }
+
+				const uint8 vertex = addVertex(point, supportA, supportB);
+				edgeCount = 0;
+
+				for (uint32 f = faceCount; f-- > 0;) { // remove every face the new vertex sees, collecting the horizon's edges
+					if (Math::DotProduct(faces[f].Normal, point - points[faces[f].Vertices[0]]) > 0.0f) {
+						addEdge(faces[f].Vertices[0], faces[f].Vertices[1]); addEdge(faces[f].Vertices[1], faces[f].Vertices[2]); addEdge(faces[f].Vertices[2], faces[f].Vertices[0]);
+						faces[f] = faces[--faceCount];
+					}
+				}
+
+				for (uint32 e = 0; e < edgeCount; ++e) {
+					const uint8 a = edges[e][0], b = edges[e][1];
+					if (edgeMatrix[a] & (1ull << b)) { edgeMatrix[a] &= ~(1ull << b); if (faceCount < MAX_FACES) { addFace(a, b, vertex); } }
+				}
+
+				if (vertexCount == MAX_VERTICES || faceCount + 2 > MAX_FACES) { break; }
+			}
+
+			closest = 0;
+			for (uint32 f = 1; f < faceCount; ++f) { if (faces[f].Distance < faces[closest].Distance) { closest = f; } }
+
+			const auto& face = faces[closest];
+			normal = face.Normal;
+
+			const auto a = points[face.Vertices[0]], b = points[face.Vertices[1]], c = points[face.Vertices[2]];
+			const auto projection = face.Normal * face.Distance; // origin projected onto the face, as barycentric coordinates
+			const auto v0 = b - a, v1 = c - a, v2 = projection - a;
+			const float32 d00 = Math::DotProduct(v0, v0), d01 = Math::DotProduct(v0, v1), d11 = Math::DotProduct(v1, v1), d20 = Math::DotProduct(v2, v0), d21 = Math::DotProduct(v2, v1);
+			const float32 denominator = d00 * d11 - d01 * d01;
+			const float32 v = denominator != 0.0f ? (d11 * d20 - d01 * d21) / denominator : 0.0f, w = denominator != 0.0f ? (d00 * d21 - d01 * d20) / denominator : 0.0f, u = 1.0f - v - w;
+
+			contact.PositionA = supportsA[face.Vertices[0]] * u + supportsA[face.Vertices[1]] * v + supportsA[face.Vertices[2]] * w;
+			contact.PositionB = supportsB[face.Vertices[0]] * u + supportsB[face.Vertices[1]] * v + supportsB[face.Vertices[2]] * w;
+			contact.Depth = face.Distance;
+
+			return true;
+		}
+
+	private:
+		struct polytopeFace {
+			Vector3 Normal; float32 Distance; uint8 Vertices[3];
+		};
+
+		Vector3 points[MAX_VERTICES], supportsA[MAX_VERTICES], supportsB[MAX_VERTICES];
+		polytopeFace faces[MAX_FACES];
+		uint8 edges[MAX_FACES * 3][2];
+		uint64 edgeMatrix[MAX_VERTICES]{}; // bit b of row a is set while edge a -> b is on the horizon
+		uint32 vertexCount = 0, faceCount = 0, edgeCount = 0;
+
+		uint8 addVertex(const Vector3 point, const Vector3 supportA, const Vector3 supportB) {
+			points[vertexCount] = point; supportsA[vertexCount] = supportA; supportsB[vertexCount] = supportB;
+			return static_cast<uint8>(vertexCount++);
+		}
+
+		void addFace(const uint8 a, const uint8 b, const uint8 c) {
+			auto& face = faces[faceCount++];
+			face.Vertices[0] = a; face.Vertices[1] = b; face.Vertices[2] = c;
+
+			const auto normal = Math::Cross(points[b] - points[a], points[c] - points[a]);
+			if (Math::LengthSquared(normal) > 1e-20f) {
+				face.Normal = detail::normalizedDirection(normal); face.Distance = Math::DotProduct(face.Normal, points[a]);
+			} else { // degenerate sliver, never pick it
+				face.Normal = Vector3(0.0f); face.Distance = std::numeric_limits<float32>::max();
+			}
+		}
+
+		/**
+		 * \brief Toggles an edge, an edge shared by two removed faces shows up once in each direction and cancels out.
+		 */
+		void addEdge(const uint8 a, const uint8 b) {
+			if (edgeMatrix[b] & (1ull << a)) { edgeMatrix[b] &= ~(1ull << a); return; }
+			edgeMatrix[a] |= 1ull << b; edges[edgeCount][0] = a; edges[edgeCount][1] = b; ++edgeCount;
+		}
+
+		/**
+		 * \brief Grows a touching contact's point, segment or triangle simplex into a tetrahedron by searching along directions it doesn't span.
+		 */
+		bool completeTetrahedron(auto& objectA, auto& objectB, const float32 tolerance) {
+			const Vector3 AXES[6] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+			auto tryAdd = [&](const Vector3 direction, auto&& isNew) {
+				Vector3 point, supportA, supportB; detail::supportOf(objectA, objectB, direction, point, supportA, supportB);
+				if (!isNew(point)) { return false; }
+				addVertex(point, supportA, supportB); return true;
+			};
+
+			if (vertexCount == 1) {
+				for (const auto& axis : AXES) { if (tryAdd(axis, [&](const Vector3 p) { return Math::DistanceSquared(p, points[0]) > tolerance * tolerance; })) { break; } }
+			}
+
+			if (vertexCount == 2) {
+				const auto segment = points[1] - points[0];
+				for (const auto& axis : AXES) {
+					const auto perpendicular = Math::Cross(segment, axis);
+					if (Math::LengthSquared(perpendicular) > 0.0f && tryAdd(perpendicular, [&](const Vector3 p) { return Math::LengthSquared(Math::Cross(p - points[0], segment)) > tolerance * tolerance * Math::LengthSquared(segment); })) { break; }
+				}
+			}
+
+			if (vertexCount == 3) {
+				const auto normal = detail::normalizedDirection(Math::Cross(points[1] - points[0], points[2] - points[0]));
+				auto offPlane = [&](const Vector3 p) { return Math::Abs(Math::DotProduct(p - points[0], normal)) > tolerance; };
+				if (!tryAdd(normal, offPlane)) { tryAdd(-normal, offPlane); }
+			}
+
+			return vertexCount == 4;
+		}
+	};
+
+	/**
+	 * \brief Runs warm started GJK and EPA on a pair and updates it's persistent manifold.
+	 * \param manifold Manifold of the pair from the previous frame, it's points are moved with the objects, stale ones dropped and the new contact added.
+	 * \param scratch Scratch space for EPA.
+	 * \param breakingDistance Distance objects can separate or slide before a manifold point is dropped, also the distance under which points are merged.
+	 * \return Whether the objects intersect. Non intersecting pairs get an empty manifold but keep their GJK cache.
+	 */
+	inline bool Collide(auto& objectA, auto& objectB, ContactManifold& manifold, CollisionScratch& scratch, const float32 breakingDistance = 0.02f) {
+		GJKSimplex simplex;
+		Vector3 normal; ContactPoint contact;
+
+		if (!GJK(objectA, objectB, manifold.Cache, simplex) || !scratch.EPA(objectA, objectB, simplex, normal, contact)) { manifold.PointCount = 0; return false; }
+
+		const Vector3 positionA = objectA.GetPosition(), positionB = objectB.GetPosition();
+		contact.LocalA = contact.PositionA - positionA; contact.LocalB = contact.PositionB - positionB;
+
+		if (Math::DotProduct(manifold.Normal, normal) < 0.95f) { manifold.PointCount = 0; } // normal changed too much for old points to be meaningful
+		manifold.Normal = normal;
+		manifold.Refresh(positionA, positionB, breakingDistance);
+		manifold.AddPoint(contact, breakingDistance);
+
+		return true;
+	}
+
+	/**
+	 * \brief Runs Collide on a batch of pairs.
+	 * \param pairs Indices of the objects of every pair.
+	 * \param getObject Called as getObject(uint32 index), must return a reference to the object.
+	 * \param manifolds Persistent manifold of every pair.
+	 * \return Number of intersecting pairs.
+	 */
+	inline uint32 Collide(const Range<const Pair<uint32, uint32>*> pairs, auto&& getObject, Range<ContactManifold*> manifolds, CollisionScratch& scratch, const float32 breakingDistance = 0.02f) {
+		uint32 count = 0;
+
+		for (uint32 i = 0; i < pairs.ElementCount(); ++i) {
+			count += Collide(getObject(pairs[i].First), getObject(pairs[i].Second), manifolds[i], scratch, breakingDistance);
+		}
+
+		return count;
+	}
+
+GTSL_BEGIN_AVX2_FUNCTIONS
+
+	/**
+	 * \brief Evaluates test over every element, 8 at a time, and hands the resulting bit mask of every batch to write along with the index of it's first element.
+	 * The last batch is zero padded and it's bits past the end of the range are cleared.
+	 */
+	template<typename... TYPES>
+	void cullBatch(MultiRange<TYPES...> elements, auto&& test, auto&& write) {
+		constexpr uint32 N = sizeof...(TYPES);
+
+		uint32 i = 0;
+
+		for (; i + float8x::ElementCount <= elements.GetLength(); i += float8x::ElementCount) {
+			float8x v[N];
+			[&]<uint64... C>(Indices<C...>) { ((v[C] = UnalignedPointer<const float32>(elements.template GetPointer<C>(i))), ...); }(BuildIndices<N>{});
+			write(i, test(v).BitMask());
+		}
+
+		if (i < elements.GetLength()) {
+			const uint32 remaining = elements.GetLength() - i;
+			alignas(32) float32 tail[N][8]{};
+			float8x v[N];
+
+			for (uint32 j = 0; j < remaining; ++j) {
+				[&]<uint64... C>(Indices<C...>) { ((tail[C][j] = elements.template Get<C>(i + j)), ...); }(BuildIndices<N>{});
+			}
+
+			for (uint32 c = 0; c < N; ++c) { v[c] = AlignedPointer<const float32, 32>(tail[c]); }
+			write(i, static_cast<uint8>(test(v).BitMask() & ((1u << remaining) - 1)));
+		}
+	}
+
+	template<typename... TYPES>
+	uint32 cullToIndices(MultiRange<TYPES...> elements, auto&& test, uint32* __restrict indices) {
+		uint32 count = 0;
+
+		cullBatch(elements, test, [&](const uint32 base, uint8 bits) {
+			while (bits) {
+				indices[count++] = base + FindFirstSetBit(static_cast<uint32>(bits)).Get();
+				bits &= bits - 1;
+			}
+		});
+
+		return count;
+	}
+
+	template<typename... TYPES>
+	void cullToMask(MultiRange<TYPES...> elements, auto&& test, uint8* __restrict mask) {
+		cullBatch(elements, test, [&](const uint32 base, const uint8 bits) { mask[base / 8] = bits; });
+	}
+
+	/**
+	 * \brief Frustum planes broadcast for 8 wide tests, absolute normals are precomputed to project box extents.
+	 */
+	struct frustumPlanes {
+		explicit frustumPlanes(const Frustum& frustum) {
+			for (uint32 p = 0; p < 6; ++p) {
+				const auto& plane = frustum.GetPlanes()[p];
+				X[p] = float8x(plane.Normal.X()); Y[p] = float8x(plane.Normal.Y()); Z[p] = float8x(plane.Normal.Z()); D[p] = float8x(plane.D);
+				AbsX[p] = float8x::Abs(X[p]); AbsY[p] = float8x::Abs(Y[p]); AbsZ[p] = float8x::Abs(Z[p]);
+			}
+		}
+
+		float8x X[6], Y[6], Z[6], D[6], AbsX[6], AbsY[6], AbsZ[6];
+	};
+
+	inline auto sphereCullTest(const frustumPlanes& planes) {
+		return [&planes](const float8x (&s)[4]) { // dot(N, c) - D >= -r for every plane
+			auto visible = float8x::MultiplyAdd(planes.X[0], s[0], float8x::MultiplyAdd(planes.Y[0], s[1], float8x::MultiplyAdd(planes.Z[0], s[2], s[3] - planes.D[0]))) >= float8x(0.0f);
+			for (uint32 p = 1; p < 6; ++p) {
+				visible = visible & (float8x::MultiplyAdd(planes.X[p], s[0], float8x::MultiplyAdd(planes.Y[p], s[1], float8x::MultiplyAdd(planes.Z[p], s[2], s[3] - planes.D[p]))) >= float8x(0.0f));
+			}
+			return visible;
+		};
+	}
+
+	inline auto boxCullTest(const frustumPlanes& planes) {
+		return [&planes](const float8x (&b)[6]) { // dot(N, c) - D >= -dot(|N|, e) for every plane
+			auto radius = float8x::MultiplyAdd(planes.AbsX[0], b[3], float8x::MultiplyAdd(planes.AbsY[0], b[4], planes.AbsZ[0] * b[5]));
+			auto visible = float8x::MultiplyAdd(planes.X[0], b[0], float8x::MultiplyAdd(planes.Y[0], b[1], float8x::MultiplyAdd(planes.Z[0], b[2], radius - planes.D[0]))) >= float8x(0.0f);
+			for (uint32 p = 1; p < 6; ++p) {
+				radius = float8x::MultiplyAdd(planes.AbsX[p], b[3], float8x::MultiplyAdd(planes.AbsY[p], b[4], planes.AbsZ[p] * b[5]));
+				visible = visible & (float8x::MultiplyAdd(planes.X[p], b[0], float8x::MultiplyAdd(planes.Y[p], b[1], float8x::MultiplyAdd(planes.Z[p], b[2], radius - planes.D[p]))) >= float8x(0.0f));
+			}
+			return visible;
+		};
+	}
+
+	inline auto boxOverlapTest(const Vector3 center, const Vector3 extents) {
+		return [cx = float8x(center.X()), cy = float8x(center.Y()), cz = float8x(center.Z()), ex = float8x(extents.X()), ey = float8x(extents.Y()), ez = float8x(extents.Z())](const float8x (&b)[6]) { // |ca - cb| <= ea + eb on every axis
+			return (float8x::Abs(b[0] - cx) <= b[3] + ex) & (float8x::Abs(b[1] - cy) <= b[4] + ey) & (float8x::Abs(b[2] - cz) <= b[5] + ez);
+		};
+	}
+
+	inline uint32 cullSpheresAVX2(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint32* __restrict visibleIndices) {
+		const frustumPlanes planes(frustum);
+		return cullToIndices(spheres, sphereCullTest(planes), visibleIndices);
+	}
+
+	inline void cullSpheresAVX2(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint8* __restrict visibilityMask) {
+		const frustumPlanes planes(frustum);
+		cullToMask(spheres, sphereCullTest(planes), visibilityMask);
+	}
+
+	inline uint32 cullAABBsAVX2(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict visibleIndices) {
+		const frustumPlanes planes(frustum);
+		return cullToIndices(boxes, boxCullTest(planes), visibleIndices);
+	}
+
+	inline void cullAABBsAVX2(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict visibilityMask) {
+		const frustumPlanes planes(frustum);
+		cullToMask(boxes, boxCullTest(planes), visibilityMask);
+	}
+
+	inline uint32 overlapAABBsAVX2(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict overlappingIndices) {
+		return cullToIndices(boxes, boxOverlapTest(center, extents), overlappingIndices);
+	}
+
+	inline void overlapAABBsAVX2(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict overlapMask) {
+		cullToMask(boxes, boxOverlapTest(center, extents), overlapMask);
+	}
+
+GTSL_END_TARGET_FUNCTIONS
+
+	/**
+	 * \brief Scalar counterpart of cullBatch, for CPUs without AVX2. Evaluates test one element at a time and hands write the same 8 bit masks.
+	 */
+	template<typename... TYPES>
+	void cullBatchScalar(MultiRange<TYPES...> elements, auto&& test, auto&& write) {
+		constexpr uint32 N = sizeof...(TYPES);
+
+		for (uint32 i = 0; i < elements.GetLength(); i += 8) {
+			uint8 bits = 0;
+
+			for (uint32 j = 0; j < 8 && i + j < elements.GetLength(); ++j) {
+				float32 v[N];
+				[&]<uint64... C>(Indices<C...>) { ((v[C] = elements.template Get<C>(i + j)), ...); }(BuildIndices<N>{});
+				bits |= static_cast<uint8>(test(v)) << j;
+			}
+
+			write(i, bits);
+		}
+	}
+
+	template<typename... TYPES>
+	uint32 cullToIndicesScalar(MultiRange<TYPES...> elements, auto&& test, uint32* __restrict indices) {
+		uint32 count = 0;
+		cullBatchScalar(elements, test, [&](const uint32 base, const uint8 bits) { for (uint32 j = 0; j < 8; ++j) { if (bits & (1u << j)) { indices[count++] = base + j; } } });
+		return count;
+	}
+
+	template<typename... TYPES>
+	void cullToMaskScalar(MultiRange<TYPES...> elements, auto&& test, uint8* __restrict mask) {
+		cullBatchScalar(elements, test, [&](const uint32 base, const uint8 bits) { mask[base / 8] = bits; });
+	}
+
+	inline auto sphereCullTestScalar(const Frustum& frustum) {
+		return [&frustum](const float32 (&s)[4]) {
+			for (uint32 p = 0; p < 6; ++p) {
+				const auto& plane = frustum.GetPlanes()[p];
+				if (plane.Normal.X() * s[0] + (plane.Normal.Y() * s[1] + (plane.Normal.Z() * s[2] + (s[3] - plane.D))) < 0.0f) { return false; }
+			}
+			return true;
+		};
+	}
+
+	inline auto boxCullTestScalar(const Frustum& frustum) {
+		return [&frustum](const float32 (&b)[6]) {
+			for (uint32 p = 0; p < 6; ++p) {
+				const auto& plane = frustum.GetPlanes()[p];
+				const auto radius = Math::Abs(plane.Normal.X()) * b[3] + (Math::Abs(plane.Normal.Y()) * b[4] + Math::Abs(plane.Normal.Z()) * b[5]);
+				if (plane.Normal.X() * b[0] + (plane.Normal.Y() * b[1] + (plane.Normal.Z() * b[2] + (radius - plane.D))) < 0.0f) { return false; }
+			}
+			return true;
+		};
+	}
+
+	inline auto boxOverlapTestScalar(const Vector3 center, const Vector3 extents) {
+		return [center, extents](const float32 (&b)[6]) {
+			return Math::Abs(b[0] - center.X()) <= b[3] + extents.X() && Math::Abs(b[1] - center.Y()) <= b[4] + extents.Y() && Math::Abs(b[2] - center.Z()) <= b[5] + extents.Z();
+		};
+	}
+
+	inline uint32 cullSpheresScalar(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint32* __restrict visibleIndices) {
+		return cullToIndicesScalar(spheres, sphereCullTestScalar(frustum), visibleIndices);
+	}
+
+	inline void cullSpheresScalar(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint8* __restrict visibilityMask) {
+		cullToMaskScalar(spheres, sphereCullTestScalar(frustum), visibilityMask);
+	}
+
+	inline uint32 cullAABBsScalar(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict visibleIndices) {
+		return cullToIndicesScalar(boxes, boxCullTestScalar(frustum), visibleIndices);
+	}
+
+	inline void cullAABBsScalar(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict visibilityMask) {
+		cullToMaskScalar(boxes, boxCullTestScalar(frustum), visibilityMask);
+	}
+
+	inline uint32 overlapAABBsScalar(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict overlappingIndices) {
+		return cullToIndicesScalar(boxes, boxOverlapTestScalar(center, extents), overlappingIndices);
+	}
+
+	inline void overlapAABBsScalar(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict overlapMask) {
+		cullToMaskScalar(boxes, boxOverlapTestScalar(center, extents), overlapMask);
+	}
+
+	/**
+	 * \brief Tests every sphere against frustum, 8 at a time where AVX2 is available. Plane normals must point towards the inside of the frustum, a point p is inside a plane when dot(Normal, p) - D >= 0.
+	 * A sphere is culled only if it lies completely outside some plane, so spheres near the frustum's corners may be reported as visible.
+	 * \param frustum Frustum to test against.
+	 * \param spheres X, Y, Z components of the sphere centers and radius of every sphere.
+	 * \param visibleIndices Receives the indices of the spheres which were not culled, packed in increasing order. Must have space for every sphere.
+	 * \return Number of visible spheres.
+	 */
+	inline uint32 CullSpheres(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint32* __restrict visibleIndices) {
+		static const Dispatcher<uint32(const Frustum&, MultiRange<const float32, const float32, const float32, const float32>, uint32*)> cullSpheres(cullSpheresScalar, nullptr, cullSpheresAVX2, nullptr);
+		return cullSpheres(frustum, spheres, visibleIndices);
+	}
+
+	/**
+	 * \brief Tests every sphere against frustum, 8 at a time where AVX2 is available, writing a visibility bit per sphere.
+	 * \param visibilityMask Receives a bit per sphere, set if visible, sphere i maps to bit i % 8 of byte i / 8. Must be (spheres + 7) / 8 bytes long, bits past the last sphere are cleared.
+	 */
+	inline void CullSpheres(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32> spheres, uint8* __restrict visibilityMask) {
+		static const Dispatcher<void(const Frustum&, MultiRange<const float32, const float32, const float32, const float32>, uint8*)> cullSpheres(cullSpheresScalar, nullptr, cullSpheresAVX2, nullptr);
+		cullSpheres(frustum, spheres, visibilityMask);
+	}
+
+	/**
+	 * \brief Tests every axis aligned box against frustum, 8 at a time where AVX2 is available. Plane normals must point towards the inside of the frustum, a point p is inside a plane when dot(Normal, p) - D >= 0.
+	 * A box is culled only if it lies completely outside some plane, so boxes near the frustum's corners may be reported as visible.
+	 * \param frustum Frustum to test against.
+	 * \param boxes X, Y, Z components of the box centers followed by X, Y, Z half extents of every box.
+	 * \param visibleIndices Receives the indices of the boxes which were not culled, packed in increasing order. Must have space for every box.
+	 * \return Number of visible boxes.
+	 */
+	inline uint32 CullAABBs(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict visibleIndices) {
+		static const Dispatcher<uint32(const Frustum&, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32>, uint32*)> cullAABBs(cullAABBsScalar, nullptr, cullAABBsAVX2, nullptr);
+		return cullAABBs(frustum, boxes, visibleIndices);
+	}
+
+	/**
+	 * \brief Tests every axis aligned box against frustum, 8 at a time where AVX2 is available, writing a visibility bit per box.
+	 * \param visibilityMask Receives a bit per box, set if visible, box i maps to bit i % 8 of byte i / 8. Must be (boxes + 7) / 8 bytes long, bits past the last box are cleared.
+	 */
+	inline void CullAABBs(const Frustum& frustum, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict visibilityMask) {
+		static const Dispatcher<void(const Frustum&, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32>, uint8*)> cullAABBs(cullAABBsScalar, nullptr, cullAABBsAVX2, nullptr);
+		cullAABBs(frustum, boxes, visibilityMask);
+	}
+
+	/**
+	 * \brief Tests one axis aligned box for overlap against every box in boxes, 8 at a time where AVX2 is available. Touching boxes are considered overlapping.
+	 * \param center Center of the query box.
+	 * \param extents Half extents of the query box.
+	 * \param boxes X, Y, Z components of the box centers followed by X, Y, Z half extents of every box.
+	 * \param overlappingIndices Receives the indices of the overlapping boxes, packed in increasing order. Must have space for every box.
+	 * \return Number of overlapping boxes.
+	 */
+	inline uint32 OverlapAABBs(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint32* __restrict overlappingIndices) {
+		static const Dispatcher<uint32(Vector3, Vector3, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32>, uint32*)> overlapAABBs(overlapAABBsScalar, nullptr, overlapAABBsAVX2, nullptr);
+		return overlapAABBs(center, extents, boxes, overlappingIndices);
+	}
+
+	/**
+	 * \brief Tests one axis aligned box for overlap against every box in boxes, 8 at a time where AVX2 is available, writing an overlap bit per box.
+	 * \param overlapMask Receives a bit per box, set if overlapping, box i maps to bit i % 8 of byte i / 8. Must be (boxes + 7) / 8 bytes long, bits past the last box are cleared.
+	 */
+	inline void OverlapAABBs(const Vector3 center, const Vector3 extents, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32> boxes, uint8* __restrict overlapMask) {
+		static const Dispatcher<void(Vector3, Vector3, MultiRange<const float32, const float32, const float32, const float32, const float32, const float32>, uint8*)> overlapAABBs(overlapAABBsScalar, nullptr, overlapAABBsAVX2, nullptr);
+		overlapAABBs(center, extents, boxes, overlapMask);
+	}
+
+}
@@ -26,5 +26,6 @@ namespace GTSL
 		[[nodiscard]] Plane& GetBackPlane() { return Planes[5]; }
 
 		[[nodiscard]] Plane* GetPlanes() { return Planes; }
+		[[nodiscard]] const Plane* GetPlanes() const { return Planes; }
 	};
 }
\ No newline at end of file
@@ -11,8 +11,10 @@
 #include "GTSL/Range.hpp"
 #include <GTSL/Extent.h>
 
+#include "GTSL/Dispatch.hpp"
 #include "GTSL/SIMD.hpp"
 
+#include <bit>
 #include <cmath>
 
 namespace GTSL {
@@ -114,29 +116,64 @@ namespace GTSL {
 			int64 operator()(const int64 min, const int64 max) {
 				return (*this)() % (max - min + 1) + min;
 			}
+
+			/**
+			 * \brief Returns a float uniformly distributed in [min, max), with 24 bits of randomness.
+			 */
+			float32 Float32(const float32 min, const float32 max) {
+				return min + (max - min) * static_cast<float32>(static_cast<uint64>((*this)()) >> 40) * (1.0f / 16777216.0f);
+			}
 		};
 
+		/**
+		 * \brief IEEE 754 binary16 float. Conversions round to nearest even and handle subnormals, infinities and NaNs, matching F16C.
+		 * See Math::ToHalf/FromHalf in Quantization.hpp for converting arrays.
+		 */
 		struct float16
 		{
-			explicit float16(const float32 a) : float16(*((uint32*)&a))
-			{
-			}
+			float16() = default;
 
-			explicit operator float32() const
-			{
-				//auto tt = (Sign << 16) | ((Exponent + 0x1C000) << 13) | (Fraction << 13);
-				auto tt = ((halfFloat & 0x8000) << 16) | (((halfFloat & 0x7c00) + 0x1C000) << 13) | ((halfFloat & 0x03FF) << 13);
-				return *reinterpret_cast<float32*>(&tt);
-			}
-			
-			//uint16 Sign : 1, Exponent : 5, Fraction : 10;
-			uint16 halfFloat;
+			explicit float16(const float32 a) : halfFloat(fromFloat32(std::bit_cast<uint32>(a))) {}
+
+			explicit operator float32() const { return std::bit_cast<float32>(toFloat32(halfFloat)); }
+
+			static float16 FromBits(const uint16 bits) { float16 result; result.halfFloat = bits; return result; }
+
+			bool operator==(const float16& other) const { return halfFloat == other.halfFloat; }
+
+			uint16 halfFloat = 0;
 		private:
-			//float16(const uint32 x) : Sign((x >> 16) & 0x8000), Exponent((((x & 0x7f800000) - 0x38000000) >> 13) & 0x7c00), Fraction((x >> 13) & 0x03ff)
-			//{}
+			// F. Giesen, "float->half variants"
+			static uint16 fromFloat32(uint32 x) {
+				const uint32 sign = (x >> 16) & 0x8000; x &= 0x7FFFFFFF;
+
+				if (x >= 0x47800000) { // at least 2^16, infinity, or NaN which is kept quiet along with the top of it's payload
+					return static_cast<uint16>(sign | (x > 0x7F800000 ? 0x7E00 | ((x >> 13) & 0x03FF) : 0x7C00));
+				}
+
+				if (x < 0x38800000) { // below 2^-14, subnormal or zero. Adding 0.5 aligns the mantissa so the FPU does the rounding
+					return static_cast<uint16>(sign | (std::bit_cast<uint32>(std::bit_cast<float32>(x) + 0.5f) - 0x3F000000));
+				}
+
+				x += (static_cast<uint32>(15 - 127) << 23) + 0xFFF + ((x >> 13) & 1); // rebias the exponent and round to nearest even, mantissa overflow carries in to the exponent
+				return static_cast<uint16>(sign | (x >> 13));
+			}
 
-			float16(const uint32 x) : halfFloat(((x >> 16) & 0x8000) | ((((x & 0x7f800000) - 0x38000000) >> 13) & 0x7c00) | ((x >> 13) & 0x03ff))
-			{}
+			static uint32 toFloat32(const uint16 h) {
+				const uint32 sign = static_cast<uint32>(h & 0x8000) << 16;
+				uint32 x = static_cast<uint32>(h & 0x7FFF) << 13;
+				const uint32 exponent = x & 0x0F800000;
+
+				x += (127 - 15) << 23;
+
+				if (exponent == 0x0F800000) { // infinity or NaN
+					x += (128 - 16) << 23;
+				} else if (exponent == 0) { // subnormal, let the FPU renormalize it
+					x = std::bit_cast<uint32>(std::bit_cast<float32>(x + (1 << 23)) - std::bit_cast<float32>(113u << 23));
+				}
+
+				return x | sign;
+			}
 		};
 		
 		inline float32 Power(float32 a, const uint32 times) {
@@ -416,14 +453,14 @@ namespace GTSL {
 				a6(1.538730635926417598443354215485e-10f);
 
 			for (uint32 t = 0; t < n.ElementCount() / SIMD::ElementCount; ++t, i += SIMD::ElementCount) {
-				auto x = SIMD(AlignedPointer<const float32, 16>(n.begin() + i));
+				auto x = SIMD(UnalignedPointer<const float32>(n.begin() + i));
 
 				x = Wrap(x, SIMD(PI));
 
 				const SIMD x2 = x * x, x4 = x2 * x2, x8 = x4 * x4, x9 = x8 * x;
 				const auto a = x * (a0 + x2 * (a1 + x2 * (a2 + x2 * a3)));
 				const auto b = a4 + x2 * (a5 + x2 * a6);
-				(a + x9 * b).CopyTo(AlignedPointer<float32, 16>(results.begin() + i));
+				(a + x9 * b).CopyTo(UnalignedPointer<float32>(results.begin() + i));
 			}
 
 			for (; i < n.ElementCount(); ++i) {
@@ -443,7 +480,7 @@ namespace GTSL {
 				a6(1.538730635926417598443354215485e-10f);
 
 			for (uint32 t = 0; t < n.ElementCount() / SIMD::ElementCount; ++t, i += SIMD::ElementCount) {
-				Cosine(SIMD(n.begin() + i)).CopyTo(AlignedPointer<float32, 16>(results.begin() + i));
+				Cosine(SIMD(UnalignedPointer<const float32>(n.begin() + i))).CopyTo(UnalignedPointer<float32>(results.begin() + i));
 			}
 
 			for (; i < n.ElementCount(); ++i) {
@@ -457,7 +494,7 @@ namespace GTSL {
 			uint32 i = 0;
 
 			for (uint32 t = 0; t < n.ElementCount() / SIMD::ElementCount; ++t, i += SIMD::ElementCount) {
-				Tangent(SIMD(n.begin() + i)).CopyTo(AlignedPointer<float32, 16>(results.begin() + i));
+				Tangent(SIMD(UnalignedPointer<const float32>(n.begin() + i))).CopyTo(UnalignedPointer<float32>(results.begin() + i));
 			}
 
 			for (; i < n.ElementCount(); ++i) {
@@ -876,7 +913,10 @@ namespace GTSL {
 		}
 		
 		inline void AddRotation(Matrix3x4& matrix, const Quaternion quaternion) { matrix *= Matrix3x4(quaternion); }
-		inline void SetRotation(Matrix3x4& matrix, const Quaternion quaternion) { matrix *= Matrix3x4(quaternion); }
+		inline void SetRotation(Matrix3x4& matrix, const Quaternion quaternion) {
+			const Matrix3x4 rotation(quaternion);
+			for (uint8 r = 0; r < 3; ++r) { matrix[r][0] = rotation[r][0]; matrix[r][1] = rotation[r][1]; matrix[r][2] = rotation[r][2]; }
+		}
 		inline void AddRotation(Matrix4& matrix, const AxisAngle axisAngle) { matrix *= Matrix4(axisAngle); }
 		inline void SetRotation(Matrix4& matrix, const AxisAngle axisAngle) { matrix *= Matrix4(axisAngle); }
 		inline void AddRotation(Matrix4& matrix, const Rotator rotator) { matrix *= Matrix4(rotator); }
@@ -907,6 +947,7 @@ namespace GTSL {
 		inline void Rotate(Matrix4& matrix, const Quaternion& quaternion) { matrix *= Matrix4(quaternion); }
 
 		inline Vector3 GetTranslation(const Matrix4& matrix4) { return { matrix4[0][3], matrix4[1][3], matrix4[2][3] }; }
+		inline Vector3 GetTranslation(const Matrix3x4& matrix) { return { matrix[0][3], matrix[1][3], matrix[2][3] }; }
 		
 		//Returns point colinearity to a line defined by two points.
 		// +0 indicates point is to the right
@@ -1190,8 +1231,8 @@ namespace GTSL {
 			auto vec0 = float4x(matrix[0]); auto vec1 = float4x(matrix[1]);	auto vec2 = float4x(matrix[2]); auto vec3 = float4x(matrix[3]);
 
 			// sub matrices
-			auto A = float4x::Shuffle<0, 1, 0, 1>(vec0, vec1); auto B = float4x::Shuffle<2, 3, 2, 3>(vec1, vec0);
-			auto C = float4x::Shuffle<0, 1, 0, 1>(vec2, vec3); auto D = float4x::Shuffle<2, 3, 2, 3>(vec3, vec2);
+			auto A = float4x::Shuffle<0, 1, 0, 1>(vec0, vec1); auto B = float4x::Shuffle<2, 3, 2, 3>(vec0, vec1);
+			auto C = float4x::Shuffle<0, 1, 0, 1>(vec2, vec3); auto D = float4x::Shuffle<2, 3, 2, 3>(vec2, vec3);
 
 			// determinant as (|A| |B| |C| |DestructionTester|)
 			auto detSub=float4x::Shuffle<0, 2, 0, 2>(vec0, vec2) * float4x::Shuffle<1, 3, 1, 3>(vec1, vec3) - float4x::Shuffle<1, 3, 1, 3>(vec0, vec2) * float4x::Shuffle<0, 2, 0, 2>(vec1, vec3);
@@ -1252,10 +1293,55 @@ namespace GTSL {
 			return r;
 		}
 
-		inline void DotProduct(float32* __restrict dps, MultiRange<const float32, const float32> v0, MultiRange<const float32, const float32> v1) {
+		/**
+		 * \brief Inverts the affine transform held in the top 3 rows of a row major matrix, the implicit last row being 0 0 0 1. Handles any scale or shear.
+		 * The 3x3 part is inverted through the cross products of it's rows, r1 x r2, r2 x r0 and r0 x r1 are the columns of it's inverse scaled by the determinant,
+		 * and the translation becomes -inverse * translation.
+		 */
+		inline void affineInverse(const float32* row0, const float32* row1, const float32* row2, float32* result0, float32* result1, float32* result2) {
+			const auto r0 = float4x(AlignedPointer<const float32, 16>(row0)), r1 = float4x(AlignedPointer<const float32, 16>(row1)), r2 = float4x(AlignedPointer<const float32, 16>(row2));
+
+			auto cross = [](const float4x a, const float4x b) { // w ends up as a.w * b.w - a.w * b.w, exactly 0
+				return float4x::Shuffle<1, 2, 0, 3>(a) * float4x::Shuffle<2, 0, 1, 3>(b) - float4x::Shuffle<2, 0, 1, 3>(a) * float4x::Shuffle<1, 2, 0, 3>(b);
+			};
+
+			auto c0 = cross(r1, r2), c1 = cross(r2, r0), c2 = cross(r0, r1);
+			const auto inverseDeterminant = float4x(1.0f) / float4x::DotProduct(r0, c0);
+
+			auto translation = -float4x::MultiplyAdd(float4x::Shuffle<3, 3, 3, 3>(r2), c2, float4x::MultiplyAdd(float4x::Shuffle<3, 3, 3, 3>(r1), c1, float4x::Shuffle<3, 3, 3, 3>(r0) * c0));
+			float4x::Transpose(c0, c1, c2, translation); // translation now holds the w components, all 0
+
+			(c0 * inverseDeterminant).CopyTo(AlignedPointer<float32, 16>(result0));
+			(c1 * inverseDeterminant).CopyTo(AlignedPointer<float32, 16>(result1));
+			(c2 * inverseDeterminant).CopyTo(AlignedPointer<float32, 16>(result2));
+		}
+
+		/**
+		 * \brief Inverts a matrix whose last row is 0 0 0 1, such as any composition of translations, rotations and scales. About a third of the work of Inverse(const Matrix4&).
+		 */
+		inline Matrix4 AffineInverse(const Matrix4& matrix) {
+			Matrix4 result;
+			affineInverse(matrix[0], matrix[1], matrix[2], result[0], result[1], result[2]);
+			return result;
+		}
+
+		inline Matrix3x4 Inverse(const Matrix3x4& matrix) {
+			Matrix3x4 result;
+			affineInverse(matrix[0], matrix[1], matrix[2], result[0], result[1], result[2]);
+			return result;
+		}
+
+GTSL_BEGIN_AVX2_FUNCTIONS // only reached through the Dispatchers below, once the CPU is known to support AVX2
+
+		//Loads the same row of two matrices, a in the low 128 bit lane and b in the high one.
+		inline float8x loadRows(const float32* a, const float32* b) { return float8x(float4x(AlignedPointer<const float32, 16>(a)), float4x(AlignedPointer<const float32, 16>(b))); }
+
+		inline void storeRows(const float8x rows, float32* a, float32* b) { rows.GetLow().CopyTo(AlignedPointer<float32, 16>(a)); rows.GetHigh().CopyTo(AlignedPointer<float32, 16>(b)); }
+
+		inline void dotProductAVX2(float32* __restrict dps, MultiRange<const float32, const float32> v0, MultiRange<const float32, const float32> v1) {
 			uint32 i = 0;
 
-			for (; i < v0.GetLength() / SIMD<float32, 8>::ElementCount; i += SIMD<float32, 8>::ElementCount) {
+			for (; i + SIMD<float32, 8>::ElementCount <= v0.GetLength(); i += SIMD<float32, 8>::ElementCount) {
 				SIMD<float32, 8> x0Vec(v0.GetPointer<0>(i)), y0Vec(v0.GetPointer<1>(i));
 				SIMD<float32, 8> x1Vec(v1.GetPointer<0>(i)), y1Vec(v1.GetPointer<1>(i));
 
@@ -1267,12 +1353,12 @@ namespace GTSL {
 			}
 		}
 
-		inline void DotProduct(float32* __restrict dps, MultiRange<const float, const float> range, const Vector2 v1) {
+		inline void dotProductAVX2(float32* __restrict dps, MultiRange<const float, const float> range, const Vector2 v1) {
 			uint32 i = 0;
 
 			const SIMD<float32, 8> x1Vec(v1.X()), y1Vec(v1.Y());
 
-			for (; i < range.GetLength() / SIMD<float32, 8>::ElementCount; i += SIMD<float32, 8>::ElementCount) {
+			for (; i + SIMD<float32, 8>::ElementCount <= range.GetLength(); i += SIMD<float32, 8>::ElementCount) {
 				SIMD<float32, 8> x0Vec(range.GetPointer<0>(i)), y0Vec(range.GetPointer<1>(i));
 
 				(x0Vec * x1Vec + y0Vec * y1Vec).CopyTo(dps + i);
@@ -1283,10 +1369,10 @@ namespace GTSL {
 			}
 		}
 
-		inline void DotProduct(float32* __restrict dps, MultiRange<const float32, const float32, const float32> v0, MultiRange<const float32, const float32, const float32> v1) {
+		inline void dotProductAVX2(float32* __restrict dps, MultiRange<const float32, const float32, const float32> v0, MultiRange<const float32, const float32, const float32> v1) {
 			uint32 i = 0;
 
-			for(; i < v0.GetLength() / SIMD<float32, 8>::ElementCount; i += SIMD<float32, 8>::ElementCount) {
+			for(; i + SIMD<float32, 8>::ElementCount <= v0.GetLength(); i += SIMD<float32, 8>::ElementCount) {
 				SIMD<float32, 8> x0Vec(v0.GetPointer<0>(i)), y0Vec(v0.GetPointer<1>(i)), z0Vec(v0.GetPointer<2>(i));
 				SIMD<float32, 8> x1Vec(v1.GetPointer<0>(i)), y1Vec(v1.GetPointer<1>(i)), z1Vec(v1.GetPointer<2>(i));
 
@@ -1298,12 +1384,12 @@ namespace GTSL {
 			}
 		}
 
-		inline void DotProduct(float32* __restrict dps, MultiRange<const float, const float, const float> range, const Vector3 v1) {
+		inline void dotProductAVX2(float32* __restrict dps, MultiRange<const float, const float, const float> range, const Vector3 v1) {
 			uint32 i = 0;
 
 			const SIMD<float32, 8> x1Vec(v1.X()), y1Vec(v1.Y()), z1Vec(v1.Z());
 
-			for (; i < range.GetLength() / SIMD<float32, 8>::ElementCount; i += SIMD<float32, 8>::ElementCount) {
+			for (; i + SIMD<float32, 8>::ElementCount <= range.GetLength(); i += SIMD<float32, 8>::ElementCount) {
 				SIMD<float32, 8> x0Vec(range.GetPointer<0>(i)), y0Vec(range.GetPointer<1>(i)), z0Vec(range.GetPointer<2>(i));
 
 				(x0Vec * x1Vec + y0Vec * y1Vec + z0Vec * z1Vec).CopyTo(dps + i);
@@ -1313,6 +1399,546 @@ namespace GTSL {
 				dps[i] = range.Get<0>(i) * v1.X() + range.Get<1>(i) * v1.Y() + range.Get<2>(i) * v1.Z();
 			}
 		}
+
+		inline void transformPointsAVX2(MultiRange<float32, float32, float32> results, const Matrix4& matrix, MultiRange<const float32, const float32, const float32> points) {
+			const float8x m00(matrix[0][0]), m01(matrix[0][1]), m02(matrix[0][2]), m03(matrix[0][3]);
+			const float8x m10(matrix[1][0]), m11(matrix[1][1]), m12(matrix[1][2]), m13(matrix[1][3]);
+			const float8x m20(matrix[2][0]), m21(matrix[2][1]), m22(matrix[2][2]), m23(matrix[2][3]);
+
+			uint32 i = 0;
+
+			for (; i + float8x::ElementCount <= points.GetLength(); i += float8x::ElementCount) {
+				const float8x x(UnalignedPointer<const float32>(points.GetPointer<0>(i))), y(UnalignedPointer<const float32>(points.GetPointer<1>(i))), z(UnalignedPointer<const float32>(points.GetPointer<2>(i)));
+
+				const auto rx = float8x::MultiplyAdd(m00, x, float8x::MultiplyAdd(m01, y, float8x::MultiplyAdd(m02, z, m03)));
+				const auto ry = float8x::MultiplyAdd(m10, x, float8x::MultiplyAdd(m11, y, float8x::MultiplyAdd(m12, z, m13)));
+				const auto rz = float8x::MultiplyAdd(m20, x, float8x::MultiplyAdd(m21, y, float8x::MultiplyAdd(m22, z, m23)));
+
+				rx.CopyTo(UnalignedPointer<float32>(results.GetPointer<0>(i))); ry.CopyTo(UnalignedPointer<float32>(results.GetPointer<1>(i))); rz.CopyTo(UnalignedPointer<float32>(results.GetPointer<2>(i)));
+			}
+
+			for (; i < points.GetLength(); ++i) {
+				const auto point = matrix * Vector3(points.Get<0>(i), points.Get<1>(i), points.Get<2>(i));
+				*results.GetPointer<0>(i) = point.X(); *results.GetPointer<1>(i) = point.Y(); *results.GetPointer<2>(i) = point.Z();
+			}
+		}
+
+		inline void multiplyAVX2(Range<Matrix4*> results, Range<const Matrix4*> a, Range<const Matrix4*> b) {
+			GTSL_ASSERT(a.ElementCount() == b.ElementCount() && results.ElementCount() >= a.ElementCount(), "Ranges must have the same length.")
+
+			for (uint64 i = 0; i < a.ElementCount(); ++i) {
+				const float4x b0(AlignedPointer<const float32, 16>(b[i][0])), b1(AlignedPointer<const float32, 16>(b[i][1]));
+				const float4x b2(AlignedPointer<const float32, 16>(b[i][2])), b3(AlignedPointer<const float32, 16>(b[i][3]));
+				const float8x bb0(b0, b0), bb1(b1, b1), bb2(b2, b2), bb3(b3, b3);
+
+				for (uint32 r = 0; r < 4; r += 2) { // rows r and r + 1 are contiguous, each 128 bit lane holds one
+					const float8x rows(UnalignedPointer<const float32>(a[i][r]));
+
+					auto product = float8x::Shuffle<0, 0, 0, 0>(rows) * bb0;
+					product = float8x::MultiplyAdd(float8x::Shuffle<1, 1, 1, 1>(rows), bb1, product);
+					product = float8x::MultiplyAdd(float8x::Shuffle<2, 2, 2, 2>(rows), bb2, product);
+					product = float8x::MultiplyAdd(float8x::Shuffle<3, 3, 3, 3>(rows), bb3, product);
+
+					product.CopyTo(UnalignedPointer<float32>(results[i][r]));
+				}
+			}
+		}
+
+		inline void multiplyAVX2(Range<Matrix3x4*> results, Range<const Matrix3x4*> a, Range<const Matrix3x4*> b) {
+			GTSL_ASSERT(a.ElementCount() == b.ElementCount() && results.ElementCount() >= a.ElementCount(), "Ranges must have the same length.")
+
+			const float8x lastRow(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+			uint64 i = 0;
+
+			for (; i + 2 <= a.ElementCount(); i += 2) {
+				const auto b0 = loadRows(b[i][0], b[i + 1][0]), b1 = loadRows(b[i][1], b[i + 1][1]), b2 = loadRows(b[i][2], b[i + 1][2]);
+				float8x products[3];
+
+				for (uint32 r = 0; r < 3; ++r) {
+					const auto rows = loadRows(a[i][r], a[i + 1][r]);
+
+					auto product = rows * lastRow;
+					product = float8x::MultiplyAdd(float8x::Shuffle<0, 0, 0, 0>(rows), b0, product);
+					product = float8x::MultiplyAdd(float8x::Shuffle<1, 1, 1, 1>(rows), b1, product);
+					products[r] = float8x::MultiplyAdd(float8x::Shuffle<2, 2, 2, 2>(rows), b2, product);
+				}
+
+				for (uint32 r = 0; r < 3; ++r) { storeRows(products[r], results[i][r], results[i + 1][r]); }
+			}
+
+			for (; i < a.ElementCount(); ++i) { results[i] = a[i] * b[i]; }
+		}
+
+		inline void inverseAVX2(Range<Matrix4*> results, Range<const Matrix4*> matrices) {
+			GTSL_ASSERT(results.ElementCount() >= matrices.ElementCount(), "Ranges must have the same length.")
+
+			auto mat2Mul = [](const float8x a, const float8x b) { return float8x::MultiplyAdd(a, float8x::Shuffle<0, 3, 0, 3>(b), float8x::Shuffle<1, 0, 3, 2>(a) * float8x::Shuffle<2, 1, 2, 1>(b)); };
+			auto mat2AdjMul = [](const float8x a, const float8x b) { return float8x::Shuffle<3, 3, 0, 0>(a) * b - float8x::Shuffle<1, 1, 2, 2>(a) * float8x::Shuffle<2, 3, 0, 1>(b); };
+			auto mat2MulAdj = [](const float8x a, const float8x b) { return a * float8x::Shuffle<3, 0, 3, 0>(b) - float8x::Shuffle<1, 0, 3, 2>(a) * float8x::Shuffle<2, 1, 2, 1>(b); };
+
+			const float8x adjSignMask(1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f);
+
+			uint64 i = 0;
+
+			for (; i + 2 <= matrices.ElementCount(); i += 2) {
+				const auto vec0 = loadRows(matrices[i][0], matrices[i + 1][0]), vec1 = loadRows(matrices[i][1], matrices[i + 1][1]);
+				const auto vec2 = loadRows(matrices[i][2], matrices[i + 1][2]), vec3 = loadRows(matrices[i][3], matrices[i + 1][3]);
+
+				// 2x2 sub matrices, A B on top, C D below
+				const auto A = float8x::Shuffle<0, 1, 0, 1>(vec0, vec1), B = float8x::Shuffle<2, 3, 2, 3>(vec0, vec1);
+				const auto C = float8x::Shuffle<0, 1, 0, 1>(vec2, vec3), D = float8x::Shuffle<2, 3, 2, 3>(vec2, vec3);
+
+				const auto detSub = float8x::Shuffle<0, 2, 0, 2>(vec0, vec2) * float8x::Shuffle<1, 3, 1, 3>(vec1, vec3) - float8x::Shuffle<1, 3, 1, 3>(vec0, vec2) * float8x::Shuffle<0, 2, 0, 2>(vec1, vec3);
+				const auto detA = float8x::Shuffle<0, 0, 0, 0>(detSub), detB = float8x::Shuffle<1, 1, 1, 1>(detSub);
+				const auto detC = float8x::Shuffle<2, 2, 2, 2>(detSub), detD = float8x::Shuffle<3, 3, 3, 3>(detSub);
+
+				const auto D_C = mat2AdjMul(D, C), A_B = mat2AdjMul(A, B);
+				auto X_ = detD * A - mat2Mul(B, D_C), W_ = detA * D - mat2Mul(C, A_B);
+				auto Y_ = detB * C - mat2MulAdj(D, A_B), Z_ = detC * B - mat2MulAdj(A, D_C);
+
+				auto tr = A_B * float8x::Shuffle<0, 2, 1, 3>(D_C);
+				tr = float8x::HorizontalAdd(tr, tr); tr = float8x::HorizontalAdd(tr, tr);
+
+				const auto rDetM = adjSignMask / (detA * detD + detB * detC - tr);
+				X_ *= rDetM; Y_ *= rDetM; Z_ *= rDetM; W_ *= rDetM;
+
+				const auto row0 = float8x::Shuffle<3, 1, 3, 1>(X_, Y_), row1 = float8x::Shuffle<2, 0, 2, 0>(X_, Y_);
+				const auto row2 = float8x::Shuffle<3, 1, 3, 1>(Z_, W_), row3 = float8x::Shuffle<2, 0, 2, 0>(Z_, W_);
+
+				storeRows(row0, results[i][0], results[i + 1][0]); storeRows(row1, results[i][1], results[i + 1][1]);
+				storeRows(row2, results[i][2], results[i + 1][2]); storeRows(row3, results[i][3], results[i + 1][3]);
+			}
+
+			for (; i < matrices.ElementCount(); ++i) { results[i] = Inverse(matrices[i]); }
+		}
+
+		template<class M>
+		void affineInverseAVX2(Range<M*> results, Range<const M*> matrices) {
+			GTSL_ASSERT(results.ElementCount() >= matrices.ElementCount(), "Ranges must have the same length.")
+
+			auto cross = [](const float8x a, const float8x b) {
+				return float8x::Shuffle<1, 2, 0, 3>(a) * float8x::Shuffle<2, 0, 1, 3>(b) - float8x::Shuffle<2, 0, 1, 3>(a) * float8x::Shuffle<1, 2, 0, 3>(b);
+			};
+
+			uint64 i = 0;
+
+			for (; i + 2 <= matrices.ElementCount(); i += 2) {
+				const auto r0 = loadRows(matrices[i][0], matrices[i + 1][0]), r1 = loadRows(matrices[i][1], matrices[i + 1][1]), r2 = loadRows(matrices[i][2], matrices[i + 1][2]);
+
+				auto c0 = cross(r1, r2), c1 = cross(r2, r0), c2 = cross(r0, r1);
+				const auto inverseDeterminant = float8x(1.0f) / float8x::DotProduct(r0, c0);
+
+				auto translation = -float8x::MultiplyAdd(float8x::Shuffle<3, 3, 3, 3>(r2), c2, float8x::MultiplyAdd(float8x::Shuffle<3, 3, 3, 3>(r1), c1, float8x::Shuffle<3, 3, 3, 3>(r0) * c0));
+				float8x::Transpose(c0, c1, c2, translation);
+
+				storeRows(c0 * inverseDeterminant, results[i][0], results[i + 1][0]);
+				storeRows(c1 * inverseDeterminant, results[i][1], results[i + 1][1]);
+				storeRows(c2 * inverseDeterminant, results[i][2], results[i + 1][2]);
+			}
+
+			for (; i < matrices.ElementCount(); ++i) { affineInverse(matrices[i][0], matrices[i][1], matrices[i][2], results[i][0], results[i][1], results[i][2]); }
+
+			if constexpr (M::MATRIX_SIZE == 16) {
+				for (uint64 m = 0; m < matrices.ElementCount(); ++m) { results[m][3][0] = 0.0f; results[m][3][1] = 0.0f; results[m][3][2] = 0.0f; results[m][3][3] = 1.0f; }
+			}
+		}
+
+		inline void composeTransformsAVX2(Range<Matrix4*> results, MultiRange<const float32, const float32, const float32> positions, MultiRange<const float32, const float32, const float32, const float32> rotations, MultiRange<const float32, const float32, const float32> scales) {
+			GTSL_ASSERT(results.ElementCount() >= positions.GetLength() && rotations.GetLength() == positions.GetLength() && scales.GetLength() == positions.GetLength(), "Ranges must have the same length.")
+
+			const float8x one(1.0f);
+			const float4x lastRow(0.0f, 0.0f, 0.0f, 1.0f);
+
+			uint32 i = 0;
+
+			for (; i + float8x::ElementCount <= positions.GetLength(); i += float8x::ElementCount) {
+				const float8x qx(UnalignedPointer<const float32>(rotations.GetPointer<0>(i))), qy(UnalignedPointer<const float32>(rotations.GetPointer<1>(i)));
+				const float8x qz(UnalignedPointer<const float32>(rotations.GetPointer<2>(i))), qw(UnalignedPointer<const float32>(rotations.GetPointer<3>(i)));
+				const float8x sx(UnalignedPointer<const float32>(scales.GetPointer<0>(i))), sy(UnalignedPointer<const float32>(scales.GetPointer<1>(i))), sz(UnalignedPointer<const float32>(scales.GetPointer<2>(i)));
+
+				const auto x2 = qx + qx, y2 = qy + qy, z2 = qz + qz;
+				const auto xx = qx * x2, xy = qx * y2, xz = qx * z2, yy = qy * y2, yz = qy * z2, zz = qz * z2;
+				const auto wx = qw * x2, wy = qw * y2, wz = qw * z2;
+
+				// one row of 8 matrices per 4 consecutive elements, same layout as Matrix4(Quaternion) with the scale applied per column
+				alignas(32) float32 elements[12][8];
+				((one - (yy + zz)) * sx).CopyTo(AlignedPointer<float32, 32>(elements[0])); ((xy - wz) * sy).CopyTo(AlignedPointer<float32, 32>(elements[1]));
+				((xz + wy) * sz).CopyTo(AlignedPointer<float32, 32>(elements[2])); float8x(UnalignedPointer<const float32>(positions.GetPointer<0>(i))).CopyTo(AlignedPointer<float32, 32>(elements[3]));
+				((xy + wz) * sx).CopyTo(AlignedPointer<float32, 32>(elements[4])); ((one - (xx + zz)) * sy).CopyTo(AlignedPointer<float32, 32>(elements[5]));
+				((yz - wx) * sz).CopyTo(AlignedPointer<float32, 32>(elements[6])); float8x(UnalignedPointer<const float32>(positions.GetPointer<1>(i))).CopyTo(AlignedPointer<float32, 32>(elements[7]));
+				((xz - wy) * sx).CopyTo(AlignedPointer<float32, 32>(elements[8])); ((yz + wx) * sy).CopyTo(AlignedPointer<float32, 32>(elements[9]));
+				((one - (xx + yy)) * sz).CopyTo(AlignedPointer<float32, 32>(elements[10])); float8x(UnalignedPointer<const float32>(positions.GetPointer<2>(i))).CopyTo(AlignedPointer<float32, 32>(elements[11]));
+
+				for (uint32 half = 0; half < 8; half += 4) { // transpose every row of 4 matrices at a time
+					for (uint32 r = 0; r < 3; ++r) {
+						float4x c0(AlignedPointer<const float32, 16>(elements[r * 4 + 0] + half)), c1(AlignedPointer<const float32, 16>(elements[r * 4 + 1] + half));
+						float4x c2(AlignedPointer<const float32, 16>(elements[r * 4 + 2] + half)), c3(AlignedPointer<const float32, 16>(elements[r * 4 + 3] + half));
+						float4x::Transpose(c0, c1, c2, c3);
+						c0.CopyTo(AlignedPointer<float32, 16>(results[i + half + 0][r])); c1.CopyTo(AlignedPointer<float32, 16>(results[i + half + 1][r]));
+						c2.CopyTo(AlignedPointer<float32, 16>(results[i + half + 2][r])); c3.CopyTo(AlignedPointer<float32, 16>(results[i + half + 3][r]));
+					}
+
+					for (uint32 m = 0; m < 4; ++m) { lastRow.CopyTo(AlignedPointer<float32, 16>(results[i + half + m][3])); }
+				}
+			}
+
+			for (; i < positions.GetLength(); ++i) {
+				Matrix4 matrix(Quaternion(rotations.Get<0>(i), rotations.Get<1>(i), rotations.Get<2>(i), rotations.Get<3>(i)));
+
+				for (uint32 r = 0; r < 3; ++r) {
+					matrix[r][0] *= scales.Get<0>(i); matrix[r][1] *= scales.Get<1>(i); matrix[r][2] *= scales.Get<2>(i);
+				}
+
+				matrix[0][3] = positions.Get<0>(i); matrix[1][3] = positions.Get<1>(i); matrix[2][3] = positions.Get<2>(i);
+
+				results[i] = matrix;
+			}
+		}
+
+		inline void slerpAVX2(MultiRange<float32, float32, float32, float32> results, MultiRange<const float32, const float32, const float32, const float32> a, MultiRange<const float32, const float32, const float32, const float32> b, const float32 alpha) {
+			constexpr uint32 TERMS = 8;
+			constexpr float32 ONE_PLUS_MU = 1.90110745351730037f; // corrects the truncation error of the last term
+			constexpr float32 U[TERMS] = { 1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), ONE_PLUS_MU / (8 * 17) };
+			constexpr float32 V[TERMS] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, ONE_PLUS_MU * 8 / 17 };
+
+			const float32 t = alpha, d = 1.0f - alpha;
+
+			float8x tTerms[TERMS], dTerms[TERMS]; // alpha is shared by every pair, so these are the same for all of them
+			for (uint32 k = 0; k < TERMS; ++k) { tTerms[k] = U[k] * t * t - V[k]; dTerms[k] = U[k] * d * d - V[k]; }
+
+			const float8x one(1.0f), signBit(-0.0f), tt(t), dd(d);
+
+			auto slerp = [&](const float8x (&q0)[4], const float8x (&q1)[4], float8x (&r)[4]) {
+				const auto dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+				const auto sign = dot & signBit; // take the shortest path, b is negated when the dot product is negative
+				const auto xm1 = (dot ^ sign) - one;
+
+				auto cT = one, cD = one;
+				for (uint32 k = TERMS; k-- > 0;) {
+					cT = float8x::MultiplyAdd(tTerms[k] * xm1, cT, one);
+					cD = float8x::MultiplyAdd(dTerms[k] * xm1, cD, one);
+				}
+
+				cT = (cT * tt) ^ sign; cD = cD * dd;
+
+				for (uint32 c = 0; c < 4; ++c) { r[c] = float8x::MultiplyAdd(q0[c], cD, q1[c] * cT); }
+			};
+
+			uint32 i = 0;
+
+			for (; i + float8x::ElementCount <= a.GetLength(); i += float8x::ElementCount) {
+				const float8x q0[4]{ UnalignedPointer<const float32>(a.GetPointer<0>(i)), UnalignedPointer<const float32>(a.GetPointer<1>(i)), UnalignedPointer<const float32>(a.GetPointer<2>(i)), UnalignedPointer<const float32>(a.GetPointer<3>(i)) };
+				const float8x q1[4]{ UnalignedPointer<const float32>(b.GetPointer<0>(i)), UnalignedPointer<const float32>(b.GetPointer<1>(i)), UnalignedPointer<const float32>(b.GetPointer<2>(i)), UnalignedPointer<const float32>(b.GetPointer<3>(i)) };
+				float8x r[4];
+
+				slerp(q0, q1, r);
+
+				r[0].CopyTo(UnalignedPointer<float32>(results.GetPointer<0>(i))); r[1].CopyTo(UnalignedPointer<float32>(results.GetPointer<1>(i)));
+				r[2].CopyTo(UnalignedPointer<float32>(results.GetPointer<2>(i))); r[3].CopyTo(UnalignedPointer<float32>(results.GetPointer<3>(i)));
+			}
+
+			if (i < a.GetLength()) { // run the remaining pairs through the same path so results don't depend on their position
+				alignas(32) float32 tail[3][4][8]{};
+
+				for (uint32 j = 0; i + j < a.GetLength(); ++j) {
+					tail[0][0][j] = a.Get<0>(i + j); tail[0][1][j] = a.Get<1>(i + j); tail[0][2][j] = a.Get<2>(i + j); tail[0][3][j] = a.Get<3>(i + j);
+					tail[1][0][j] = b.Get<0>(i + j); tail[1][1][j] = b.Get<1>(i + j); tail[1][2][j] = b.Get<2>(i + j); tail[1][3][j] = b.Get<3>(i + j);
+				}
+
+				const float8x q0[4]{ AlignedPointer<const float32, 32>(tail[0][0]), AlignedPointer<const float32, 32>(tail[0][1]), AlignedPointer<const float32, 32>(tail[0][2]), AlignedPointer<const float32, 32>(tail[0][3]) };
+				const float8x q1[4]{ AlignedPointer<const float32, 32>(tail[1][0]), AlignedPointer<const float32, 32>(tail[1][1]), AlignedPointer<const float32, 32>(tail[1][2]), AlignedPointer<const float32, 32>(tail[1][3]) };
+				float8x r[4];
+
+				slerp(q0, q1, r);
+
+				for (uint32 c = 0; c < 4; ++c) { r[c].CopyTo(AlignedPointer<float32, 32>(tail[2][c])); }
+
+				for (uint32 j = 0; i + j < a.GetLength(); ++j) {
+					*results.GetPointer<0>(i + j) = tail[2][0][j]; *results.GetPointer<1>(i + j) = tail[2][1][j]; *results.GetPointer<2>(i + j) = tail[2][2][j]; *results.GetPointer<3>(i + j) = tail[2][3][j];
+				}
+			}
+		}
+
+		template<typename... TYPES>
+		void normalizeAVX2(MultiRange<TYPES...> vectors) {
+			constexpr uint32 N = sizeof...(TYPES);
+
+			auto normalize = [](float8x (&v)[N]) {
+				auto lengthSquared = v[0] * v[0];
+				for (uint32 c = 1; c < N; ++c) { lengthSquared = float8x::MultiplyAdd(v[c], v[c], lengthSquared); }
+				const auto inverseLength = (float8x(1.0f) / lengthSquared.SquareRoot()) & (lengthSquared > float8x(0.0f));
+				for (uint32 c = 0; c < N; ++c) { v[c] *= inverseLength; }
+			};
+
+			uint32 i = 0;
+
+			for (; i + float8x::ElementCount <= vectors.GetLength(); i += float8x::ElementCount) {
+				float8x v[N];
+				[&]<uint64... C>(Indices<C...>) { ((v[C] = UnalignedPointer<const float32>(vectors.template GetPointer<C>(i))), ...); }(BuildIndices<N>{});
+				normalize(v);
+				[&]<uint64... C>(Indices<C...>) { (v[C].CopyTo(UnalignedPointer<float32>(vectors.template GetPointer<C>(i))), ...); }(BuildIndices<N>{});
+			}
+
+			if (i < vectors.GetLength()) { // pad the remaining vectors so they go through the same, full precision, path
+				alignas(32) float32 tail[N][8]{};
+				float8x v[N];
+
+				for (uint32 j = 0; i + j < vectors.GetLength(); ++j) {
+					[&]<uint64... C>(Indices<C...>) { ((tail[C][j] = vectors.template Get<C>(i + j)), ...); }(BuildIndices<N>{});
+				}
+
+				for (uint32 c = 0; c < N; ++c) { v[c] = AlignedPointer<const float32, 32>(tail[c]); }
+				normalize(v);
+				for (uint32 c = 0; c < N; ++c) { v[c].CopyTo(AlignedPointer<float32, 32>(tail[c])); }
+
+				for (uint32 j = 0; i + j < vectors.GetLength(); ++j) {
+					[&]<uint64... C>(Indices<C...>) { ((*vectors.template GetPointer<C>(i + j) = tail[C][j]), ...); }(BuildIndices<N>{});
+				}
+			}
+		}
+
+GTSL_END_TARGET_FUNCTIONS
+
+		inline void dotProductScalar(float32* __restrict dps, MultiRange<const float32, const float32> v0, MultiRange<const float32, const float32> v1) {
+			for (uint32 i = 0; i < v0.GetLength(); ++i) { dps[i] = v0.Get<0>(i) * v1.Get<0>(i) + v0.Get<1>(i) * v1.Get<1>(i); }
+		}
+
+		inline void dotProductScalar(float32* __restrict dps, MultiRange<const float, const float> range, const Vector2 v1) {
+			for (uint32 i = 0; i < range.GetLength(); ++i) { dps[i] = range.Get<0>(i) * v1.X() + range.Get<1>(i) * v1.Y(); }
+		}
+
+		inline void dotProductScalar(float32* __restrict dps, MultiRange<const float32, const float32, const float32> v0, MultiRange<const float32, const float32, const float32> v1) {
+			for (uint32 i = 0; i < v0.GetLength(); ++i) { dps[i] = v0.Get<0>(i) * v1.Get<0>(i) + v0.Get<1>(i) * v1.Get<1>(i) + v0.Get<2>(i) * v1.Get<2>(i); }
+		}
+
+		inline void dotProductScalar(float32* __restrict dps, MultiRange<const float, const float, const float> range, const Vector3 v1) {
+			for (uint32 i = 0; i < range.GetLength(); ++i) { dps[i] = range.Get<0>(i) * v1.X() + range.Get<1>(i) * v1.Y() + range.Get<2>(i) * v1.Z(); }
+		}
+
+		inline void transformPointsScalar(MultiRange<float32, float32, float32> results, const Matrix4& matrix, MultiRange<const float32, const float32, const float32> points) {
+			for (uint32 i = 0; i < points.GetLength(); ++i) {
+				const auto point = matrix * Vector3(points.Get<0>(i), points.Get<1>(i), points.Get<2>(i));
+				*results.GetPointer<0>(i) = point.X(); *results.GetPointer<1>(i) = point.Y(); *results.GetPointer<2>(i) = point.Z();
+			}
+		}
+
+		inline void multiplyScalar(Range<Matrix4*> results, Range<const Matrix4*> a, Range<const Matrix4*> b) {
+			GTSL_ASSERT(a.ElementCount() == b.ElementCount() && results.ElementCount() >= a.ElementCount(), "Ranges must have the same length.")
+			for (uint64 i = 0; i < a.ElementCount(); ++i) { results[i] = a[i] * b[i]; }
+		}
+
+		inline void multiplyScalar(Range<Matrix3x4*> results, Range<const Matrix3x4*> a, Range<const Matrix3x4*> b) {
+			GTSL_ASSERT(a.ElementCount() == b.ElementCount() && results.ElementCount() >= a.ElementCount(), "Ranges must have the same length.")
+			for (uint64 i = 0; i < a.ElementCount(); ++i) { results[i] = a[i] * b[i]; }
+		}
+
+		inline void inverseScalar(Range<Matrix4*> results, Range<const Matrix4*> matrices) {
+			GTSL_ASSERT(results.ElementCount() >= matrices.ElementCount(), "Ranges must have the same length.")
+			for (uint64 i = 0; i < matrices.ElementCount(); ++i) { results[i] = Inverse(matrices[i]); }
+		}
+
+		template<class M>
+		void affineInverseScalar(Range<M*> results, Range<const M*> matrices) {
+			GTSL_ASSERT(results.ElementCount() >= matrices.ElementCount(), "Ranges must have the same length.")
+
+			for (uint64 i = 0; i < matrices.ElementCount(); ++i) {
+				affineInverse(matrices[i][0], matrices[i][1], matrices[i][2], results[i][0], results[i][1], results[i][2]);
+				if constexpr (M::MATRIX_SIZE == 16) { results[i][3][0] = 0.0f; results[i][3][1] = 0.0f; results[i][3][2] = 0.0f; results[i][3][3] = 1.0f; }
+			}
+		}
+
+		inline void composeTransformsScalar(Range<Matrix4*> results, MultiRange<const float32, const float32, const float32> positions, MultiRange<const float32, const float32, const float32, const float32> rotations, MultiRange<const float32, const float32, const float32> scales) {
+			GTSL_ASSERT(results.ElementCount() >= positions.GetLength() && rotations.GetLength() == positions.GetLength() && scales.GetLength() == positions.GetLength(), "Ranges must have the same length.")
+
+			for (uint32 i = 0; i < positions.GetLength(); ++i) {
+				Matrix4 matrix(Quaternion(rotations.Get<0>(i), rotations.Get<1>(i), rotations.Get<2>(i), rotations.Get<3>(i)));
+
+				for (uint32 r = 0; r < 3; ++r) {
+					matrix[r][0] *= scales.Get<0>(i); matrix[r][1] *= scales.Get<1>(i); matrix[r][2] *= scales.Get<2>(i);
+				}
+
+				matrix[0][3] = positions.Get<0>(i); matrix[1][3] = positions.Get<1>(i); matrix[2][3] = positions.Get<2>(i);
+
+				results[i] = matrix;
+			}
+		}
+
+		// Same polynomial as slerpAVX2, one pair at a time.
+		inline void slerpScalar(MultiRange<float32, float32, float32, float32> results, MultiRange<const float32, const float32, const float32, const float32> a, MultiRange<const float32, const float32, const float32, const float32> b, const float32 alpha) {
+			constexpr uint32 TERMS = 8;
+			constexpr float32 ONE_PLUS_MU = 1.90110745351730037f;
+			constexpr float32 U[TERMS] = { 1.f / (1 * 3), 1.f / (2 * 5), 1.f / (3 * 7), 1.f / (4 * 9), 1.f / (5 * 11), 1.f / (6 * 13), 1.f / (7 * 15), ONE_PLUS_MU / (8 * 17) };
+			constexpr float32 V[TERMS] = { 1.f / 3, 2.f / 5, 3.f / 7, 4.f / 9, 5.f / 11, 6.f / 13, 7.f / 15, ONE_PLUS_MU * 8 / 17 };
+
+			const float32 t = alpha, d = 1.0f - alpha;
+
+			float32 tTerms[TERMS], dTerms[TERMS];
+			for (uint32 k = 0; k < TERMS; ++k) { tTerms[k] = U[k] * t * t - V[k]; dTerms[k] = U[k] * d * d - V[k]; }
+
+			for (uint32 i = 0; i < a.GetLength(); ++i) {
+				const float32 q0[4] = { a.Get<0>(i), a.Get<1>(i), a.Get<2>(i), a.Get<3>(i) }, q1[4] = { b.Get<0>(i), b.Get<1>(i), b.Get<2>(i), b.Get<3>(i) };
+
+				const float32 dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+				const float32 sign = std::signbit(dot) ? -1.0f : 1.0f, xm1 = dot * sign - 1.0f;
+
+				float32 cT = 1.0f, cD = 1.0f;
+				for (uint32 k = TERMS; k-- > 0;) { cT = tTerms[k] * xm1 * cT + 1.0f; cD = dTerms[k] * xm1 * cD + 1.0f; }
+
+				cT *= t * sign; cD *= d;
+
+				*results.GetPointer<0>(i) = q0[0] * cD + q1[0] * cT; *results.GetPointer<1>(i) = q0[1] * cD + q1[1] * cT;
+				*results.GetPointer<2>(i) = q0[2] * cD + q1[2] * cT; *results.GetPointer<3>(i) = q0[3] * cD + q1[3] * cT;
+			}
+		}
+
+		template<typename... TYPES>
+		void normalizeScalar(MultiRange<TYPES...> vectors) {
+			constexpr uint32 N = sizeof...(TYPES);
+
+			for (uint32 i = 0; i < vectors.GetLength(); ++i) {
+				float32 v[N];
+				[&]<uint64... C>(Indices<C...>) { ((v[C] = vectors.template Get<C>(i)), ...); }(BuildIndices<N>{});
+
+				float32 lengthSquared = 0.0f;
+				for (uint32 c = 0; c < N; ++c) { lengthSquared += v[c] * v[c]; }
+				if (!(lengthSquared > 0.0f)) { continue; }
+
+				const float32 inverseLength = 1.0f / std::sqrt(lengthSquared);
+				[&]<uint64... C>(Indices<C...>) { ((*vectors.template GetPointer<C>(i) = v[C] * inverseLength), ...); }(BuildIndices<N>{});
+			}
+		}
+
+		/**
+		 * \brief Computes the dot product of every pair of 2D vectors, 8 at a time where AVX2 is available.
+		 */
+		inline void DotProduct(float32* __restrict dps, MultiRange<const float32, const float32> v0, MultiRange<const float32, const float32> v1) {
+			static const Dispatcher<void(float32*, MultiRange<const float32, const float32>, MultiRange<const float32, const float32>)> dotProduct(dotProductScalar, nullptr, dotProductAVX2, nullptr);
+			dotProduct(dps, v0, v1);
+		}
+
+		inline void DotProduct(float32* __restrict dps, MultiRange<const float, const float> range, const Vector2 v1) {
+			static const Dispatcher<void(float32*, MultiRange<const float, const float>, Vector2)> dotProduct(dotProductScalar, nullptr, dotProductAVX2, nullptr);
+			dotProduct(dps, range, v1);
+		}
+
+		/**
+		 * \brief Computes the dot product of every pair of 3D vectors, 8 at a time where AVX2 is available.
+		 */
+		inline void DotProduct(float32* __restrict dps, MultiRange<const float32, const float32, const float32> v0, MultiRange<const float32, const float32, const float32> v1) {
+			static const Dispatcher<void(float32*, MultiRange<const float32, const float32, const float32>, MultiRange<const float32, const float32, const float32>)> dotProduct(dotProductScalar, nullptr, dotProductAVX2, nullptr);
+			dotProduct(dps, v0, v1);
+		}
+
+		inline void DotProduct(float32* __restrict dps, MultiRange<const float, const float, const float> range, const Vector3 v1) {
+			static const Dispatcher<void(float32*, MultiRange<const float, const float, const float>, Vector3)> dotProduct(dotProductScalar, nullptr, dotProductAVX2, nullptr);
+			dotProduct(dps, range, v1);
+		}
+
+		/**
+		 * \brief Transforms every point by matrix, as if they had a W component of 1. Points are stored as structure of arrays and processed 8 at a time where AVX2 is available.
+		 * \param results X, Y, Z components of the transformed points, can be the same as points.
+		 * \param matrix Matrix to transform every point by.
+		 * \param points X, Y, Z components of the points to transform.
+		 */
+		inline void TransformPoints(MultiRange<float32, float32, float32> results, const Matrix4& matrix, MultiRange<const float32, const float32, const float32> points) {
+			static const Dispatcher<void(MultiRange<float32, float32, float32>, const Matrix4&, MultiRange<const float32, const float32, const float32>)> transformPoints(transformPointsScalar, nullptr, transformPointsAVX2, nullptr);
+			transformPoints(results, matrix, points);
+		}
+
+		/**
+		 * \brief Multiplies every matrix in a by the matrix at the same index in b. With AVX2 each 8 wide operation computes two rows of a product.
+		 * \param results Products, can be the same as a or b.
+		 * \param a Left hand side matrices.
+		 * \param b Right hand side matrices, must have as many elements as a.
+		 */
+		inline void Multiply(Range<Matrix4*> results, Range<const Matrix4*> a, Range<const Matrix4*> b) {
+			static const Dispatcher<void(Range<Matrix4*>, Range<const Matrix4*>, Range<const Matrix4*>)> multiply(multiplyScalar, nullptr, multiplyAVX2, nullptr);
+			multiply(results, a, b);
+		}
+
+		/**
+		 * \brief Composes every affine transform in a with the one at the same index in b. With AVX2 two matrices are composed at a time, one per 128 bit lane.
+		 * \param results Products, can be the same as a or b.
+		 * \param a Left hand side transforms.
+		 * \param b Right hand side transforms, must have as many elements as a.
+		 */
+		inline void Multiply(Range<Matrix3x4*> results, Range<const Matrix3x4*> a, Range<const Matrix3x4*> b) {
+			static const Dispatcher<void(Range<Matrix3x4*>, Range<const Matrix3x4*>, Range<const Matrix3x4*>)> multiply(multiplyScalar, nullptr, multiplyAVX2, nullptr);
+			multiply(results, a, b);
+		}
+
+		/**
+		 * \brief Inverts every matrix with the same block method as Inverse(const Matrix4&). With AVX2 two matrices are inverted at a time, one per 128 bit lane.
+		 * \param results Inverses, can be the same as matrices.
+		 * \param matrices Matrices to invert, must not be singular.
+		 */
+		inline void Inverse(Range<Matrix4*> results, Range<const Matrix4*> matrices) {
+			static const Dispatcher<void(Range<Matrix4*>, Range<const Matrix4*>)> inverse(inverseScalar, nullptr, inverseAVX2, nullptr);
+			inverse(results, matrices);
+		}
+
+		/**
+		 * \brief Inverts every matrix whose last row is 0 0 0 1, see AffineInverse(const Matrix4&).
+		 * \param results Inverses, can be the same as matrices.
+		 */
+		inline void AffineInverse(Range<Matrix4*> results, Range<const Matrix4*> matrices) {
+			static const Dispatcher<void(Range<Matrix4*>, Range<const Matrix4*>)> inverse(affineInverseScalar<Matrix4>, nullptr, affineInverseAVX2<Matrix4>, nullptr);
+			inverse(results, matrices);
+		}
+
+		/**
+		 * \brief Inverts every affine transform, see Inverse(const Matrix3x4&).
+		 * \param results Inverses, can be the same as matrices.
+		 */
+		inline void Inverse(Range<Matrix3x4*> results, Range<const Matrix3x4*> matrices) {
+			static const Dispatcher<void(Range<Matrix3x4*>, Range<const Matrix3x4*>)> inverse(affineInverseScalar<Matrix3x4>, nullptr, affineInverseAVX2<Matrix3x4>, nullptr);
+			inverse(results, matrices);
+		}
+
+		/**
+		 * \brief Builds translation * rotation * scale matrices from transforms stored as structure of arrays, 8 at a time where AVX2 is available.
+		 * \param results Matrices, one per transform.
+		 * \param positions X, Y, Z components of the translations.
+		 * \param rotations X, Y, Z, W components of the rotations, must be normalized.
+		 * \param scales X, Y, Z components of the scales.
+		 */
+		inline void ComposeTransforms(Range<Matrix4*> results, MultiRange<const float32, const float32, const float32> positions, MultiRange<const float32, const float32, const float32, const float32> rotations, MultiRange<const float32, const float32, const float32> scales) {
+			static const Dispatcher<void(Range<Matrix4*>, MultiRange<const float32, const float32, const float32>, MultiRange<const float32, const float32, const float32, const float32>, MultiRange<const float32, const float32, const float32>)> composeTransforms(composeTransformsScalar, nullptr, composeTransformsAVX2, nullptr);
+			composeTransforms(results, positions, rotations, scales);
+		}
+
+		/**
+		 * \brief Spherically interpolates every quaternion in a towards the one at the same index in b through the shortest path, 8 at a time where AVX2 is available.
+		 * The interpolation coefficients are evaluated with Eberly's polynomial approximation("A Fast and Accurate Algorithm for Computing SLERP"),
+		 * which needs no trigonometric functions or branches and stays within 1e-6 of the exact slerp for normalized inputs.
+		 * \param results X, Y, Z, W components of the interpolated quaternions, can be the same as a or b.
+		 * \param a X, Y, Z, W components of the quaternions to interpolate from.
+		 * \param b X, Y, Z, W components of the quaternions to interpolate to.
+		 * \param alpha Interpolation factor, 0 returns a and 1 returns b.
+		 */
+		inline void Slerp(MultiRange<float32, float32, float32, float32> results, MultiRange<const float32, const float32, const float32, const float32> a, MultiRange<const float32, const float32, const float32, const float32> b, const float32 alpha) {
+			static const Dispatcher<void(MultiRange<float32, float32, float32, float32>, MultiRange<const float32, const float32, const float32, const float32>, MultiRange<const float32, const float32, const float32, const float32>, float32)> slerp(slerpScalar, nullptr, slerpAVX2, nullptr);
+			slerp(results, a, b, alpha);
+		}
+
+		/**
+		 * \brief Normalizes every vector in place, 8 at a time where AVX2 is available. Zero length vectors are left untouched.
+		 * \param vectors X, Y, Z components of the vectors.
+		 */
+		inline void Normalize(MultiRange<float32, float32, float32> vectors) {
+			static const Dispatcher<void(MultiRange<float32, float32, float32>)> normalize(normalizeScalar<float32, float32, float32>, nullptr, normalizeAVX2<float32, float32, float32>, nullptr);
+			normalize(vectors);
+		}
+
+		/**
+		 * \brief Normalizes every 4 component vector or quaternion in place, 8 at a time where AVX2 is available. Zero length vectors are left untouched.
+		 * \param vectors X, Y, Z, W components of the vectors.
+		 */
+		inline void Normalize(MultiRange<float32, float32, float32, float32> vectors) {
+			static const Dispatcher<void(MultiRange<float32, float32, float32, float32>)> normalize(normalizeScalar<float32, float32, float32, float32>, nullptr, normalizeAVX2<float32, float32, float32, float32>, nullptr);
+			normalize(vectors);
+		}
 	}
 
 	inline Matrix4::Matrix4(const Rotator& rotator) {
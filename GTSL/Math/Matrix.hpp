@@ -136,6 +136,19 @@ namespace GTSL
 		[[nodiscard]] Vector4 GetYBasisVector() const { return Vector4(array[1][0], array[1][1], array[1][2], array[1][3]); }
 		[[nodiscard]] Vector4 GetZBasisVector() const { return Vector4(array[2][0], array[2][1], array[2][2], array[2][3]); }
 		[[nodiscard]] Vector4 GetWBasisVector() const { return Vector4(array[3][0], array[3][1], array[3][2], array[3][3]); }
+
+		/**
+		 * \brief Returns row as it's stored, a single aligned load.
+		 */
+		[[nodiscard]] Vector4 GetRow(const uint8 row) const { return Vector4(array[row][0], array[row][1], array[row][2], array[row][3]); }
+
+		/**
+		 * \brief Returns column by reading it's element from every row, without transposing the matrix.
+		 */
+		[[nodiscard]] Vector4 GetColumn(const uint8 column) const { return Vector4(array[0][column], array[1][column], array[2][column], array[3][column]); }
+
+		void SetRow(const uint8 row, const Vector4 vector) { array[row][0] = vector.X(); array[row][1] = vector.Y(); array[row][2] = vector.Z(); array[row][3] = vector.W(); }
+		void SetColumn(const uint8 column, const Vector4 vector) { array[0][column] = vector.X(); array[1][column] = vector.Y(); array[2][column] = vector.Z(); array[3][column] = vector.W(); }
 		
 		void Transpose() {
 			auto a{ float4x(AlignedPointer<const float32, 16>(array[0])) }, b{ float4x(AlignedPointer<const float32, 16>(array[1])) }, c{ float4x(AlignedPointer<const float32, 16>(array[2])) }, d{ float4x(AlignedPointer<const float32, 16>(array[3])) };
@@ -278,6 +291,10 @@ namespace GTSL
 		}
 	};
 
+	/**
+	 * \brief Affine transform stored as the top 3 rows of a row major 4x4 matrix, the implicit last row is 0 0 0 1.
+	 * Takes 48 bytes instead of 64 and composes with 3 row products instead of 4, which is what transform hierarchies should stream.
+	 */
 	struct Matrix3x4 : Matrix<float32, 3, 4> {
 	public:
 		Matrix3x4() = default;
@@ -293,26 +310,37 @@ namespace GTSL
 		float32* operator[](const uint8 index) { return array[index]; }
 		const float32* operator[](const uint8 index) const { return array[index]; }
 
+		[[nodiscard]] Vector4 GetRow(const uint8 row) const { return Vector4(array[row][0], array[row][1], array[row][2], array[row][3]); }
+
+		/**
+		 * \brief Returns the first 3 elements of column, the 4th column is the translation.
+		 */
+		[[nodiscard]] Vector3 GetColumn(const uint8 column) const { return Vector3(array[0][column], array[1][column], array[2][column]); }
+
 		Vector3 operator*(const Vector3& other) const {
 			return Vector3(array[0][0] * other.X() + array[0][1] * other.Y() + array[0][2] * other.Z() + array[0][3] * 1/*W*/, array[1][0] * other.X() + array[1][1] * other.Y() + array[1][2] * other.Z() + array[1][3] * 1/*W*/, array[2][0] * other.X() + array[2][1] * other.Y() + array[2][2] * other.Z() + array[2][3] * 1/*W*/);
 		}
 
-		Matrix3x4& operator*=(const Matrix3x4& other) {
-			//https://codereview.stackexchange.com/questions/101144/simd-matrix-multiplication
+		Matrix3x4 operator*(const Matrix3x4& other) const {
+			Matrix3x4 result(*this);
+			return result *= other;
+		}
 
+		Matrix3x4& operator*=(const Matrix3x4& other) {
 			const auto other_row_1 = float4x(AlignedPointer<const float32, 16>(other.array[0]));
 			const auto other_row_2 = float4x(AlignedPointer<const float32, 16>(other.array[1]));
 			const auto other_row_3 = float4x(AlignedPointer<const float32, 16>(other.array[2]));
-			const auto other_row_4 = float4x(1.0f);
-
-			float4x this_x, this_y, this_z, this_w, row;
+			const auto other_row_4 = float4x(0.0f, 0.0f, 0.0f, 1.0f); // implicit last row, only carries this row's translation through
 
 			for (uint8 i = 0; i < 3; ++i) {
-				this_x = array[i][0]; this_y = array[i][1]; this_z = array[i][2]; this_w = array[i][3];
+				const auto row = float4x(AlignedPointer<const float32, 16>(array[i]));
 
-				row = this_x * other_row_1 + this_y * other_row_2 + this_z * other_row_3 + this_w * other_row_4;
+				auto product = row * other_row_4;
+				product = float4x::MultiplyAdd(float4x::Shuffle<0, 0, 0, 0>(row), other_row_1, product);
+				product = float4x::MultiplyAdd(float4x::Shuffle<1, 1, 1, 1>(row), other_row_2, product);
+				product = float4x::MultiplyAdd(float4x::Shuffle<2, 2, 2, 2>(row), other_row_3, product);
 
-				row.CopyTo(AlignedPointer<float32, 16>(array[i]));
+				product.CopyTo(AlignedPointer<float32, 16>(array[i]));
 			}
 
 			return *this;
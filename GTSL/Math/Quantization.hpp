@@ -0,0 +1,413 @@
+#pragma once
+
+#include "Math.hpp"
+#include "Vectors.hpp"
+#include "Quaternion.h"
+
+#include "GTSL/Core.h"
+#include "GTSL/Assert.h"
+#include "GTSL/Range.hpp"
+#include "GTSL/SIMD.hpp"
+#include "GTSL/TypeTraits.hpp"
+
+#include <type_traits>
+
+namespace GTSL
+{
+	/**
+	 * \brief Fixed point number stored as an INT whose low FRAC bits are the fraction.
+	 * Sums are exact, products round to nearest and quotients truncate towards zero. Overflow wraps like it does for INT.
+	 * \tparam INT Integer used for storage, signed or unsigned, up to 32 bits.
+	 * \tparam FRAC Number of fractional bits.
+	 */
+	template<typename INT, uint8 FRAC>
+	struct Fixed {
+		static_assert(sizeof(INT) <= 4, "Storage must be at most 32 bits wide, products are computed in 64 bits.");
+		static_assert(FRAC < sizeof(INT) * 8, "There must be at least one integer bit.");
+
+		using type = INT;
+		static constexpr uint8 FRACTION_BITS = FRAC;
+		static constexpr float32 SCALE = static_cast<float32>(1ull << FRAC);
+		static constexpr int64 MIN_RAW = INT(~0) < INT(0) ? -(1ll << (sizeof(INT) * 8 - 1)) : 0ll, MAX_RAW = INT(~0) < INT(0) ? (1ll << (sizeof(INT) * 8 - 1)) - 1 : (1ll << (sizeof(INT) * 8)) - 1;
+
+		Fixed() = default;
+
+		/**
+		 * \brief Converts value rounding to nearest even, values out of range are clamped and NaN becomes 0.
+		 */
+		explicit Fixed(const float32 value) : Value(fromFloat32(value)) {}
+
+		static constexpr Fixed FromInteger(const INT integer) { return FromRaw(static_cast<INT>(static_cast<int64>(integer) * (1ll << FRAC))); }
+		static constexpr Fixed FromRaw(const INT raw) { Fixed result; result.Value = raw; return result; }
+
+		explicit operator float32() const { return static_cast<float32>(Value) / SCALE; }
+
+		//Returns the integer part, rounded towards negative infinity.
+		[[nodiscard]] constexpr INT GetInteger() const { return static_cast<INT>(static_cast<int64>(Value) >> FRAC); }
+
+		constexpr Fixed operator-() const { return FromRaw(static_cast<INT>(-static_cast<int64>(Value))); }
+
+		constexpr Fixed operator+(const Fixed other) const { return FromRaw(static_cast<INT>(static_cast<int64>(Value) + other.Value)); }
+		constexpr Fixed operator-(const Fixed other) const { return FromRaw(static_cast<INT>(static_cast<int64>(Value) - other.Value)); }
+
+		constexpr Fixed operator*(const Fixed other) const {
+			const wide product = static_cast<wide>(Value) * static_cast<wide>(other.Value);
+			if constexpr (FRAC == 0) { return FromRaw(static_cast<INT>(product)); } else { return FromRaw(static_cast<INT>((product + (static_cast<wide>(1) << (FRAC - 1))) >> FRAC)); }
+		}
+
+		constexpr Fixed operator/(const Fixed other) const { return FromRaw(static_cast<INT>(static_cast<wide>(Value) * (static_cast<wide>(1) << FRAC) / static_cast<wide>(other.Value))); }
+
+		constexpr Fixed& operator+=(const Fixed other) { return *this = *this + other; }
+		constexpr Fixed& operator-=(const Fixed other) { return *this = *this - other; }
+		constexpr Fixed& operator*=(const Fixed other) { return *this = *this * other; }
+		constexpr Fixed& operator/=(const Fixed other) { return *this = *this / other; }
+
+		constexpr bool operator==(const Fixed other) const { return Value == other.Value; }
+		constexpr bool operator!=(const Fixed other) const { return Value != other.Value; }
+		constexpr bool operator<(const Fixed other) const { return Value < other.Value; }
+		constexpr bool operator<=(const Fixed other) const { return Value <= other.Value; }
+		constexpr bool operator>(const Fixed other) const { return Value > other.Value; }
+		constexpr bool operator>=(const Fixed other) const { return Value >= other.Value; }
+
+		INT Value = 0;
+
+	private:
+		using wide = std::conditional_t<std::is_signed_v<INT>, int64, uint64>; // products of 32 bit unsigned values don't fit in int64
+
+		static INT fromFloat32(const float32 value);
+	};
+
+	/**
+	 * \brief Position quantized to 16 bits per axis inside known bounds.
+	 */
+	struct PackedVector3 {
+		uint16 X = 0, Y = 0, Z = 0;
+	};
+
+	/**
+	 * \brief Rotation stored as it's three smallest components at 10 bits each, plus the index of the dropped largest one in the top 2 bits.
+	 * The dropped component is rebuilt from the unit length constraint. Stored components are off by at most half a step, 7e-4, the rebuilt one by up to 2e-3.
+	 */
+	struct PackedQuaternion {
+		uint32 Bits = 0;
+	};
+
+	namespace Math
+	{
+		/**
+		 * \brief Rounds to the nearest integer, ties to even, like the SIMD conversions do.
+		 */
+		inline float32 RoundToNearestEven(const float32 x) {
+			constexpr float32 MAGIC = 8388608.0f; // 2^23, adding it pushes every fractional bit out of the mantissa
+			const float32 a = Abs(x);
+			if (!(a < MAGIC)) { return x; } // already integral, infinite or NaN
+			const float32 rounded = (a + MAGIC) - MAGIC;
+			return x < 0.0f ? -rounded : rounded;
+		}
+
+		//Converts a value in [0, 1] to 8 bits, out of range values are clamped and NaN becomes 0.
+		inline uint8 ToUnorm8(const float32 value) { return static_cast<uint8>(RoundToNearestEven((value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f) * 255.0f)); }
+		inline float32 FromUnorm8(const uint8 value) { return static_cast<float32>(value) * (1.0f / 255.0f); }
+
+		//Converts a value in [-1, 1] to 16 bits, out of range values are clamped and NaN becomes 0. Both -32767 and -32768 decode to -1.
+		inline int16 ToSnorm16(const float32 value) { return static_cast<int16>(RoundToNearestEven((value > -1.0f ? (value < 1.0f ? value : 1.0f) : (value == value ? -1.0f : 0.0f)) * 32767.0f)); }
+		inline float32 FromSnorm16(const int16 value) { return Max(static_cast<float32>(value) * (1.0f / 32767.0f), -1.0f); }
+
+		/**
+		 * \brief Quantizes position to 16 bits per axis, positions outside [min, max] are clamped.
+		 */
+		inline PackedVector3 Pack(const Vector3 position, const Vector3 min, const Vector3 max) {
+			auto quantize = [](const float32 x, const float32 from, const float32 to) {
+				const float32 t = (x - from) / (to - from);
+				return static_cast<uint16>(RoundToNearestEven((t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f) * 65535.0f));
+			};
+
+			return { quantize(position.X(), min.X(), max.X()), quantize(position.Y(), min.Y(), max.Y()), quantize(position.Z(), min.Z(), max.Z()) };
+		}
+
+		inline Vector3 Unpack(const PackedVector3 packed, const Vector3 min, const Vector3 max) {
+			auto dequantize = [](const uint16 x, const float32 from, const float32 to) { return from + (to - from) * (static_cast<float32>(x) * (1.0f / 65535.0f)); };
+			return { dequantize(packed.X, min.X(), max.X()), dequantize(packed.Y, min.Y(), max.Y()), dequantize(packed.Z, min.Z(), max.Z()) };
+		}
+
+		/**
+		 * \brief Packs a normalized quaternion with the smallest three method, in 32 bits.
+		 */
+		inline PackedQuaternion Pack(const Quaternion quaternion) {
+			constexpr float32 RANGE = 0.70710678f; // no component other than the largest can be bigger than 1 / sqrt(2)
+			constexpr uint32 STEPS = (1 << 10) - 1;
+
+			uint32 largest = 0;
+			for (uint32 i = 1; i < 4; ++i) { if (Abs(quaternion[i]) > Abs(quaternion[largest])) { largest = i; } }
+
+			const float32 sign = quaternion[largest] < 0.0f ? -1.0f : 1.0f; // q and -q are the same rotation, make the dropped component positive
+
+			uint32 bits = largest;
+			for (uint32 i = 0; i < 4; ++i) {
+				if (i == largest) { continue; }
+				const float32 t = (quaternion[i] * sign / RANGE) * 0.5f + 0.5f;
+				bits = bits << 10 | static_cast<uint32>(RoundToNearestEven((t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f) * STEPS));
+			}
+
+			return { bits };
+		}
+
+		inline Quaternion Unpack(const PackedQuaternion packed) {
+			constexpr float32 RANGE = 0.70710678f;
+			constexpr uint32 STEPS = (1 << 10) - 1;
+
+			const uint32 largest = packed.Bits >> 30;
+			float32 components[4]; float32 sum = 0.0f;
+
+			for (uint32 i = 0, shift = 20; i < 4; ++i) {
+				if (i == largest) { continue; }
+				components[i] = (static_cast<float32>((packed.Bits >> shift) & STEPS) / STEPS * 2.0f - 1.0f) * RANGE;
+				sum += components[i] * components[i];
+				shift -= 10;
+			}
+
+			alignas(16) float32 root[4];
+			float4x(Max(1.0f - sum, 0.0f)).SquareRoot().CopyTo(AlignedPointer<float32, 16>(root));
+			components[largest] = root[0];
+
+			return Quaternion(components[0], components[1], components[2], components[3]);
+		}
+	}
+
+	template<typename INT, uint8 FRAC>
+	INT Fixed<INT, FRAC>::fromFloat32(const float32 value) {
+		const float32 scaled = Math::RoundToNearestEven(value * SCALE);
+		if (!(scaled == scaled)) { return 0; }
+		if (scaled <= static_cast<float32>(MIN_RAW)) { return static_cast<INT>(MIN_RAW); }
+		if (scaled >= static_cast<float32>(MAX_RAW)) { return static_cast<INT>(MAX_RAW); } // 32 bit limits round up to the next power of two as floats
+		return static_cast<INT>(static_cast<int64>(scaled));
+	}
+
+GTSL_BEGIN_AVX2_FUNCTIONS
+
+	namespace Math
+	{
+		inline void toHalfAVX2(Range<float16*> results, Range<const float32*> values) {
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				float8x(UnalignedPointer<const float32>(values.begin() + i)).CopyToHalf(UnalignedPointer<uint16>(&results[i].halfFloat));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = float16(values[i]); }
+		}
+
+		inline void fromHalfAVX2(Range<float32*> results, Range<const float16*> values) {
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				float8x::LoadHalf(UnalignedPointer<const uint16>(&values[i].halfFloat)).CopyTo(UnalignedPointer<float32>(results.begin() + i));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = static_cast<float32>(values[i]); }
+		}
+
+		template<typename INT, uint8 FRAC>
+		void toFixedAVX2(Range<Fixed<INT, FRAC>*> results, Range<const float32*> values) {
+			using FIXED = Fixed<INT, FRAC>;
+			uint64 i = 0;
+
+			if constexpr (IsSame<INT, int32>() || sizeof(INT) == 2) {
+				const float8x zero(0.0f), scale(FIXED::SCALE), min(static_cast<float32>(FIXED::MIN_RAW)), max(static_cast<float32>(FIXED::MAX_RAW)), overflow(2147483648.0f);
+
+				for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+					const auto scaled = float8x(UnalignedPointer<const float32>(values.begin() + i)) * scale;
+					const auto clamped = float8x::Max(float8x(zero, scaled, scaled == scaled), min); // NaN to 0 first, Max would turn it in to min
+
+					if constexpr (sizeof(INT) == 4) { // conversion gives INT32_MIN from 2^31 up, flipping it's bits gives INT32_MAX
+						(clamped.RoundToInt32() ^ SIMD<int32, 8>(clamped >= overflow)).CopyTo(UnalignedPointer<int32>(reinterpret_cast<int32*>(results.begin() + i)));
+					} else {
+						float8x::Min(clamped, max).RoundToInt32().CopyToSaturated(UnalignedPointer<INT>(reinterpret_cast<INT*>(results.begin() + i)));
+					}
+				}
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = FIXED(values[i]); }
+		}
+
+		template<typename INT, uint8 FRAC>
+		void fromFixedAVX2(Range<float32*> results, Range<const Fixed<INT, FRAC>*> values) {
+			uint64 i = 0;
+
+			if constexpr (IsSame<INT, int32>() || sizeof(INT) == 2) {
+				const float8x inverseScale(1.0f / Fixed<INT, FRAC>::SCALE);
+
+				for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+					SIMD<int32, 8> integers;
+					if constexpr (sizeof(INT) == 4) {
+						integers = SIMD<int32, 8>(UnalignedPointer<const int32>(reinterpret_cast<const int32*>(values.begin() + i)));
+					} else {
+						integers = SIMD<int32, 8>::LoadWidened(UnalignedPointer<const INT>(reinterpret_cast<const INT*>(values.begin() + i)));
+					}
+
+					(float8x::ConvertFromInt32(integers) * inverseScale).CopyTo(UnalignedPointer<float32>(results.begin() + i));
+				}
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = static_cast<float32>(values[i]); }
+		}
+
+		inline void toUnorm8AVX2(Range<uint8*> results, Range<const float32*> values) {
+			const float8x zero(0.0f), one(1.0f), scale(255.0f);
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				const auto clamped = float8x::Min(float8x::Max(float8x(UnalignedPointer<const float32>(values.begin() + i)), zero), one);
+				(clamped * scale).RoundToInt32().CopyToSaturated(UnalignedPointer<uint8>(results.begin() + i));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = ToUnorm8(values[i]); }
+		}
+
+		inline void fromUnorm8AVX2(Range<float32*> results, Range<const uint8*> values) {
+			const float8x scale(1.0f / 255.0f);
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				(float8x::ConvertFromInt32(SIMD<int32, 8>::LoadWidened(UnalignedPointer<const uint8>(values.begin() + i))) * scale).CopyTo(UnalignedPointer<float32>(results.begin() + i));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = FromUnorm8(values[i]); }
+		}
+
+		inline void toSnorm16AVX2(Range<int16*> results, Range<const float32*> values) {
+			const float8x zero(0.0f), minusOne(-1.0f), one(1.0f), scale(32767.0f);
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				const float8x value(UnalignedPointer<const float32>(values.begin() + i));
+				const auto clamped = float8x::Min(float8x::Max(float8x(zero, value, value == value), minusOne), one); // NaN to 0 first, Max would turn it in to -1
+				(clamped * scale).RoundToInt32().CopyToSaturated(UnalignedPointer<int16>(results.begin() + i));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = ToSnorm16(values[i]); }
+		}
+
+		inline void fromSnorm16AVX2(Range<float32*> results, Range<const int16*> values) {
+			const float8x scale(1.0f / 32767.0f), minusOne(-1.0f);
+			uint64 i = 0;
+
+			for (; i + float8x::ElementCount <= values.ElementCount(); i += float8x::ElementCount) {
+				const auto value = float8x::ConvertFromInt32(SIMD<int32, 8>::LoadWidened(UnalignedPointer<const int16>(values.begin() + i))) * scale;
+				float8x::Max(value, minusOne).CopyTo(UnalignedPointer<float32>(results.begin() + i));
+			}
+
+			for (; i < values.ElementCount(); ++i) { results[i] = FromSnorm16(values[i]); }
+		}
+	}
+
+GTSL_END_TARGET_FUNCTIONS
+
+	namespace Math
+	{
+		inline void toHalfScalar(Range<float16*> results, Range<const float32*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = float16(values[i]); }
+		}
+
+		inline void fromHalfScalar(Range<float32*> results, Range<const float16*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = static_cast<float32>(values[i]); }
+		}
+
+		template<typename INT, uint8 FRAC>
+		void toFixedScalar(Range<Fixed<INT, FRAC>*> results, Range<const float32*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = Fixed<INT, FRAC>(values[i]); }
+		}
+
+		template<typename INT, uint8 FRAC>
+		void fromFixedScalar(Range<float32*> results, Range<const Fixed<INT, FRAC>*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = static_cast<float32>(values[i]); }
+		}
+
+		inline void toUnorm8Scalar(Range<uint8*> results, Range<const float32*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = ToUnorm8(values[i]); }
+		}
+
+		inline void fromUnorm8Scalar(Range<float32*> results, Range<const uint8*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = FromUnorm8(values[i]); }
+		}
+
+		inline void toSnorm16Scalar(Range<int16*> results, Range<const float32*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = ToSnorm16(values[i]); }
+		}
+
+		inline void fromSnorm16Scalar(Range<float32*> results, Range<const int16*> values) {
+			for (uint64 i = 0; i < values.ElementCount(); ++i) { results[i] = FromSnorm16(values[i]); }
+		}
+
+		/**
+		 * \brief Converts every value to an IEEE half, 8 at a time where F16C is available. Rounds to nearest even, out of range values become infinity.
+		 * \param results Halves, must have at least as many elements as values.
+		 * \param values Floats to convert.
+		 */
+		inline void ToHalf(Range<float16*> results, Range<const float32*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<float16*>, Range<const float32*>)> toHalf(toHalfScalar, nullptr, toHalfAVX2, nullptr);
+			toHalf(results, values);
+		}
+
+		/**
+		 * \brief Converts every half to a float, exactly, 8 at a time where F16C is available.
+		 */
+		inline void FromHalf(Range<float32*> results, Range<const float16*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<float32*>, Range<const float16*>)> fromHalf(fromHalfScalar, nullptr, fromHalfAVX2, nullptr);
+			fromHalf(results, values);
+		}
+
+		/**
+		 * \brief Converts every value to fixed point, rounding to nearest even and clamping to the representable range. NaN becomes 0.
+		 * 8 values at a time for signed 32 bit and any 16 bit storage where AVX2 is available.
+		 */
+		template<typename INT, uint8 FRAC>
+		void ToFixed(Range<Fixed<INT, FRAC>*> results, Range<const float32*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<Fixed<INT, FRAC>*>, Range<const float32*>)> toFixed(toFixedScalar<INT, FRAC>, nullptr, toFixedAVX2<INT, FRAC>, nullptr);
+			toFixed(results, values);
+		}
+
+		/**
+		 * \brief Converts every fixed point number to a float, 8 at a time for 32 bit signed and 16 bit storage where AVX2 is available. 32 bit values above 2^24 lose precision.
+		 */
+		template<typename INT, uint8 FRAC>
+		void FromFixed(Range<float32*> results, Range<const Fixed<INT, FRAC>*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<float32*>, Range<const Fixed<INT, FRAC>*>)> fromFixed(fromFixedScalar<INT, FRAC>, nullptr, fromFixedAVX2<INT, FRAC>, nullptr);
+			fromFixed(results, values);
+		}
+
+		/**
+		 * \brief Converts every value in [0, 1] to 8 bits, see ToUnorm8(float32).
+		 */
+		inline void ToUnorm8(Range<uint8*> results, Range<const float32*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<uint8*>, Range<const float32*>)> toUnorm8(toUnorm8Scalar, nullptr, toUnorm8AVX2, nullptr);
+			toUnorm8(results, values);
+		}
+
+		inline void FromUnorm8(Range<float32*> results, Range<const uint8*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<float32*>, Range<const uint8*>)> fromUnorm8(fromUnorm8Scalar, nullptr, fromUnorm8AVX2, nullptr);
+			fromUnorm8(results, values);
+		}
+
+		/**
+		 * \brief Converts every value in [-1, 1] to 16 bits, see ToSnorm16(float32).
+		 */
+		inline void ToSnorm16(Range<int16*> results, Range<const float32*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<int16*>, Range<const float32*>)> toSnorm16(toSnorm16Scalar, nullptr, toSnorm16AVX2, nullptr);
+			toSnorm16(results, values);
+		}
+
+		inline void FromSnorm16(Range<float32*> results, Range<const int16*> values) {
+			GTSL_ASSERT(results.ElementCount() >= values.ElementCount(), "Ranges must have the same length.")
+			static const Dispatcher<void(Range<float32*>, Range<const int16*>)> fromSnorm16(fromSnorm16Scalar, nullptr, fromSnorm16AVX2, nullptr);
+			fromSnorm16(results, values);
+		}
+	}
+}
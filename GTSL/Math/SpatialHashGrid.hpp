@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Math.hpp"
+#include "Vectors.hpp"
+#include "BVH.hpp"
+
+#include "GTSL/Core.h"
+#include "GTSL/Algorithm.hpp"
+#include "GTSL/Atomic.hpp"
+#include "GTSL/Barrier.hpp"
+#include "GTSL/Bitman.h"
+#include "GTSL/Delegate.hpp"
+#include "GTSL/Range.hpp"
+#include "GTSL/Thread.hpp"
+#include "GTSL/Vector.hpp"
+
+namespace GTSL
+{
+	/**
+	 * \brief Integer coordinates of a cell of a uniform grid.
+	 */
+	struct GridCell {
+		int32 X = 0, Y = 0, Z = 0;
+
+		bool operator==(const GridCell& other) const { return X == other.X && Y == other.Y && Z == other.Z; }
+	};
+
+	template<>
+	struct Hash<GridCell> {
+		uint64 value;
+		Hash(const GridCell& cell) : value(static_cast<uint32>(cell.X) * 73856093u ^ static_cast<uint32>(cell.Y) * 19349663u ^ static_cast<uint32>(cell.Z) * 83492791u) {}
+		operator uint64() const { return value; }
+	};
+
+	/**
+	 * \brief Uniform grid over unbounded space, cells are hashed into a power of two table so only occupied cells cost memory.
+	 * Rebuilt from scratch every tick with a counting sort, which leaves the points of every bucket contiguous and their positions copied in bucket order
+	 * so queries walk memory linearly. Distinct cells may share a bucket, queries filter them out.
+	 * \tparam ALLOCATOR Allocator used for the table and point data.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class SpatialHashGrid {
+	public:
+		/**
+		 * \param cellSize Edge length of the cells, queries are fastest when it's about the query radius.
+		 */
+		explicit SpatialHashGrid(const float32 cellSize, const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), inverseCellSize(1.0f / cellSize),
+		bucketStarts(allocator), pointBuckets(allocator), indices(allocator), xs(allocator), ys(allocator), zs(allocator) {}
+
+		/**
+		 * \brief Rebuilds the grid in linear time.
+		 * \param points X, Y, Z components of every point, points are referred to by their index in this range.
+		 * \param threadCount Number of threads used to build, including the calling one. Points are split in equal chunks, and their order within a bucket isn't deterministic when more than one thread is used.
+		 * \param firstThreadId Thread id given to the first spawned thread, the rest are given consecutive ids.
+		 */
+		void Build(MultiRange<const float32, const float32, const float32> points, const uint8 threadCount = 1, const uint8 firstThreadId = 1) {
+			const uint32 pointCount = points.GetLength();
+			const uint32 bucketCount = NextPowerOfTwo(Math::Max(pointCount * 2, 64u));
+
+			bucketStarts.Resize(0); bucketStarts.EmplaceGroup(bucketCount + 1, 0u);
+			pointBuckets.Resize(0); pointBuckets.EmplaceGroup(pointCount, 0u);
+			indices.Resize(0); indices.EmplaceGroup(pointCount, 0u);
+			xs.Resize(0); xs.EmplaceGroup(pointCount, 0.0f); ys.Resize(0); ys.EmplaceGroup(pointCount, 0.0f); zs.Resize(0); zs.EmplaceGroup(pointCount, 0.0f);
+
+			buildContext context{ this, points, threadCount > 1 ? threadCount : static_cast<uint8>(1) };
+
+			auto prefixSum = [this, bucketCount]() { // inclusive, scatter then decrements every bucket back to it's start
+				for (uint32 b = 1; b < bucketCount; ++b) { bucketStarts[b] += bucketStarts[b - 1]; }
+				bucketStarts[bucketCount] = bucketStarts[bucketCount - 1];
+			};
+
+			PhaseBarrier barrier(context.ThreadCount, Delegate<void()>::Create(prefixSum));
+			context.Barrier = &barrier;
+
+			Vector<Thread, ALLOCATOR> threads(context.ThreadCount, allocator);
+			for (uint32 t = 1; t < context.ThreadCount; ++t) {
+				threads.EmplaceBack(allocator, static_cast<uint8>(firstThreadId + t - 1), Delegate<void(buildContext*, uint32)>::template Create<&SpatialHashGrid::buildWorker>(), &context, t);
+			}
+
+			buildWorker(&context, 0);
+
+			for (auto& thread : threads) { thread.Join(allocator); }
+		}
+
+		/**
+		 * \brief Calls onPoint(uint32 index) for every point inside the sphere, visiting only the cells it overlaps.
+		 * \return Number of points inside the sphere.
+		 */
+		template<typename F>
+		uint32 QueryRadius(const Vector3 center, const float32 radius, F&& onPoint) const {
+			const float32 radiusSquared = radius * radius;
+
+			return visitCells(center - radius, center + radius, [&](const uint32 i) {
+				const float32 dx = xs[i] - center.X(), dy = ys[i] - center.Y(), dz = zs[i] - center.Z();
+				return dx * dx + dy * dy + dz * dz <= radiusSquared;
+			}, onPoint);
+		}
+
+		/**
+		 * \brief Calls onPoint(uint32 index) for every point inside box, visiting only the cells it overlaps.
+		 * \return Number of points inside box.
+		 */
+		template<typename F>
+		uint32 QueryAABB(const AABB& box, F&& onPoint) const {
+			return visitCells(box.Min, box.Max, [&](const uint32 i) {
+				return xs[i] >= box.Min.X() && xs[i] <= box.Max.X() && ys[i] >= box.Min.Y() && ys[i] <= box.Max.Y() && zs[i] >= box.Min.Z() && zs[i] <= box.Max.Z();
+			}, onPoint);
+		}
+
+		/**
+		 * \brief Calls onPair(uint32 a, uint32 b), with a < b, once for every pair of points closer than radius.
+		 * \return Number of pairs.
+		 */
+		template<typename F>
+		uint32 ForEachNeighborPair(const float32 radius, F&& onPair) const {
+			uint32 count = 0;
+
+			for (uint32 i = 0; i < indices.GetLength(); ++i) { // walk in bucket order, neighboring queries touch the same cells
+				const uint32 a = indices[i];
+				QueryRadius(Vector3(xs[i], ys[i], zs[i]), radius, [&](const uint32 b) { if (a < b) { onPair(a, b); ++count; } });
+			}
+
+			return count;
+		}
+
+		[[nodiscard]] GridCell GetCell(const Vector3 position) const { return { toCell(position.X()), toCell(position.Y()), toCell(position.Z()) }; }
+
+		[[nodiscard]] uint32 GetPointCount() const { return indices.GetLength(); }
+
+		[[nodiscard]] float32 GetCellSize() const { return 1.0f / inverseCellSize; }
+
+	private:
+		struct buildContext {
+			SpatialHashGrid* Grid; MultiRange<const float32, const float32, const float32> Points; uint8 ThreadCount;
+			PhaseBarrier* Barrier = nullptr;
+		};
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		float32 inverseCellSize;
+		Vector<uint32, ALLOCATOR> bucketStarts; // bucket count + 1 entries, points of bucket b are in [bucketStarts[b], bucketStarts[b + 1])
+		Vector<uint32, ALLOCATOR> pointBuckets;
+		Vector<uint32, ALLOCATOR> indices; // original index of every point, in bucket order
+		Vector<float32, ALLOCATOR> xs, ys, zs; // positions in bucket order
+
+		int32 toCell(const float32 coordinate) const {
+			const float32 scaled = coordinate * inverseCellSize;
+			const int32 truncated = static_cast<int32>(scaled);
+			return scaled < static_cast<float32>(truncated) ? truncated - 1 : truncated;
+		}
+
+		uint32 bucketOf(const GridCell cell) const { return ModuloByPowerOf2(Hash<GridCell>(cell), bucketStarts.GetLength() - 1); }
+
+		static void buildWorker(buildContext* context, const uint32 thread) {
+			auto& grid = *context->Grid; auto points = context->Points;
+			const uint32 chunk = (points.GetLength() + context->ThreadCount - 1) / context->ThreadCount;
+			const uint32 begin = Math::Min(thread * chunk, points.GetLength()), end = Math::Min(begin + chunk, points.GetLength());
+			const bool concurrent = context->ThreadCount > 1;
+
+			for (uint32 i = begin; i < end; ++i) {
+				const uint32 bucket = grid.bucketOf(grid.GetCell(Vector3(points.template Get<0>(i), points.template Get<1>(i), points.template Get<2>(i))));
+				grid.pointBuckets[i] = bucket;
+				if (concurrent) { AtomicFetchAdd(grid.bucketStarts[bucket], 1u, MemoryOrder::RELAXED); } else { ++grid.bucketStarts[bucket]; }
+			}
+
+			context->Barrier->ArriveAndWait(); // last thread to arrive runs the prefix sum
+
+			for (uint32 i = begin; i < end; ++i) {
+				const uint32 bucket = grid.pointBuckets[i];
+				const uint32 slot = (concurrent ? AtomicFetchAdd(grid.bucketStarts[bucket], ~0u, MemoryOrder::RELAXED) : grid.bucketStarts[bucket]--) - 1;
+				grid.indices[slot] = i; grid.xs[slot] = points.template Get<0>(i); grid.ys[slot] = points.template Get<1>(i); grid.zs[slot] = points.template Get<2>(i);
+			}
+		}
+
+		/**
+		 * \brief Visits every cell in the box, hands the points of it's bucket which pass inside and actually belong to that cell, so cells sharing a bucket aren't reported twice.
+		 * Falls back to testing every point when the box covers more cells than there are buckets.
+		 */
+		template<typename INSIDE, typename F>
+		uint32 visitCells(const Vector3 min, const Vector3 max, INSIDE&& inside, F&& onPoint) const {
+			if (!indices.GetLength()) { return 0; }
+
+			const GridCell first = GetCell(min), last = GetCell(max);
+			uint32 count = 0;
+
+			const uint64 cellCount = static_cast<uint64>(last.X - first.X + 1) * static_cast<uint64>(last.Y - first.Y + 1) * static_cast<uint64>(last.Z - first.Z + 1);
+			if (cellCount > bucketStarts.GetLength()) { // box spans more cells than there are buckets, every bucket would be visited anyway
+				for (uint32 i = 0; i < indices.GetLength(); ++i) { if (inside(i)) { onPoint(indices[i]); ++count; } }
+				return count;
+			}
+
+			for (int32 z = first.Z; z <= last.Z; ++z) {
+				for (int32 y = first.Y; y <= last.Y; ++y) {
+					for (int32 x = first.X; x <= last.X; ++x) {
+						const GridCell cell{ x, y, z };
+						const uint32 bucket = bucketOf(cell);
+
+						for (uint32 i = bucketStarts[bucket]; i < bucketStarts[bucket + 1]; ++i) {
+							if (inside(i) && GetCell(Vector3(xs[i], ys[i], zs[i])) == cell) { onPoint(indices[i]); ++count; }
+						}
+					}
+				}
+			}
+
+			return count;
+		}
+	};
+}
@@ -0,0 +1,491 @@
+#pragma once
+
+#include "GTSL/Core.h"
+#include "GTSL/Range.hpp"
+#include "GTSL/SIMD.hpp"
+#include "Math.hpp"
+
+#include <cmath>
+
+//Vectorized transcendental functions for SIMD<float32, 4/8/16>, plus range versions which run on the widest vector type the build targets.
+//Polynomials and range reductions are those of Cephes' single precision library, evaluated with fused multiply adds.
+
+namespace GTSL
+{
+	namespace Math
+	{
+		/**
+		 * \brief Precision tier of the vectorized functions.
+		 * FAST: shorter polynomials and range reductions, error below 1e-3(relative above 1, absolute below), around 3e-4 at worst.
+		 * STANDARD: within 2 ULP of the correctly rounded result over the documented ranges, 3 ULP for ArcTan2. SinCos has an absolute error below 1e-7.
+		 */
+		enum class Accuracy : uint8 {
+			FAST, STANDARD
+		};
+
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+		using VectorMathFloat = SIMD<float32, 16>;
+#elif defined(__AVX2__) && defined(__FMA__)
+		using VectorMathFloat = SIMD<float32, 8>;
+#else
+		using VectorMathFloat = SIMD<float32, 4>;
+#endif
+
+		/**
+		 * \brief Returns e^x. Results which would be below FLT_MIN are denormal or zero, results above FLT_MAX are infinity.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> Exp(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			const auto clamped = V::Min(V::Max(x, V(-104.0f)), V(89.0f));
+			const auto n = V::Floor(V::MultiplyAdd(clamped, V(1.44269504088896341f), V(0.5f)));
+			const auto r = V::MultiplyAdd(n, V(2.12194440e-4f), V::MultiplyAdd(n, V(-0.693359375f), clamped)); // x - n * ln(2), ln(2) split in two so n * high part is exact
+
+			V p;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(1.0f / 24.0f), r, V(1.0f / 6.0f)), r, V(0.5f)), r, V(1.0f)), r, V(1.0f));
+			} else {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(1.9875691500E-4f), r, V(1.3981999507E-3f)), r, V(8.3334519073E-3f)), r, V(4.1665795894E-2f)), r, V(1.6666665459E-1f)), r, V(5.0000001201E-1f));
+				p = V::MultiplyAdd(p, r * r, r + V(1.0f));
+			}
+
+			const auto half = V::Floor(n * V(0.5f)); // scale in two steps so 2^n never leaves the normal range while the result can
+			return V(x, V::Scale(V::Scale(p, half), n - half), x == x);
+		}
+
+		/**
+		 * \brief Returns 2^x. Results which would be below FLT_MIN are denormal or zero, results above FLT_MAX are infinity.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> Exp2(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			const auto clamped = V::Min(V::Max(x, V(-151.0f)), V(129.0f));
+			const auto n = V::Floor(clamped + V(0.5f));
+			const auto f = clamped - n;
+
+			V p;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(9.618129e-3f), f, V(5.550411e-2f)), f, V(2.402265e-1f)), f, V(6.931472e-1f));
+			} else {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(1.535336188319500E-4f), f, V(1.339887440266574E-3f)), f, V(9.618437357674640E-3f)), f, V(5.550332471162809E-2f)), f, V(2.402264791363012E-1f)), f, V(6.931472028550421E-1f));
+			}
+
+			p = V::MultiplyAdd(p, f, V(1.0f));
+
+			const auto half = V::Floor(n * V(0.5f));
+			return V(x, V::Scale(V::Scale(p, half), n - half), x == x);
+		}
+
+		/**
+		 * \brief Splits every element of x, which must be positive, into exponent and mantissa - 1, with the mantissa in [sqrt(2) / 2, sqrt(2)).
+		 */
+		template<uint8 N>
+		void splitLogarithm(SIMD<float32, N> x, SIMD<float32, N>& exponent, SIMD<float32, N>& fraction) {
+			using V = SIMD<float32, N>;
+
+			const auto denormal = x < V(1.17549435e-38f); // GetExponent and GetMantissa only take normal numbers, scale denormals up first
+			x = V(x, x * V(8388608.0f), denormal);
+
+			auto e = V(V::GetExponent(x), V::GetExponent(x) - V(23.0f), denormal);
+			auto m = V::GetMantissa(x);
+
+			const auto high = m > V(1.41421356237309504880f);
+			m = V(m, m * V(0.5f), high); e = V(e, e + V(1.0f), high);
+
+			exponent = e; fraction = m - V(1.0f);
+		}
+
+		/**
+		 * \brief Returns log(1 + f) - f for f in [sqrt(2) / 2 - 1, sqrt(2) - 1), the correction to add to f.
+		 */
+		template<Accuracy ACCURACY, uint8 N>
+		SIMD<float32, N> logarithmCorrection(const SIMD<float32, N> f) {
+			using V = SIMD<float32, N>;
+
+			const auto z = f * f;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				const auto s = f / (f + V(2.0f)), s2 = s * s; // log(1 + f) = 2 * atanh(f / (2 + f))
+				return V::MultiplyAdd(s + s, V::MultiplyAdd(V::MultiplyAdd(V(0.2f), s2, V(1.0f / 3.0f)), s2, V(1.0f)), -f);
+			} else {
+				auto p = V::MultiplyAdd(V(7.0376836292E-2f), f, V(-1.1514610310E-1f));
+				p = V::MultiplyAdd(p, f, V(1.1676998740E-1f)); p = V::MultiplyAdd(p, f, V(-1.2420140846E-1f));
+				p = V::MultiplyAdd(p, f, V(1.4249322787E-1f)); p = V::MultiplyAdd(p, f, V(-1.6668057665E-1f));
+				p = V::MultiplyAdd(p, f, V(2.0000714765E-1f)); p = V::MultiplyAdd(p, f, V(-2.4999993993E-1f));
+				p = V::MultiplyAdd(p, f, V(3.3333331174E-1f));
+				return V::MultiplyAdd(z, V(-0.5f), p * f * z);
+			}
+		}
+
+		/**
+		 * \brief Applies the special cases shared by the logarithms: log(0) = -infinity, log(infinity) = infinity, NaN for negative numbers and NaN.
+		 */
+		template<uint8 N>
+		SIMD<float32, N> logarithmSpecialCases(const SIMD<float32, N> x, SIMD<float32, N> result) {
+			using V = SIMD<float32, N>;
+
+			result = V(result, V(-INFINITY), x == V(0.0f));
+			result = V(result, x, x == V(INFINITY));
+			return V(V(NAN), result, x >= V(0.0f));
+		}
+
+		/**
+		 * \brief Returns the natural logarithm of x.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> Log(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			V e, f; splitLogarithm(x, e, f);
+
+			auto result = f + V::MultiplyAdd(e, V(-2.12194440e-4f), logarithmCorrection<ACCURACY>(f));
+			result = V::MultiplyAdd(e, V(0.693359375f), result); // e * ln(2), ln(2) split in two so e * high part is exact
+
+			return logarithmSpecialCases(x, result);
+		}
+
+		/**
+		 * \brief Returns the rounding error of p = a * b, exactly. Uses FMA where the vector has it, Dekker's product otherwise.
+		 */
+		template<uint8 N>
+		SIMD<float32, N> productError(const SIMD<float32, N> a, const SIMD<float32, N> b, const SIMD<float32, N> p) {
+			using V = SIMD<float32, N>;
+
+#if !defined(__FMA__)
+			if constexpr (N == 4) { // only the 128 bit vector is built without FMA, the wider ones always have it
+				const V SPLITTER(4097.0f); // 2^12 + 1, splits a float in to two halves whose products are exact
+
+				const auto aScaled = a * SPLITTER, aHigh = aScaled - (aScaled - a), aLow = a - aHigh;
+				const auto bScaled = b * SPLITTER, bHigh = bScaled - (bScaled - b), bLow = b - bHigh;
+
+				return (((aHigh * bHigh - p) + aHigh * bLow) + aLow * bHigh) + aLow * bLow;
+			}
+#endif
+
+			return V::MultiplyAdd(a, b, -p);
+		}
+
+		/**
+		 * \brief Returns log2(x) as the unevaluated sum high + low, with low carrying the bits high can't hold. Used for Power.
+		 */
+		template<uint8 N>
+		void extendedLog2(const SIMD<float32, N> x, SIMD<float32, N>& high, SIMD<float32, N>& low) {
+			using V = SIMD<float32, N>;
+			const V LOG2E_HIGH(1.44269502162933349609375f), LOG2E_LOW(1.925963033500011079013347625732421875e-8f);
+
+			V e, f; splitLogarithm(x, e, f);
+
+			const auto correction = logarithmCorrection<Accuracy::STANDARD>(f);
+			const auto r = f + correction, rLow = correction - (r - f); // log(1 + f) as r + rLow, |f| > |correction|
+
+			const auto t = r * LOG2E_HIGH;
+			const auto tLow = V::MultiplyAdd(r, LOG2E_LOW, V::MultiplyAdd(rLow, LOG2E_HIGH, productError(r, LOG2E_HIGH, t)));
+
+			high = e + t; // e is integral and either 0 or larger than |t|, so the error of this sum is exactly recoverable
+			low = (e - high) + t + tLow;
+		}
+
+		/**
+		 * \brief Returns the base 2 logarithm of x.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> Log2(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				V e, f; splitLogarithm(x, e, f);
+				return logarithmSpecialCases(x, V::MultiplyAdd(f + logarithmCorrection<ACCURACY>(f), V(1.44269504088896341f), e));
+			} else {
+				V high, low; extendedLog2(x, high, low);
+				return logarithmSpecialCases(x, high + low);
+			}
+		}
+
+		/**
+		 * \brief Returns x to the y, for non negative x. Negative bases return NaN, x ^ 0 returns 1.
+		 * For the standard tier the logarithm is carried with twice the precision, so the error stays within 2 ULP as long as the result is finite.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> Power(const SIMD<float32, N> x, const SIMD<float32, N> y) {
+			using V = SIMD<float32, N>;
+
+			V result;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				result = Exp2<ACCURACY>(y * Log2<ACCURACY>(x));
+			} else {
+				V high, low; extendedLog2(x, high, low);
+				high = logarithmSpecialCases(x, high);
+
+				const auto p = y * high;
+				auto pLow = V::MultiplyAdd(y, low, productError(y, high, p)); // rounding error of y * high plus y * low
+				pLow = V(V(0.0f), pLow, V::Abs(p) < V(256.0f)); // don't let infinities and NaNs of the product leak into the correction
+
+				result = Exp2<ACCURACY>(p) * V::MultiplyAdd(pLow, V(0.693147180559945309f), V(1.0f)); // 2^(p + pLow) = 2^p * (1 + pLow * ln(2))
+			}
+
+			return V(result, V(1.0f), y == V(0.0f));
+		}
+
+		/**
+		 * \brief Returns the arctangent of x in radians, in [-PI / 2, PI / 2].
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> ArcTangent(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			const auto sign = x & V(-0.0f);
+			const auto a = V::Abs(x);
+
+			const auto big = a > V(2.414213562373095f), middle = a > V(0.4142135623730950f); // tan(3 * PI / 8) and tan(PI / 8)
+			const auto t = V(V(a, (a - V(1.0f)) / (a + V(1.0f)), middle), V(-1.0f) / a, big);
+			const auto offset = V(V(V(0.0f), V(static_cast<float32>(PI / 4.0)), middle), V(static_cast<float32>(PI / 2.0)), big);
+
+			const auto z = t * t;
+
+			V p;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				p = V::MultiplyAdd(V(1.99777106478E-1f), z, V(-3.33329491539E-1f));
+			} else {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(8.05374449538e-2f), z, V(-1.38776856032E-1f)), z, V(1.99777106478E-1f)), z, V(-3.33329491539E-1f));
+			}
+
+			return (offset + V::MultiplyAdd(p * z, t, t)) ^ sign;
+		}
+
+		/**
+		 * \brief Returns the angle of the point (x, y) in radians, in [-PI, PI]. Returns y when both x and y are zero.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> ArcTan2(const SIMD<float32, N> y, const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			auto result = ArcTangent<ACCURACY>(y / x);
+			result = V(result, result + (V(static_cast<float32>(PI)) | (y & V(-0.0f))), x < V(0.0f)); // left half plane, move by PI towards the sign of y
+
+			return V(result, y, (x == V(0.0f)) & (y == V(0.0f)));
+		}
+
+		/**
+		 * \brief Evaluates asin for elements already reduced to [0, 0.5], z must be s * s.
+		 */
+		template<Accuracy ACCURACY, uint8 N>
+		SIMD<float32, N> arcSineKernel(const SIMD<float32, N> s, const SIMD<float32, N> z) {
+			using V = SIMD<float32, N>;
+
+			V p;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				p = V::MultiplyAdd(V::MultiplyAdd(V(4.5470025998E-2f), z, V(7.4953002686E-2f)), z, V(1.6666752422E-1f));
+			} else {
+				p = V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V::MultiplyAdd(V(4.2163199048E-2f), z, V(2.4181311049E-2f)), z, V(4.5470025998E-2f)), z, V(7.4953002686E-2f)), z, V(1.6666752422E-1f));
+			}
+
+			return V::MultiplyAdd(p * z, s, s);
+		}
+
+		/**
+		 * \brief Returns the arcsine of x in radians. Returns NaN outside [-1, 1].
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> ArcSine(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			const auto sign = x & V(-0.0f);
+			const auto a = V::Abs(x);
+			const auto big = a > V(0.5f); // asin(a) = PI / 2 - 2 * asin(sqrt((1 - a) / 2))
+
+			const auto z = V(a * a, V(0.5f) * (V(1.0f) - a), big);
+			const auto s = V(a, z.SquareRoot(), big);
+			const auto p = arcSineKernel<ACCURACY>(s, z);
+
+			return V(p, V(static_cast<float32>(PI / 2.0)) - (p + p), big) ^ sign;
+		}
+
+		/**
+		 * \brief Returns the arccosine of x in radians. Returns NaN outside [-1, 1].
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> ArcCosine(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			const auto a = V::Abs(x);
+			const auto big = a > V(0.5f); // acos(a) = 2 * asin(sqrt((1 - a) / 2)), acos(-a) = PI - acos(a)
+
+			const auto z = V(x * x, V(0.5f) * (V(1.0f) - a), big);
+			const auto s = V(x, z.SquareRoot(), big);
+			const auto p = arcSineKernel<ACCURACY>(s, z);
+
+			const auto bigResult = V(p + p, V(static_cast<float32>(PI)) - (p + p), x < V(0.0f));
+			return V(V(static_cast<float32>(PI / 2.0)) - p, bigResult, big);
+		}
+
+		/**
+		 * \brief Computes the sine and cosine of x, in radians, at once. The standard tier is accurate for |x| up to about 100000, the fast one up to about 1000.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		void SinCos(const SIMD<float32, N> x, SIMD<float32, N>& sine, SIMD<float32, N>& cosine) {
+			using V = SIMD<float32, N>;
+
+			const auto q = V::Floor(V::MultiplyAdd(x, V(static_cast<float32>(2.0 / PI)), V(0.5f))); // nearest multiple of PI / 2
+			const auto k = q - V(4.0f) * V::Floor(q * V(0.25f)); // quadrant, 0 to 3
+
+			V r, s, c;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				r = V::MultiplyAdd(q, V(-4.8382679e-4f), V::MultiplyAdd(q, V(-1.5703125f), x));
+			} else {
+				r = V::MultiplyAdd(q, V(-1.5703125f), x); // PI / 2 split in three so the first two products are exact
+				r = V::MultiplyAdd(q, V(-4.837512969970703125E-4f), r);
+				r = V::MultiplyAdd(q, V(-7.54978995489188216E-8f), r);
+			}
+
+			const auto r2 = r * r;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				s = V::MultiplyAdd(V(8.3321608736E-3f), r2, V(-1.6666654611E-1f));
+				c = V::MultiplyAdd(V(-1.388731625493765E-3f), r2, V(4.166664568298827E-2f));
+			} else {
+				s = V::MultiplyAdd(V::MultiplyAdd(V(-1.9515295891E-4f), r2, V(8.3321608736E-3f)), r2, V(-1.6666654611E-1f));
+				c = V::MultiplyAdd(V::MultiplyAdd(V(2.443315711809948E-5f), r2, V(-1.388731625493765E-3f)), r2, V(4.166664568298827E-2f));
+			}
+
+			s = V::MultiplyAdd(s * r2, r, r);
+			c = V::MultiplyAdd(c * r2, r2, V::MultiplyAdd(r2, V(-0.5f), V(1.0f)));
+
+			const auto swap = (k == V(1.0f)) | (k == V(3.0f));
+			const auto sineSign = (k >= V(2.0f)) & V(-0.0f), cosineSign = ((k == V(1.0f)) | (k == V(2.0f))) & V(-0.0f);
+
+			sine = V(s, c, swap) ^ sineSign;
+			cosine = V(c, s, swap) ^ cosineSign;
+		}
+
+		/**
+		 * \brief Returns 1 / sqrt(x). The fast tier uses the hardware estimate.
+		 */
+		template<Accuracy ACCURACY = Accuracy::STANDARD, uint8 N>
+		SIMD<float32, N> ReciprocalSquareRoot(const SIMD<float32, N> x) {
+			using V = SIMD<float32, N>;
+
+			if constexpr (ACCURACY == Accuracy::FAST) {
+				return x.ReciprocalSquareRootEstimate();
+			} else {
+				return V(1.0f) / x.SquareRoot();
+			}
+		}
+
+		/**
+		 * \brief Runs function over every element of the input ranges, VectorMathFloat::ElementCount elements at a time.
+		 * Ranges can have any alignment, elements before the first aligned output element and after the last full vector are padded into a vector of their own,
+		 * so every element goes through the same code and gets the same result regardless of it's position.
+		 * \param function Called with an array of INPUTS vectors to read and an array of OUTPUTS vectors to write.
+		 */
+		template<uint32 INPUTS, uint32 OUTPUTS, typename F>
+		void vectorMathBatch(const uint64 length, const float32* const (&inputs)[INPUTS], float32* const (&outputs)[OUTPUTS], F&& function) {
+			using V = VectorMathFloat;
+			constexpr uint64 VECTOR_BYTES = sizeof(float32) * V::ElementCount;
+
+			auto partial = [&](const uint64 start, const uint64 count) {
+				alignas(64) float32 buffer[INPUTS > OUTPUTS ? INPUTS : OUTPUTS][V::ElementCount];
+				V in[INPUTS], out[OUTPUTS];
+
+				for (uint32 k = 0; k < INPUTS; ++k) {
+					for (uint64 j = 0; j < V::ElementCount; ++j) { buffer[k][j] = j < count ? inputs[k][start + j] : 0.5f; } // 0.5 is in the domain of every function
+					in[k] = V(UnalignedPointer<const float32>(buffer[k]));
+				}
+
+				function(in, out);
+
+				for (uint32 k = 0; k < OUTPUTS; ++k) {
+					out[k].CopyTo(UnalignedPointer<float32>(buffer[k]));
+					for (uint64 j = 0; j < count; ++j) { outputs[k][start + j] = buffer[k][j]; }
+				}
+			};
+
+			uint64 i = (VECTOR_BYTES - reinterpret_cast<uint64>(outputs[0]) % VECTOR_BYTES) % VECTOR_BYTES / sizeof(float32); // elements until the first output is aligned
+			i = i < length ? i : length;
+
+			if (i) { partial(0, i); }
+
+			for (; i + V::ElementCount <= length; i += V::ElementCount) {
+				V in[INPUTS], out[OUTPUTS];
+				for (uint32 k = 0; k < INPUTS; ++k) { in[k] = V(UnalignedPointer<const float32>(inputs[k] + i)); }
+				function(in, out);
+				for (uint32 k = 0; k < OUTPUTS; ++k) { out[k].CopyTo(UnalignedPointer<float32>(outputs[k] + i)); }
+			}
+
+			if (i < length) { partial(i, length - i); }
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void Exp(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = Exp<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void Exp2(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = Exp2<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void Log(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = Log<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void Log2(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = Log2<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void Power(Range<const float32*> x, Range<const float32*> y, Range<float32*> results) {
+			GTSL_ASSERT(y.ElementCount() == x.ElementCount() && results.ElementCount() >= x.ElementCount(), "Ranges must have the same length.")
+			vectorMathBatch(x.ElementCount(), { x.begin(), y.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = Power<ACCURACY>(in[0], in[1]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void ArcTangent(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = ArcTangent<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void ArcTan2(Range<const float32*> y, Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(y.ElementCount() == x.ElementCount() && results.ElementCount() >= x.ElementCount(), "Ranges must have the same length.")
+			vectorMathBatch(x.ElementCount(), { y.begin(), x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = ArcTan2<ACCURACY>(in[0], in[1]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void ArcSine(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = ArcSine<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void ArcCosine(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = ArcCosine<ACCURACY>(in[0]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void SinCos(Range<const float32*> x, Range<float32*> sines, Range<float32*> cosines) {
+			GTSL_ASSERT(sines.ElementCount() >= x.ElementCount() && cosines.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { sines.begin(), cosines.begin() }, [](const auto& in, auto& out) { SinCos<ACCURACY>(in[0], out[0], out[1]); });
+		}
+
+		template<Accuracy ACCURACY = Accuracy::STANDARD>
+		void ReciprocalSquareRoot(Range<const float32*> x, Range<float32*> results) {
+			GTSL_ASSERT(results.ElementCount() >= x.ElementCount(), "Results range is too small.")
+			vectorMathBatch(x.ElementCount(), { x.begin() }, { results.begin() }, [](const auto& in, auto& out) { out[0] = ReciprocalSquareRoot<ACCURACY>(in[0]); });
+		}
+	}
+}
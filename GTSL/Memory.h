@@ -62,15 +62,15 @@ namespace GTSL
 		GTSL_ASSERT(size % 128 == 0, "Not perfect");
 		__m256i vector[4];
 		for (uint64 i = 0; i < size / 128ull; ++i) {
-			vector[0] = _mm256_loadu_epi8(static_cast<const byte*>(from) + (i * 128));
-			vector[1] = _mm256_loadu_epi8(static_cast<const byte*>(from) + (i * 128) + 32);
-			vector[2] = _mm256_loadu_epi8(static_cast<const byte*>(from) + (i * 128) + 64);
-			vector[3] = _mm256_loadu_epi8(static_cast<const byte*>(from) + (i * 128) + 128);
-
-			_mm256_storeu_epi8(static_cast<byte*>(to) + (i * 128), vector[0]);
-			_mm256_storeu_epi8(static_cast<byte*>(to) + (i * 128) + 32, vector[1]);
-			_mm256_storeu_epi8(static_cast<byte*>(to) + (i * 128) + 64, vector[2]);
-			_mm256_storeu_epi8(static_cast<byte*>(to) + (i * 128) + 128, vector[3]);
+			vector[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const byte*>(from) + (i * 128)));
+			vector[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const byte*>(from) + (i * 128) + 32));
+			vector[2] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const byte*>(from) + (i * 128) + 64));
+			vector[3] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const byte*>(from) + (i * 128) + 96));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<byte*>(to) + (i * 128)), vector[0]);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<byte*>(to) + (i * 128) + 32), vector[1]);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<byte*>(to) + (i * 128) + 64), vector[2]);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(static_cast<byte*>(to) + (i * 128) + 96), vector[3]);
 		}
 	}
 
@@ -0,0 +1,467 @@
+#pragma once
+
+#include "Core.h"
+#include "NumberConversionTables.hpp"
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace GTSL
+{
+	//Digits "00" to "99", formatting writes two digits per division.
+	inline constexpr char8_t DIGIT_PAIRS[201] = u8"00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+	inline uint64 multiply64(const uint64 a, const uint64 b, uint64& high) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _umul128(a, b, &high);
+#else
+		const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+		high = static_cast<uint64>(product >> 64);
+		return static_cast<uint64>(product);
+#endif
+	}
+
+	//Loads 8 characters as a little endian integer, first character in the lowest byte.
+	inline uint64 loadEightCharacters(const char8_t* characters) { uint64 chunk; std::memcpy(&chunk, characters, 8); return chunk; }
+
+	//Whether every byte of chunk is an ASCII digit, adding 6 carries every byte above '9' in to the high nibble.
+	inline bool isEightDigits(const uint64 chunk) {
+		return !(((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ^ 0x3333333333333333);
+	}
+
+	//Converts 8 ASCII digits, as loaded by loadEightCharacters, in 3 multiplications by combining pairs, then quads, then the two halves.
+	inline uint32 parseEightDigits(uint64 chunk) {
+		constexpr uint64 MASK = 0x000000FF000000FF, MUL1 = 0x000F424000000064 /*100 + (1000000 << 32)*/, MUL2 = 0x0000271000000001 /*1 + (10000 << 32)*/;
+		chunk -= 0x3030303030303030;
+		chunk = (chunk * 10) + (chunk >> 8);
+		return static_cast<uint32>((((chunk & MASK) * MUL1) + (((chunk >> 16) & MASK) * MUL2)) >> 32);
+	}
+
+	inline bool isDigit(const char8_t character) { return static_cast<uint8>(character - u8'0') < 10; }
+
+	/**
+	 * \brief Parses an optionally signed decimal integer at the start of [begin, end), 8 digits at a time.
+	 * \return Pointer past the last digit, nullptr if there are no digits, the value doesn't fit in T or T is unsigned and there's a minus sign.
+	 */
+	template<std::integral T>
+	const char8_t* ParseInteger(const char8_t* begin, const char8_t* const end, T& value) {
+		const char8_t* c = begin;
+		bool negative = false;
+
+		if (c < end && *c == u8'-') {
+			if constexpr (std::is_signed_v<T>) { negative = true; ++c; } else { return nullptr; }
+		} else if (c < end && *c == u8'+') {
+			++c;
+		}
+
+		const char8_t* const digits = c;
+		while (c < end && *c == u8'0') { ++c; }
+		const char8_t* const significant = c;
+
+		uint64 magnitude = 0;
+
+		while (end - c >= 8) {
+			const uint64 chunk = loadEightCharacters(c);
+			if (!isEightDigits(chunk)) { break; }
+			magnitude = magnitude * 100000000 + parseEightDigits(chunk); c += 8;
+		}
+
+		for (; c < end && isDigit(*c); ++c) { magnitude = magnitude * 10 + (*c - u8'0'); }
+
+		if (c == digits) { return nullptr; }
+
+		const int64 significantDigits = c - significant;
+		// 20 digit values can only have wrapped if they are above 1.8e19, they start with a 1 so what's left after wrapping is below 1e19
+		if (significantDigits > 20 || (significantDigits == 20 && (*significant != u8'1' || magnitude < 10000000000000000000ull))) { return nullptr; }
+
+		if constexpr (std::is_signed_v<T>) {
+			if (magnitude > static_cast<uint64>(std::numeric_limits<T>::max()) + negative) { return nullptr; }
+			value = static_cast<T>(negative ? 0 - magnitude : magnitude);
+		} else {
+			if (magnitude > static_cast<uint64>(std::numeric_limits<T>::max())) { return nullptr; }
+			value = static_cast<T>(magnitude);
+		}
+
+		return c;
+	}
+
+	template<typename T>
+	struct floatFormat;
+
+	template<>
+	struct floatFormat<float32> {
+		using Bits = uint32;
+		static constexpr int32 MANTISSA_BITS = 23, EXPONENT_BIAS = 127, INFINITE_POWER = 0xFF;
+		static constexpr int32 SMALLEST_POWER_OF_TEN = -65, LARGEST_POWER_OF_TEN = 38, MIN_ROUND_TO_EVEN = -17, MAX_ROUND_TO_EVEN = 10;
+		static constexpr int32 MAX_EXACT_POWER_OF_TEN = 10; static constexpr uint64 MAX_EXACT_MANTISSA = 1ull << 24;
+		static constexpr float32 EXACT_POWERS_OF_TEN[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+	};
+
+	template<>
+	struct floatFormat<float64> {
+		using Bits = uint64;
+		static constexpr int32 MANTISSA_BITS = 52, EXPONENT_BIAS = 1023, INFINITE_POWER = 0x7FF;
+		static constexpr int32 SMALLEST_POWER_OF_TEN = -342, LARGEST_POWER_OF_TEN = 308, MIN_ROUND_TO_EVEN = -4, MAX_ROUND_TO_EVEN = 23;
+		static constexpr int32 MAX_EXACT_POWER_OF_TEN = 22; static constexpr uint64 MAX_EXACT_MANTISSA = 1ull << 53;
+		static constexpr float64 EXACT_POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	};
+
+	/**
+	 * \brief Eisel-Lemire: rounds w * 10^q to T with one, rarely two, 64x64 bit multiplications against a truncated 128 bit power of five.
+	 * \param power2 Biased binary exponent of the result, -1 if the approximation can't decide the rounding.
+	 * \return Mantissa of the result, without the implicit bit.
+	 */
+	template<typename T>
+	uint64 eiselLemire(const int64 q, uint64 w, int32& power2) {
+		using F = floatFormat<T>;
+
+		if (w == 0 || q < F::SMALLEST_POWER_OF_TEN) { power2 = 0; return 0; }
+		if (q > F::LARGEST_POWER_OF_TEN) { power2 = F::INFINITE_POWER; return 0; }
+
+		const int32 leadingZeros = std::countl_zero(w);
+		w <<= leadingZeros;
+
+		const uint64* const power = POWERS_OF_FIVE_128 + 2 * (q + 342);
+		uint64 high; uint64 low = multiply64(w, power[0], high);
+
+		constexpr uint64 PRECISION_MASK = ~0ull >> (F::MANTISSA_BITS + 3);
+		if ((high & PRECISION_MASK) == PRECISION_MASK) { // the truncated low word of the power could carry in to the bits kept, add it's contribution
+			uint64 secondHigh; multiply64(w, power[1], secondHigh);
+			low += secondHigh;
+			if (secondHigh > low) { ++high; }
+		}
+
+		if (low == ~0ull && (q < -27 || q > 55)) { power2 = -1; return 0; } // the power of five isn't exact there, can't tell which way it rounds
+
+		const int32 upperBit = static_cast<int32>(high >> 63);
+		const int32 shift = upperBit + 64 - F::MANTISSA_BITS - 3;
+		uint64 mantissa = high >> shift;
+		power2 = static_cast<int32>((((152170 + 65536) * q) >> 16) + 63) + upperBit - leadingZeros + F::EXPONENT_BIAS; // floor(log2(10^q)) + 63 + bias
+
+		if (power2 <= 0) { // subnormal
+			if (-power2 + 1 >= 64) { power2 = 0; return 0; }
+			mantissa >>= -power2 + 1;
+			mantissa += mantissa & 1; mantissa >>= 1;
+			power2 = mantissa < (1ull << F::MANTISSA_BITS) ? 0 : 1;
+			return mantissa & ~(1ull << F::MANTISSA_BITS);
+		}
+
+		// exactly halfway between two floats, only possible for small q where the product is exact, round to even
+		if (low <= 1 && q >= F::MIN_ROUND_TO_EVEN && q <= F::MAX_ROUND_TO_EVEN && (mantissa & 3) == 1 && (mantissa << shift) == high) { mantissa &= ~1ull; }
+
+		mantissa += mantissa & 1; mantissa >>= 1;
+
+		if (mantissa >= (2ull << F::MANTISSA_BITS)) { mantissa = 1ull << F::MANTISSA_BITS; ++power2; }
+
+		mantissa &= ~(1ull << F::MANTISSA_BITS);
+		if (power2 >= F::INFINITE_POWER) { power2 = F::INFINITE_POWER; mantissa = 0; }
+
+		return mantissa;
+	}
+
+	/**
+	 * \brief Parses a decimal floating point number, optionally signed and with a fraction and exponent, at the start of [begin, end). Correctly rounded.
+	 * Up to 19 significant digits are read 8 at a time in to an integer, which is scaled exactly when it and the power of ten fit in the mantissa(Clinger's fast path)
+	 * and by Eisel-Lemire otherwise. Longer inputs Eisel-Lemire can't round fall back to std::from_chars.
+	 * \return Pointer past the number, nullptr if there is no number at begin.
+	 */
+	template<std::floating_point T>
+	const char8_t* ParseFloat(const char8_t* begin, const char8_t* const end, T& value) {
+		using F = floatFormat<T>;
+
+		const char8_t* c = begin;
+		bool negative = false;
+
+		if (c < end && (*c == u8'-' || *c == u8'+')) { negative = *c == u8'-'; ++c; }
+
+		const char8_t* const integerBegin = c;
+		uint64 w = 0;
+
+		while (end - c >= 8) {
+			const uint64 chunk = loadEightCharacters(c);
+			if (!isEightDigits(chunk)) { break; }
+			w = w * 100000000 + parseEightDigits(chunk); c += 8;
+		}
+
+		for (; c < end && isDigit(*c); ++c) { w = w * 10 + (*c - u8'0'); }
+
+		const char8_t* const integerEnd = c;
+		const char8_t* fractionBegin = c; const char8_t* fractionEnd = c;
+		int64 exponent = 0;
+
+		if (c < end && *c == u8'.') {
+			fractionBegin = ++c;
+
+			while (end - c >= 8) {
+				const uint64 chunk = loadEightCharacters(c);
+				if (!isEightDigits(chunk)) { break; }
+				w = w * 100000000 + parseEightDigits(chunk); c += 8;
+			}
+
+			for (; c < end && isDigit(*c); ++c) { w = w * 10 + (*c - u8'0'); }
+
+			fractionEnd = c;
+			exponent = fractionBegin - fractionEnd;
+		}
+
+		int64 digitCount = (integerEnd - integerBegin) + (fractionEnd - fractionBegin);
+		if (!digitCount) { return nullptr; }
+
+		if (c < end && (*c == u8'e' || *c == u8'E')) { // only part of the number if digits follow
+			const char8_t* e = c + 1;
+			bool negativeExponent = false;
+			if (e < end && (*e == u8'-' || *e == u8'+')) { negativeExponent = *e == u8'-'; ++e; }
+
+			if (e < end && isDigit(*e)) {
+				int64 explicitExponent = 0;
+				for (; e < end && isDigit(*e); ++e) { if (explicitExponent < 0x10000) { explicitExponent = explicitExponent * 10 + (*e - u8'0'); } }
+				exponent += negativeExponent ? -explicitExponent : explicitExponent;
+				c = e;
+			}
+		}
+
+		bool truncated = false;
+
+		if (digitCount > 19) { // w wrapped, recount without leading zeros and keep the first 19 significant digits
+			for (const char8_t* d = integerBegin; d < fractionEnd && (*d == u8'0' || *d == u8'.'); ++d) { digitCount -= *d == u8'0'; }
+
+			if (digitCount > 19) {
+				truncated = true; w = 0;
+				const int64 explicitExponent = exponent + (fractionEnd - fractionBegin);
+				const char8_t* d = integerBegin;
+
+				for (; w < 1000000000000000000ull && d < integerEnd; ++d) { w = w * 10 + (*d - u8'0'); }
+
+				if (w >= 1000000000000000000ull) {
+					exponent = (integerEnd - d) + explicitExponent;
+				} else {
+					for (d = fractionBegin; w < 1000000000000000000ull && d < fractionEnd; ++d) { w = w * 10 + (*d - u8'0'); }
+					exponent = (fractionBegin - d) + explicitExponent;
+				}
+			}
+		}
+
+		if (!truncated && exponent >= -F::MAX_EXACT_POWER_OF_TEN && exponent <= F::MAX_EXACT_POWER_OF_TEN && w <= F::MAX_EXACT_MANTISSA) {
+			T result = static_cast<T>(w);
+			result = exponent < 0 ? result / F::EXACT_POWERS_OF_TEN[-exponent] : result * F::EXACT_POWERS_OF_TEN[exponent];
+			value = negative ? -result : result;
+			return c;
+		}
+
+		int32 power2;
+		uint64 mantissa = eiselLemire<T>(exponent, w, power2);
+
+		if (truncated && power2 >= 0) { // the dropped digits lie between w and w + 1, both must round the same
+			int32 upperPower2; const uint64 upperMantissa = eiselLemire<T>(exponent, w + 1, upperPower2);
+			if (upperPower2 != power2 || upperMantissa != mantissa) { power2 = -1; }
+		}
+
+		if (power2 < 0) {
+			const char8_t* const number = begin < end && *begin == u8'+' ? begin + 1 : begin; // from_chars rejects plus signs
+			std::from_chars(reinterpret_cast<const char*>(number), reinterpret_cast<const char*>(c), value);
+			return c;
+		}
+
+		using Bits = typename F::Bits;
+		value = std::bit_cast<T>(static_cast<Bits>(mantissa | static_cast<uint64>(power2) << F::MANTISSA_BITS | static_cast<uint64>(negative) << (sizeof(T) * 8 - 1)));
+		return c;
+	}
+
+	/**
+	 * \brief Writes the decimal digits of value so they end right before end, two per division.
+	 * \return Number of digits written.
+	 */
+	inline uint32 formatDigitsBackwards(uint64 value, char8_t* end) {
+		char8_t* c = end;
+
+		while (value >= 100) {
+			const uint64 pair = (value % 100) * 2; value /= 100;
+			*--c = DIGIT_PAIRS[pair + 1]; *--c = DIGIT_PAIRS[pair];
+		}
+
+		if (value >= 10) { *--c = DIGIT_PAIRS[value * 2 + 1]; *--c = DIGIT_PAIRS[value * 2]; } else { *--c = static_cast<char8_t>(u8'0' + value); }
+
+		return static_cast<uint32>(end - c);
+	}
+
+	/**
+	 * \brief Formats an integer in decimal.
+	 * \param buffer Must have room for 20 characters.
+	 * \return Number of characters written.
+	 */
+	template<std::integral T>
+	uint32 FormatInteger(const T value, char8_t* buffer) {
+		char8_t digits[20];
+		uint64 magnitude = static_cast<uint64>(value); uint32 length = 0;
+
+		if constexpr (std::is_signed_v<T>) {
+			if (value < 0) { magnitude = 0 - magnitude; buffer[length++] = u8'-'; }
+		}
+
+		const uint32 count = formatDigitsBackwards(magnitude, digits + 20);
+		std::memcpy(buffer + length, digits + 20 - count, count);
+		return length + count;
+	}
+
+	inline uint64 mulShift64(const uint64 m, const uint64* const multiplier, const int32 shift) { // (m * multiplier) >> shift, shift in [64, 128)
+		uint64 high0; multiply64(m, multiplier[0], high0);
+		uint64 high1; uint64 low1 = multiply64(m, multiplier[1], high1);
+		low1 += high0; high1 += low1 < high0;
+		const int32 distance = shift - 64;
+		return distance ? (high1 << (64 - distance)) | (low1 >> distance) : low1;
+	}
+
+	inline bool multipleOfPowerOf5(uint64 value, const uint32 p) {
+		uint32 count = 0;
+		while (value && value % 5 == 0) { value /= 5; ++count; }
+		return count >= p;
+	}
+
+	inline bool multipleOfPowerOf2(const uint64 value, const uint32 p) { return p >= 64 ? !value : !(value & ((1ull << p) - 1)); }
+
+	/**
+	 * \brief Ryu(Ulf Adams, 2018): finds the shortest decimal digits, the closest to the exact value on ties, which lie strictly inside the interval rounding to the float.
+	 * Written for binary64 but the tables are exact enough for any narrower mantissa, binary32 uses it unchanged.
+	 * \param digits Decimal significand of the result.
+	 * \param exponent Power of ten digits are scaled by.
+	 */
+	inline void shortestDecimal(const uint64 ieeeMantissa, const uint32 ieeeExponent, const int32 mantissaBits, const int32 bias, uint64& digits, int32& exponent) {
+		auto pow5Bits = [](const int32 e) { return static_cast<int32>((static_cast<uint32>(e) * 1217359) >> 19) + 1; };
+		auto log10Pow2 = [](const int32 e) { return static_cast<int32>((static_cast<uint32>(e) * 78913) >> 18); };
+		auto log10Pow5 = [](const int32 e) { return static_cast<int32>((static_cast<uint32>(e) * 732923) >> 20); };
+
+		int32 e2; uint64 m2;
+		if (ieeeExponent == 0) { e2 = 1 - bias - mantissaBits - 2; m2 = ieeeMantissa; } else { e2 = static_cast<int32>(ieeeExponent) - bias - mantissaBits - 2; m2 = (1ull << mantissaBits) | ieeeMantissa; }
+
+		const bool acceptBounds = (m2 & 1) == 0; // ties to even means the interval bounds round to this float too
+		const uint64 mv = 4 * m2; // interval center, bounds at mv + 2 and mv - 1 - mmShift in the same scale
+		const uint32 mmShift = ieeeMantissa != 0 || ieeeExponent <= 1; // the lower neighbour is closer at powers of two
+
+		uint64 vr, vp, vm; int32 e10;
+		bool vmIsTrailingZeros = false, vrIsTrailingZeros = false;
+
+		if (e2 >= 0) {
+			const int32 q = log10Pow2(e2) - (e2 > 3);
+			e10 = q;
+			const int32 k = 125 + pow5Bits(q) - 1;
+			const int32 i = -e2 + q + k;
+			const uint64* const multiplier = POWERS_OF_FIVE_INVERSE_125 + 2 * q;
+			vr = mulShift64(4 * m2, multiplier, i); vp = mulShift64(4 * m2 + 2, multiplier, i); vm = mulShift64(4 * m2 - 1 - mmShift, multiplier, i);
+
+			if (q <= 21) { // only one of mp, mv and mm can be a multiple of 5, if any
+				if (mv % 5 == 0) { vrIsTrailingZeros = multipleOfPowerOf5(mv, q); }
+				else if (acceptBounds) { vmIsTrailingZeros = multipleOfPowerOf5(mv - 1 - mmShift, q); }
+				else { vp -= multipleOfPowerOf5(mv + 2, q); }
+			}
+		} else {
+			const int32 q = log10Pow5(-e2) - (-e2 > 1);
+			e10 = q + e2;
+			const int32 i = -e2 - q;
+			const int32 k = pow5Bits(i) - 125;
+			const int32 j = q - k;
+			const uint64* const multiplier = POWERS_OF_FIVE_125 + 2 * i;
+			vr = mulShift64(4 * m2, multiplier, j); vp = mulShift64(4 * m2 + 2, multiplier, j); vm = mulShift64(4 * m2 - 1 - mmShift, multiplier, j);
+
+			if (q <= 1) { // mv has at least q trailing 0 bits, so vr is exact
+				vrIsTrailingZeros = true;
+				if (acceptBounds) { vmIsTrailingZeros = mmShift == 1; } else { --vp; }
+			} else if (q < 63) {
+				vrIsTrailingZeros = multipleOfPowerOf2(mv, q);
+			}
+		}
+
+		int32 removed = 0; uint8 lastRemovedDigit = 0;
+
+		if (vmIsTrailingZeros || vrIsTrailingZeros) { // rare, track whether the removed digits were all zero to break ties exactly
+			while (vp / 10 > vm / 10) {
+				vmIsTrailingZeros &= vm % 10 == 0; vrIsTrailingZeros &= lastRemovedDigit == 0;
+				lastRemovedDigit = static_cast<uint8>(vr % 10);
+				vr /= 10; vp /= 10; vm /= 10; ++removed;
+			}
+
+			if (vmIsTrailingZeros) {
+				while (vm % 10 == 0) {
+					vrIsTrailingZeros &= lastRemovedDigit == 0;
+					lastRemovedDigit = static_cast<uint8>(vr % 10);
+					vr /= 10; vp /= 10; vm /= 10; ++removed;
+				}
+			}
+
+			if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0) { lastRemovedDigit = 4; } // exactly halfway, round to even
+
+			digits = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+		} else {
+			bool roundUp = false;
+
+			while (vp / 10 > vm / 10) {
+				roundUp = vr % 10 >= 5;
+				vr /= 10; vp /= 10; vm /= 10; ++removed;
+			}
+
+			digits = vr + (vr == vm || roundUp);
+		}
+
+		exponent = e10 + removed;
+	}
+
+	/**
+	 * \brief Formats a float with the fewest digits which parse back to the same value.
+	 * Plain notation is used when the decimal point falls within 21 digits of the first one and up to 6 zeros before it, scientific(1.5e-7) otherwise, like JavaScript.
+	 * Infinities are written as inf and -inf and NaNs as nan.
+	 * \param buffer Must have room for 32 characters.
+	 * \return Number of characters written.
+	 */
+	template<std::floating_point T>
+	uint32 FormatFloat(const T value, char8_t* buffer) {
+		using F = floatFormat<T>;
+		using Bits = typename F::Bits;
+
+		const Bits bits = std::bit_cast<Bits>(value);
+		const uint64 ieeeMantissa = bits & ((Bits(1) << F::MANTISSA_BITS) - 1);
+		const uint32 ieeeExponent = static_cast<uint32>(bits >> F::MANTISSA_BITS) & F::INFINITE_POWER;
+		uint32 length = 0;
+
+		if (ieeeExponent == F::INFINITE_POWER && ieeeMantissa) { std::memcpy(buffer, u8"nan", 3); return 3; }
+		if (bits >> (sizeof(T) * 8 - 1)) { buffer[length++] = u8'-'; }
+		if (ieeeExponent == F::INFINITE_POWER) { std::memcpy(buffer + length, u8"inf", 3); return length + 3; }
+		if (!ieeeExponent && !ieeeMantissa) { buffer[length++] = u8'0'; return length; }
+
+		uint64 decimal; int32 exponent;
+		shortestDecimal(ieeeMantissa, ieeeExponent, F::MANTISSA_BITS, F::EXPONENT_BIAS, decimal, exponent);
+
+		char8_t digits[20];
+		const int32 count = static_cast<int32>(formatDigitsBackwards(decimal, digits + 20));
+		const char8_t* const first = digits + 20 - count;
+		const int32 point = count + exponent; // digits before the decimal point
+
+		if (exponent >= 0 && point <= 21) { // integer
+			std::memcpy(buffer + length, first, count); length += count;
+			for (int32 i = 0; i < exponent; ++i) { buffer[length++] = u8'0'; }
+		} else if (point > 0 && point <= 21) {
+			std::memcpy(buffer + length, first, point); length += point;
+			buffer[length++] = u8'.';
+			std::memcpy(buffer + length, first + point, count - point); length += count - point;
+		} else if (point > -6 && point <= 0) {
+			buffer[length++] = u8'0'; buffer[length++] = u8'.';
+			for (int32 i = point; i < 0; ++i) { buffer[length++] = u8'0'; }
+			std::memcpy(buffer + length, first, count); length += count;
+		} else {
+			buffer[length++] = first[0];
+			if (count > 1) { buffer[length++] = u8'.'; std::memcpy(buffer + length, first + 1, count - 1); length += count - 1; }
+			buffer[length++] = u8'e';
+			const int32 scientificExponent = point - 1;
+			if (scientificExponent < 0) { buffer[length++] = u8'-'; }
+			length += FormatInteger(static_cast<uint32>(scientificExponent < 0 ? -scientificExponent : scientificExponent), buffer + length);
+		}
+
+		return length;
+	}
+}
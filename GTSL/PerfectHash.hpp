@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Core.h"
+#include "Hashing.hpp"
+#include "Result.h"
+#include "StringCommon.h"
+
+#include <type_traits>
+
+namespace GTSL
+{
+	// Not constexpr, so reaching one while building a table at compile time fails the build with the problem in the error.
+	inline void perfectHashDuplicateKey() {}
+	inline void perfectHashNoDisplacement() {}
+
+	template<typename I>
+	concept PerfectHashInteger = std::integral<I> || std::is_enum_v<I>;
+
+	/**
+	 * \brief Minimal perfect hash over a set of keys known at compile time, built entirely during constant evaluation so it costs nothing at run time.
+	 * Maps every key to it's index in the list it was built from with one hash, two table reads and one comparison, without probing or loops.
+	 * Strings are hashed like Id64, integers and enums are spread with MixHash. Only the hash of every key is kept, like HashMap does, so keys are matched by hash.
+	 * Built with hash and displace: keys are split in to N / 2 + 1 buckets and every bucket, largest first, gets the smallest displacement which sends all of it's keys to free slots.
+	 * Constructors are consteval, so a key set no displacement can place, or a duplicate key, fails the build instead of searching at run time.
+	 * \tparam N Number of keys.
+	 */
+	template<uint32 N>
+	class PerfectHashTable {
+	public:
+		consteval PerfectHashTable(const StringView (&keys)[N]) {
+			uint64 keyHashes[N] = {};
+			for (uint32 i = 0; i < N; ++i) { keyHashes[i] = Hash(keys[i]); }
+			build(keyHashes);
+		}
+
+		template<PerfectHashInteger I>
+		consteval PerfectHashTable(const I (&keys)[N]) {
+			uint64 keyHashes[N] = {};
+			for (uint32 i = 0; i < N; ++i) { keyHashes[i] = hashInteger(keys[i]); }
+			build(keyHashes);
+		}
+
+		/**
+		 * \return Index of key in the list the table was built from.
+		 */
+		[[nodiscard]] constexpr Result<uint32> Find(const StringView key) const { return find(Hash(key)); }
+
+		template<PerfectHashInteger I>
+		[[nodiscard]] constexpr Result<uint32> Find(const I key) const { return find(hashInteger(key)); }
+
+		[[nodiscard]] static constexpr uint32 GetLength() { return N; }
+
+	private:
+		static constexpr uint32 BUCKETS = N / 2 + 1, MAX_DISPLACEMENT = 1u << 20;
+
+		uint64 hashes[N] = {}; // key hash in every slot
+		uint32 indices[N] = {}; // key index in every slot
+		uint32 displacements[BUCKETS] = {};
+
+		template<PerfectHashInteger I>
+		static constexpr uint64 hashInteger(const I key) { return MixHash(static_cast<uint64>(key)); }
+
+		// buckets come from the high half of the hash, slots from a rehash, so keys sharing a bucket still scatter
+		static constexpr uint32 bucketOf(const uint64 hash) { return static_cast<uint32>((hash >> 32) * BUCKETS >> 32); }
+		static constexpr uint32 slotOf(const uint64 hash, const uint32 displacement) { return static_cast<uint32>((MixHash(hash + displacement) & 0xFFFFFFFF) * N >> 32); }
+
+		constexpr Result<uint32> find(const uint64 hash) const {
+			const uint32 slot = slotOf(hash, displacements[bucketOf(hash)]);
+			return Result(uint32(indices[slot]), hashes[slot] == hash);
+		}
+
+		constexpr void build(const uint64 (&keyHashes)[N]) {
+			uint32 bucketSizes[BUCKETS] = {}, largest = 0;
+
+			for (uint32 i = 0; i < N; ++i) {
+				for (uint32 j = 0; j < i; ++j) { if (keyHashes[i] == keyHashes[j]) { perfectHashDuplicateKey(); } }
+				const uint32 size = ++bucketSizes[bucketOf(keyHashes[i])];
+				largest = size > largest ? size : largest;
+			}
+
+			bool taken[N] = {};
+
+			for (uint32 size = largest; size; --size) {
+				for (uint32 b = 0; b < BUCKETS; ++b) {
+					if (bucketSizes[b] != size) { continue; }
+
+					uint32 members[N] = {}, slots[N] = {}, count = 0;
+					for (uint32 i = 0; i < N; ++i) { if (bucketOf(keyHashes[i]) == b) { members[count++] = i; } }
+
+					for (uint32 displacement = 0; true; ++displacement) {
+						if (displacement == MAX_DISPLACEMENT) { perfectHashNoDisplacement(); }
+
+						bool fits = true;
+
+						for (uint32 m = 0; m < count && fits; ++m) {
+							slots[m] = slotOf(keyHashes[members[m]], displacement);
+							fits = !taken[slots[m]];
+							for (uint32 o = 0; o < m && fits; ++o) { fits = slots[o] != slots[m]; }
+						}
+
+						if (!fits) { continue; }
+
+						for (uint32 m = 0; m < count; ++m) { taken[slots[m]] = true; hashes[slots[m]] = keyHashes[members[m]]; indices[slots[m]] = members[m]; }
+						displacements[b] = displacement;
+						break;
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	 * \brief Read only map from a set of keys known at compile time to values, built entirely during constant evaluation on a PerfectHashTable.
+	 * For keyword dispatch map strings to an enum, for enum to string mappings map the enum to StringViews.
+	 * \tparam V Value type.
+	 * \tparam N Number of entries.
+	 */
+	template<typename V, uint32 N>
+	class PerfectHashMap {
+	public:
+		consteval PerfectHashMap(const StringView (&keys)[N], const V (&values)[N]) : table(keys) {
+			for (uint32 i = 0; i < N; ++i) { this->values[i] = values[i]; }
+		}
+
+		template<PerfectHashInteger I>
+		consteval PerfectHashMap(const I (&keys)[N], const V (&values)[N]) : table(keys) {
+			for (uint32 i = 0; i < N; ++i) { this->values[i] = values[i]; }
+		}
+
+		[[nodiscard]] constexpr Result<V> TryGet(const StringView key) const {
+			const auto index = table.Find(key);
+			return Result(V(values[index.Get()]), index.State());
+		}
+
+		template<PerfectHashInteger I>
+		[[nodiscard]] constexpr Result<V> TryGet(const I key) const {
+			const auto index = table.Find(key);
+			return Result(V(values[index.Get()]), index.State());
+		}
+
+		[[nodiscard]] static constexpr uint32 GetLength() { return N; }
+
+	private:
+		PerfectHashTable<N> table;
+		V values[N] = {};
+	};
+}
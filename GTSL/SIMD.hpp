@@ -6,6 +6,35 @@
 #include <immintrin.h>
 #include <ammintrin.h>
 
+/**
+ * Instruction set targets for runtime dispatched code. The library's baseline, set by the build's -march, only has to cover SSE4.2,
+ * wider kernels are compiled for their own target through these and must only be called after checking GetSIMDLevel(see Dispatch.hpp).
+ * GTSL_TARGET_* mark a single function, GTSL_BEGIN_*_FUNCTIONS/GTSL_END_TARGET_FUNCTIONS mark every function defined in between.
+ * MSVC lets any function use any intrinsic so they expand to nothing there.
+ */
+#if defined(__clang__)
+#define GTSL_TARGET_SSE4 __attribute__((target("sse4.1,sse4.2,popcnt")))
+#define GTSL_TARGET_AVX2 __attribute__((target("avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c")))
+#define GTSL_TARGET_AVX512 __attribute__((target("avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c,avx512f,avx512bw,avx512vl,avx512dq,avx512cd")))
+#define GTSL_BEGIN_AVX2_FUNCTIONS _Pragma("clang attribute push(__attribute__((target(\"avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c\"))), apply_to = function)")
+#define GTSL_BEGIN_AVX512_FUNCTIONS _Pragma("clang attribute push(__attribute__((target(\"avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c,avx512f,avx512bw,avx512vl,avx512dq,avx512cd\"))), apply_to = function)")
+#define GTSL_END_TARGET_FUNCTIONS _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define GTSL_TARGET_SSE4 __attribute__((target("sse4.1,sse4.2,popcnt")))
+#define GTSL_TARGET_AVX2 __attribute__((target("avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c")))
+#define GTSL_TARGET_AVX512 __attribute__((target("avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c,avx512f,avx512bw,avx512vl,avx512dq,avx512cd")))
+#define GTSL_BEGIN_AVX2_FUNCTIONS _Pragma("GCC push_options") _Pragma("GCC target(\"avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c\")")
+#define GTSL_BEGIN_AVX512_FUNCTIONS _Pragma("GCC push_options") _Pragma("GCC target(\"avx,avx2,fma,bmi,bmi2,lzcnt,popcnt,f16c,avx512f,avx512bw,avx512vl,avx512dq,avx512cd\")")
+#define GTSL_END_TARGET_FUNCTIONS _Pragma("GCC pop_options")
+#else
+#define GTSL_TARGET_SSE4
+#define GTSL_TARGET_AVX2
+#define GTSL_TARGET_AVX512
+#define GTSL_BEGIN_AVX2_FUNCTIONS
+#define GTSL_BEGIN_AVX512_FUNCTIONS
+#define GTSL_END_TARGET_FUNCTIONS
+#endif
+
 namespace GTSL
 {
 	template<typename T, uint64 ALIGNMENT>
@@ -152,6 +181,7 @@ namespace GTSL
 
 		SIMD(const AlignedPointer<type, 16> data) : vector(_mm_load_si128(reinterpret_cast<__m128i*>(data.Get()))) {}
 		SIMD(const UnalignedPointer<type> data) : vector(_mm_loadu_si128(reinterpret_cast<__m128i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
 
 		SIMD(const type a, const type b, const type c, const type d, const type e, const type f, const type g, const type h, const type i, const type j, const type k, const type l, const type m, const type n, const type o, const type p) : vector(_mm_set_epi8(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p)) {}
 
@@ -181,6 +211,25 @@ namespace GTSL
 
 		uint16 BitMask() const { return static_cast<uint16>(_mm_movemask_epi8(vector)); }
 
+		[[nodiscard]] bool IsZero() const { return _mm_testz_si128(vector, vector); }
+
+		//Loads 16 bytes, matches SIMD<uint8, 32>::LoadLane so kernels can be written for both widths.
+		static SIMD LoadLane(const UnalignedPointer<const type> data) { return SIMD(data); }
+
+		//Looks up every element of table using the low 4 bits of every byte in indices, indices with the high bit set produce 0.
+		static SIMD ShuffleBytes(const SIMD& table, const SIMD& indices) { return _mm_shuffle_epi8(table, indices); }
+
+		//Returns previous:current shifted N bytes towards the end, so element i holds the byte N positions before it in the stream.
+		template<uint8 N>
+		static SIMD ShiftIn(const SIMD& previous, const SIMD& current) { return _mm_alignr_epi8(current.vector, previous.vector, 16 - N); }
+
+		//Shifts every byte right by N bits, filling with zeros.
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftBitsRight() const { return _mm_and_si128(_mm_srli_epi16(vector, N), _mm_set1_epi8(static_cast<int8>(0xFF >> N))); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm_adds_epu8(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm_subs_epu8(a, b); }
+
 		//Shuffle single-precision (32-bit) floating-point elements in a using the control in imm8, and store the results in dst.
 		template<uint8 A, uint8 B, uint8 C, uint8 D, uint8 E, uint8 F, uint8 G, uint8 H, uint8 I, uint8 J, uint8 K, uint8 L, uint8 M, uint8 N, uint8 O, uint8 P>
 		[[nodiscard]] static SIMD Shuffle(const SIMD& a) { return _mm_shuffle_epi8(a.vector, SIMD(P, O, N, M, L, K, J, I, H, G, F, E, D, C, B, A)); }
@@ -249,6 +298,7 @@ namespace GTSL
 
 		SIMD(const AlignedPointer<type, 16> data) : vector(_mm_load_si128(reinterpret_cast<__m128i*>(data.Get()))) {}
 		SIMD(const UnalignedPointer<type> data) : vector(_mm_loadu_si128(reinterpret_cast<__m128i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
 
 		SIMD(const type a, const type b) : vector(_mm_set_epi64x(a, b)) {}
 
@@ -280,10 +330,30 @@ namespace GTSL
 		//template<uint8 A, uint8 B, uint8 C, uint8 DestructionTester, uint8 E, uint8 F, uint8 G, uint8 H, uint8 I, uint8 J, uint8 K, uint8 L, uint8 M, uint8 N, uint8 O, uint8 P>
 		//[[nodiscard]] static SIMD Shuffle(const SIMD& a, const SIMD& b) { return _MM_SHUFFLE2(a.vector, SIMD(A, B, C, DestructionTester, E, F, G, H, I, J, K, L, M, N, O, P)); }
 
-		void Abs() { vector = _mm_abs_epi64(vector); }
+		void Abs() {
+#if defined(__AVX512VL__)
+			vector = _mm_abs_epi64(vector);
+#else
+			const auto sign = _mm_cmpgt_epi64(_mm_setzero_si128(), vector);
+			vector = _mm_sub_epi64(_mm_xor_si128(vector, sign), sign);
+#endif
+		}
 
-		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm_min_epi64(a, b); }
-		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm_max_epi64(a, b); }
+		static SIMD Min(const SIMD& a, const SIMD& b) {
+#if defined(__AVX512VL__)
+			return _mm_min_epu64(a, b);
+#else
+			return _mm_blendv_epi8(a, b, greaterThan(a, b));
+#endif
+		}
+
+		static SIMD Max(const SIMD& a, const SIMD& b) {
+#if defined(__AVX512VL__)
+			return _mm_max_epu64(a, b);
+#else
+			return _mm_blendv_epi8(b, a, greaterThan(a, b));
+#endif
+		}
 
 		//static SIMD HorizontalAdd(const SIMD& a, const SIMD& b) { return _mm_hadd_epi64(a.vector, b.vector); }
 		//
@@ -298,6 +368,17 @@ namespace GTSL
 
 		//static void Transpose(SIMD& a, SIMD& b, SIMD& c, SIMD& d) { _MM_TRANSPOSE4_epi64(a, b, c, d); }
 
+		//Multiplies the low 32 bits of every element of a and b, giving the full 64 bit products.
+		static SIMD MultiplyLow32(const SIMD& a, const SIMD& b) { return _mm_mul_epu32(a.vector, b.vector); }
+
+		//Swaps every even element with the odd one after it.
+		[[nodiscard]] SIMD SwapAdjacent() const { return _mm_shuffle_epi32(vector, _MM_SHUFFLE(1, 0, 3, 2)); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm_slli_epi64(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm_srli_epi64(vector, N); }
+
 		uint16 BitMask() const { return static_cast<uint16>(_mm_movemask_epi8(vector)); }
 
 		template<uint8 I>
@@ -315,14 +396,15 @@ namespace GTSL
 
 		SIMD operator==(const SIMD& other) const { return _mm_cmpeq_epi64(vector, other.vector); }
 		SIMD operator!=(const SIMD& other) const { return _mm_andnot_si128(_mm_cmpeq_epi64(vector, other.vector), _mm_set1_epi64x(-1)); }
-		SIMD operator>(const SIMD& other)  const { return _mm_cmpgt_epi64(vector, other.vector); }
-		SIMD operator>=(const SIMD& other) const { return _mm_cmpeq_epi64(_mm_max_epu64(vector, other.vector), vector); }
-		SIMD operator<(const SIMD& other)  const { return _mm_andnot_si128(_mm_cmpeq_epi64(_mm_max_epu64(vector, other.vector), vector), _mm_set1_epi64x(-1)); }
-		SIMD operator<=(const SIMD& other) const { return _mm_cmpeq_epi8(_mm_min_epu8(vector, other.vector), vector); }
+		SIMD operator>(const SIMD& other)  const { return greaterThan(vector, other.vector); }
+		SIMD operator>=(const SIMD& other) const { return _mm_andnot_si128(greaterThan(other.vector, vector), _mm_set1_epi64x(-1)); }
+		SIMD operator<(const SIMD& other)  const { return greaterThan(other.vector, vector); }
+		SIMD operator<=(const SIMD& other) const { return _mm_andnot_si128(greaterThan(vector, other.vector), _mm_set1_epi64x(-1)); }
 
 		SIMD operator&(const SIMD& other) const { return _mm_and_si128(vector, other.vector); }
 		SIMD operator|(const SIMD& other) const { return _mm_or_si128(vector, other.vector); }
 		SIMD operator^(const SIMD& other) const { return _mm_xor_si128(vector, other); }
+		SIMD& operator^=(const SIMD& other) { vector = _mm_xor_si128(vector, other.vector); return *this; }
 		SIMD& operator~() { vector = _mm_xor_si128(vector, _mm_cmpeq_epi64(vector, vector)); return *this; }
 	private:
 		__m128i vector;
@@ -330,6 +412,12 @@ namespace GTSL
 		SIMD(const __m128i& m128) : vector(m128) {}
 
 		operator __m128i() const { return vector; }
+
+		//SSE4.2 only has a signed 64 bit compare, flipping the sign bits turns it in to an unsigned one.
+		static __m128i greaterThan(const __m128i a, const __m128i b) {
+			const auto bias = _mm_set1_epi64x(static_cast<int64>(0x8000000000000000ull));
+			return _mm_cmpgt_epi64(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+		}
 	};
 
 	namespace Math {};
@@ -396,18 +484,18 @@ namespace GTSL
 		[[nodiscard]] static SIMD Shuffle(const SIMD a, const SIMD b) {
 			if constexpr (A == 0 and B == 1 and C == 0 and D == 1) {
 				return _mm_movelh_ps(a, b);
-			} if constexpr (A == 2 and B == 3 and C == 2 and D == 3) {
-				return _mm_movehl_ps(a, b);
+			} else if constexpr (A == 2 and B == 3 and C == 2 and D == 3) {
+				return _mm_movehl_ps(b, a);
 			} else {
 				return _mm_shuffle_ps(a.vector, b.vector, _MM_SHUFFLE(D, C, B, A));				
 			}
 		}
 
 		template<int32 A, int32 B, int32 C, int32 D>
-		[[nodiscard]] static SIMD Shuffle(const SIMD a) { return _mm_permute_ps(a.vector, _MM_SHUFFLE(D, C, B, A)); }
+		[[nodiscard]] static SIMD Shuffle(const SIMD a) { return _mm_shuffle_ps(a.vector, a.vector, _MM_SHUFFLE(D, C, B, A)); }
 
 		void Abs() { vector = _mm_andnot_ps(vector, _mm_set_ps1(1.0f)); }
-		static SIMD Abs(const SIMD& a) { return _mm_andnot_ps(a, _mm_set_ps1(-0.0f)); }
+		static SIMD Abs(const SIMD& a) { return _mm_andnot_ps(_mm_set_ps1(-0.0f), a); }
 		static SIMD NotAbs(const SIMD& a) { return _mm_andnot_ps(a, _mm_set_ps1(0.0f)); }
 
 		static SIMD Floor(const SIMD& a) { return _mm_floor_ps(a); }
@@ -415,6 +503,24 @@ namespace GTSL
 		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm_min_ps(a, b); }
 		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm_max_ps(a, b); }
 
+		//Computes a * b + c, with a single rounding when FMA is available.
+		static SIMD MultiplyAdd(const SIMD& a, const SIMD& b, const SIMD& c) {
+#if defined(__FMA__)
+			return _mm_fmadd_ps(a, b, c);
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+		}
+
+		//Computes x * 2^n, n must hold integers between -126 and 127.
+		static SIMD Scale(const SIMD& x, const SIMD& n) { return _mm_mul_ps(x, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23))); }
+
+		//Returns the unbiased exponent of every element, floor(log2(|x|)), as a float. Only valid for normal numbers.
+		static SIMD GetExponent(const SIMD& x) { return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(0xFF)), _mm_set1_epi32(127))); }
+
+		//Returns the mantissa of every element, normalized to [1, 2) and without sign. Only valid for normal numbers.
+		static SIMD GetMantissa(const SIMD& x) { return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000))); }
+
 		static SIMD HorizontalAdd(const SIMD& a, const SIMD& b) { return _mm_hadd_ps(a.vector, b.vector); }
 
 		//Horizontally add adjacent pairs of single - precision(32 - bit) floating - point elements in a and B, and pack the results in dst.
@@ -430,6 +536,9 @@ namespace GTSL
 
 		[[nodiscard]] SIMD SquareRoot() const { return _mm_sqrt_ps(vector); }
 
+		//Approximates 1 / sqrt(x), with a relative error below 1.5 * 2^-12.
+		[[nodiscard]] SIMD ReciprocalSquareRootEstimate() const { return _mm_rsqrt_ps(vector); }
+
 		uint8 BitMask() const { return static_cast<uint8>(_mm_movemask_ps(vector)); }
 
 		/**
@@ -441,6 +550,8 @@ namespace GTSL
 		template<uint8 I>
 		[[nodiscard]] type GetElement() const { return _mm_extract_ps(vector, I); }
 
+		SIMD operator-() const { return _mm_xor_ps(vector, _mm_set1_ps(-0.0f)); }
+
 		SIMD operator+(const SIMD& other) const { return _mm_add_ps(vector, other.vector); }
 		SIMD operator-(const SIMD& other) const { return _mm_sub_ps(vector, other.vector); }
 		SIMD operator*(const SIMD& other) const { return _mm_mul_ps(vector, other.vector); }
@@ -475,8 +586,11 @@ namespace GTSL
 		SIMD(const __m128 m128) : vector(m128) {}
 
 		friend class SIMD<int32, 4>;
+		friend class SIMD<float32, 8>;
 	};
 
+GTSL_BEGIN_AVX2_FUNCTIONS
+
 	template<>
 	class alignas(32) SIMD<float32, 8> {
 	public:
@@ -487,6 +601,8 @@ namespace GTSL
 
 		SIMD(const type a) : vector(_mm256_set1_ps(a)) {}
 
+		SIMD(const SIMD a, const SIMD b, const SIMD mask) : vector(_mm256_blendv_ps(a, b, mask)) {}
+
 		SIMD(const type* data) : vector(_mm256_load_ps(data)) {
 			GTSL_ASSERT((uint64)data % 32 == 0, "Not aligned");
 		}
@@ -504,6 +620,13 @@ namespace GTSL
 		SIMD(const type a, const type b, const type c, const type d, const type e, const type f, const type g, const type h) : vector(_mm256_setr_ps(a, b, c, d, e, f, g, h)) {}
 		explicit SIMD(const SIMD<int32, 8> other);
 
+		/**
+		 * \brief Builds a vector from two 128 bit halves.
+		 * \param low Elements 0 to 3.
+		 * \param high Elements 4 to 7.
+		 */
+		SIMD(const SIMD<float32, 4> low, const SIMD<float32, 4> high) : vector(_mm256_set_m128(high.vector, low.vector)) {}
+
 		SIMD(const SIMD& other) = default;
 
 		~SIMD() = default;
@@ -530,23 +653,19 @@ namespace GTSL
 		//Store 128-bits (composed of 4 packed single-precision (32-bit) floating-point elements) from this vector into unaligned memory.
 		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_ps(data, vector); }
 
+		//Picks elements A and B from a and C and D from b, within each 128 bit lane.
 		template<int32 A, int32 B, int32 C, int32 D>
-		[[nodiscard]] static SIMD Shuffle(const SIMD a, const SIMD b) {
-			if constexpr (A == 0 and B == 1 and C == 0 and D == 1) {
-				//return _mm256_move(a, b);
-			} if constexpr (A == 2 and B == 3 and C == 2 and D == 3) {
-				//return _mm256_movehl_ps(a, b);
-			}
-			else {
-				return _mm256_shuffle_ps(a.vector, b.vector, _MM_SHUFFLE(D, C, B, A));
-			}
-		}
+		[[nodiscard]] static SIMD Shuffle(const SIMD a, const SIMD b) { return _mm256_shuffle_ps(a.vector, b.vector, _MM_SHUFFLE(D, C, B, A)); }
 
 		template<int32 A, int32 B, int32 C, int32 D, int E, int F, int G, int H>
 		[[nodiscard]] static SIMD Shuffle(const SIMD a) { return _mm256_permute_ps(a.vector, H << 14 | G << 12 | F << 10 | E << 8 | D << 6 | C << 4 | B << 2 | A); }
 
+		//Shuffles the elements within each 128 bit lane, both lanes use the same pattern.
+		template<int32 A, int32 B, int32 C, int32 D>
+		[[nodiscard]] static SIMD Shuffle(const SIMD a) { return _mm256_permute_ps(a.vector, _MM_SHUFFLE(D, C, B, A)); }
+
 		void Abs() { vector = _mm256_andnot_ps(vector, SIMD(1.0f)); }
-		static SIMD Abs(const SIMD& a) { return _mm256_andnot_ps(a, SIMD(-0.0f)); }
+		static SIMD Abs(const SIMD& a) { return _mm256_andnot_ps(SIMD(-0.0f), a); }
 		static SIMD NotAbs(const SIMD& a) { return _mm256_andnot_ps(a, SIMD(0.0f)); }
 
 		static SIMD Floor(const SIMD& a) { return _mm256_floor_ps(a); }
@@ -554,6 +673,18 @@ namespace GTSL
 		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm256_min_ps(a, b); }
 		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm256_max_ps(a, b); }
 
+		//Computes a * b + c with a single rounding.
+		static SIMD MultiplyAdd(const SIMD& a, const SIMD& b, const SIMD& c) { return _mm256_fmadd_ps(a, b, c); }
+
+		//Computes x * 2^n, n must hold integers between -126 and 127.
+		static SIMD Scale(const SIMD& x, const SIMD& n) { return _mm256_mul_ps(x, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23))); }
+
+		//Returns the unbiased exponent of every element, floor(log2(|x|)), as a float. Only valid for normal numbers.
+		static SIMD GetExponent(const SIMD& x) { return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(_mm256_castps_si256(x), 23), _mm256_set1_epi32(0xFF)), _mm256_set1_epi32(127))); }
+
+		//Returns the mantissa of every element, normalized to [1, 2) and without sign. Only valid for normal numbers.
+		static SIMD GetMantissa(const SIMD& x) { return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(_mm256_castps_si256(x), _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000))); }
+
 		static SIMD HorizontalAdd(const SIMD& a, const SIMD& b) { return _mm256_hadd_ps(a.vector, b.vector); }
 
 		//Horizontally add adjacent pairs of single - precision(32 - bit) floating - point elements in a and B, and pack the results in dst.
@@ -565,12 +696,39 @@ namespace GTSL
 		//Conditionally multiply the packed single-precision (32-bit) floating-point elements in a and B using the high 4 bits in imm8, sum the four products, and conditionally store the sum in dst using the low 4 bits of imm8.
 		[[nodiscard]] static SIMD DotProduct(const SIMD& a, const SIMD& b) { return _mm256_dp_ps(a.vector, b.vector, 0xff); }
 
-		//static void Transpose(SIMD& a, SIMD& b, SIMD& c, SIMD& d) { _mm256_tr(a, b, c, d); }
+		//Transposes the 4x4 matrix held in each 128 bit lane of a, b, c, d.
+		static void Transpose(SIMD& a, SIMD& b, SIMD& c, SIMD& d) {
+			const auto ab01 = Shuffle<0, 1, 0, 1>(a, b), ab23 = Shuffle<2, 3, 2, 3>(a, b), cd01 = Shuffle<0, 1, 0, 1>(c, d), cd23 = Shuffle<2, 3, 2, 3>(c, d);
+			a = Shuffle<0, 2, 0, 2>(ab01, cd01); b = Shuffle<1, 3, 1, 3>(ab01, cd01);
+			c = Shuffle<0, 2, 0, 2>(ab23, cd23); d = Shuffle<1, 3, 1, 3>(ab23, cd23);
+		}
+
+		//Loads 8 IEEE half precision floats, converting them exactly.
+		static SIMD LoadHalf(const UnalignedPointer<const uint16> data) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))); }
+
+		//Stores every element as an IEEE half precision float, rounding to nearest even. Out of range values become infinity.
+		void CopyToHalf(const UnalignedPointer<uint16> data) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(data.Get()), _mm256_cvtps_ph(vector, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+
+		//Converts every element to the nearest integer, ties to even. Out of range values become INT32_MIN.
+		[[nodiscard]] SIMD<int32, 8> RoundToInt32() const;
+
+		static SIMD ConvertFromInt32(const SIMD<int32, 8> integers);
+
+		//Loads base[indices[i]] into every element i, indices count elements not bytes.
+		static SIMD Gather(const type* base, const SIMD<int32, 8> indices);
+
+		[[nodiscard]] SIMD<float32, 4> GetLow() const { return _mm256_castps256_ps128(vector); }
+		[[nodiscard]] SIMD<float32, 4> GetHigh() const { return _mm256_extractf128_ps(vector, 1); }
 
 		[[nodiscard]] SIMD SquareRoot() const { return _mm256_sqrt_ps(vector); }
 
+		//Approximates 1 / sqrt(x), with a relative error below 1.5 * 2^-12.
+		[[nodiscard]] SIMD ReciprocalSquareRootEstimate() const { return _mm256_rsqrt_ps(vector); }
+
 		uint8 BitMask() const { return static_cast<uint8>(_mm256_movemask_ps(vector)); }
 
+		SIMD operator-() const { return _mm256_xor_ps(vector, _mm256_set1_ps(-0.0f)); }
+
 		SIMD operator+(const SIMD& other) const { return _mm256_add_ps(vector, other.vector); }
 		SIMD operator-(const SIMD& other) const { return _mm256_sub_ps(vector, other.vector); }
 		SIMD operator*(const SIMD& other) const { return _mm256_mul_ps(vector, other.vector); }
@@ -607,6 +765,8 @@ namespace GTSL
 		friend class SIMD<int32, 8>;
 	};
 
+GTSL_END_TARGET_FUNCTIONS
+
 	template<>
 	class alignas(16) SIMD<float64, 2> {
 	public:
@@ -800,6 +960,8 @@ namespace GTSL
 		friend class SIMD<float32, 4>;
 	};
 
+GTSL_BEGIN_AVX2_FUNCTIONS
+
 	template<>
 	class alignas(32) SIMD<int32, 8> {
 	public:
@@ -812,9 +974,38 @@ namespace GTSL
 
 		SIMD(const AlignedPointer<type, 32> data) : vector(_mm256_load_si256(reinterpret_cast<__m256i*>(data.Get()))) {}
 		SIMD(const UnalignedPointer<type> data) : vector(_mm256_loadu_si256(reinterpret_cast<__m256i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
 
 		SIMD(const SIMD<float32, 8> other) : vector(_mm256_castps_si256(other.vector)) {}
 
+		//Loads 8 16 bit integers, sign extending them.
+		static SIMD LoadWidened(const UnalignedPointer<const int16> data) { return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))); }
+
+		//Loads 8 16 bit integers, zero extending them.
+		static SIMD LoadWidened(const UnalignedPointer<const uint16> data) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))); }
+
+		//Loads 8 8 bit integers, zero extending them.
+		static SIMD LoadWidened(const UnalignedPointer<const uint8> data) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data.Get()))); }
+
+		//Stores every element as a 16 bit integer, clamping to it's range.
+		void CopyToSaturated(const UnalignedPointer<int16> data) const {
+			const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(vector, vector), 0b1000);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(data.Get()), _mm256_castsi256_si128(packed));
+		}
+
+		//Stores every element as an unsigned 16 bit integer, clamping to it's range.
+		void CopyToSaturated(const UnalignedPointer<uint16> data) const {
+			const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(vector, vector), 0b1000);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(data.Get()), _mm256_castsi256_si128(packed));
+		}
+
+		//Stores every element as an unsigned 8 bit integer, clamping to it's range.
+		void CopyToSaturated(const UnalignedPointer<uint8> data) const {
+			const auto words = _mm256_packs_epi32(vector, vector); // elements 0 1 2 3 in the low lane and 4 5 6 7 in the high one
+			const auto bytes = _mm256_packus_epi16(words, words);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(data.Get()), _mm_unpacklo_epi32(_mm256_castsi256_si128(bytes), _mm256_extracti128_si256(bytes, 1)));
+		}
+
 		SIMD(const type a, const type b, const type c, const type d, const type e, const type f, const type g, const type h) : vector(_mm256_setr_epi32(a, b, c, d, e, f, g, h)) {}
 
 		SIMD(const SIMD& other) = default;
@@ -887,9 +1078,864 @@ namespace GTSL
 		friend class SIMD<float32, 8>;
 	};
 
+GTSL_END_TARGET_FUNCTIONS
+
+	template<>
+	class alignas(16) SIMD<uint16, 8> {
+	public:
+		using type = uint16;
+		static constexpr uint8 ElementCount = 8;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm_set1_epi16(static_cast<int16>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 16> data) : vector(_mm_load_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm_set1_epi16(static_cast<int16>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 16> data) const { _mm_store_si128(reinterpret_cast<__m128i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(data.Get()), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm_min_epu16(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm_max_epu16(a, b); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm_adds_epu16(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm_subs_epu16(a, b); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm_slli_epi16(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm_srli_epi16(vector, N); }
+
+		//Returns one bit per element, set if the element's most significant bit is set.
+		uint8 BitMask() const { return static_cast<uint8>(_mm_movemask_epi8(_mm_packs_epi16(vector, _mm_setzero_si128()))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm_extract_epi16(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm_add_epi16(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm_sub_epi16(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm_mullo_epi16(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm_add_epi16(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm_sub_epi16(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm_mullo_epi16(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm_cmpeq_epi16(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm_andnot_si128(_mm_cmpeq_epi16(vector, other.vector), _mm_set1_epi16(-1)); }
+		SIMD operator>(const SIMD& other)  const { return _mm_andnot_si128(_mm_cmpeq_epi16(_mm_min_epu16(vector, other.vector), vector), _mm_set1_epi16(-1)); }
+		SIMD operator>=(const SIMD& other) const { return _mm_cmpeq_epi16(_mm_max_epu16(vector, other.vector), vector); }
+		SIMD operator<(const SIMD& other)  const { return _mm_andnot_si128(_mm_cmpeq_epi16(_mm_max_epu16(vector, other.vector), vector), _mm_set1_epi16(-1)); }
+		SIMD operator<=(const SIMD& other) const { return _mm_cmpeq_epi16(_mm_min_epu16(vector, other.vector), vector); }
+
+		SIMD operator&(const SIMD& other) const { return _mm_and_si128(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm_or_si128(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm_xor_si128(vector, other.vector); }
+		SIMD operator~() const { return _mm_xor_si128(vector, _mm_set1_epi16(-1)); }
+
+	private:
+		__m128i vector;
+
+		SIMD(const __m128i m128) : vector(m128) {}
+		operator __m128i() const { return vector; }
+	};
+
+	template<>
+	class alignas(16) SIMD<uint32, 4> {
+	public:
+		using type = uint32;
+		static constexpr uint8 ElementCount = 4;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm_set1_epi32(static_cast<int32>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 16> data) : vector(_mm_load_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))) {}
+
+		SIMD(const type a, const type b, const type c, const type d) : vector(_mm_setr_epi32(static_cast<int32>(a), static_cast<int32>(b), static_cast<int32>(c), static_cast<int32>(d))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm_set1_epi32(static_cast<int32>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 16> data) const { _mm_store_si128(reinterpret_cast<__m128i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(data.Get()), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm_min_epu32(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm_max_epu32(a, b); }
+
+		template<uint8 A, uint8 B, uint8 C, uint8 D>
+		static SIMD Shuffle(const SIMD a) { return _mm_shuffle_epi32(a, _MM_SHUFFLE(D, C, B, A)); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm_slli_epi32(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm_srli_epi32(vector, N); }
+
+		uint8 BitMask() const { return static_cast<uint8>(_mm_movemask_ps(_mm_castsi128_ps(vector))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm_extract_epi32(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm_add_epi32(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm_sub_epi32(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm_mullo_epi32(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm_add_epi32(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm_sub_epi32(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm_mullo_epi32(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm_cmpeq_epi32(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm_andnot_si128(_mm_cmpeq_epi32(vector, other.vector), _mm_set1_epi32(-1)); }
+		SIMD operator>(const SIMD& other)  const { return _mm_andnot_si128(_mm_cmpeq_epi32(_mm_min_epu32(vector, other.vector), vector), _mm_set1_epi32(-1)); }
+		SIMD operator>=(const SIMD& other) const { return _mm_cmpeq_epi32(_mm_max_epu32(vector, other.vector), vector); }
+		SIMD operator<(const SIMD& other)  const { return _mm_andnot_si128(_mm_cmpeq_epi32(_mm_max_epu32(vector, other.vector), vector), _mm_set1_epi32(-1)); }
+		SIMD operator<=(const SIMD& other) const { return _mm_cmpeq_epi32(_mm_min_epu32(vector, other.vector), vector); }
+
+		SIMD operator&(const SIMD& other) const { return _mm_and_si128(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm_or_si128(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm_xor_si128(vector, other.vector); }
+		SIMD operator~() const { return _mm_xor_si128(vector, _mm_set1_epi32(-1)); }
+
+	private:
+		__m128i vector;
+
+		SIMD(const __m128i m128) : vector(m128) {}
+		operator __m128i() const { return vector; }
+	};
+
+GTSL_BEGIN_AVX2_FUNCTIONS
+
+	template<>
+	class alignas(32) SIMD<uint8, 32> {
+	public:
+		using type = uint8;
+		static constexpr uint8 ElementCount = 32;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm256_set1_epi8(static_cast<int8>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 32> data) : vector(_mm256_load_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm256_set1_epi8(static_cast<int8>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 32> data) const { _mm256_store_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm256_min_epu8(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm256_max_epu8(a, b); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm256_adds_epu8(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm256_subs_epu8(a, b); }
+
+		//Shuffles bytes within each 128 bit lane, using the low 4 bits of every byte in indices.
+		static SIMD ShuffleBytes(const SIMD& table, const SIMD& indices) { return _mm256_shuffle_epi8(table, indices); }
+
+		uint32 BitMask() const { return static_cast<uint32>(_mm256_movemask_epi8(vector)); }
+
+		[[nodiscard]] bool IsZero() const { return _mm256_testz_si256(vector, vector); }
+
+		//Loads 16 bytes in to both 128 bit lanes, to build tables for ShuffleBytes.
+		static SIMD LoadLane(const UnalignedPointer<const type> data) { return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.Get()))); }
+
+		//Returns previous:current shifted N bytes towards the end, so element i holds the byte N positions before it in the stream.
+		template<uint8 N>
+		static SIMD ShiftIn(const SIMD& previous, const SIMD& current) { return _mm256_alignr_epi8(current.vector, _mm256_permute2x128_si256(previous.vector, current.vector, 0x21), 16 - N); }
+
+		//Shifts every byte right by N bits, filling with zeros.
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftBitsRight() const { return _mm256_and_si256(_mm256_srli_epi16(vector, N), _mm256_set1_epi8(static_cast<int8>(0xFF >> N))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm256_extract_epi8(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm256_add_epi8(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm256_sub_epi8(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm256_add_epi8(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm256_sub_epi8(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm256_cmpeq_epi8(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm256_andnot_si256(_mm256_cmpeq_epi8(vector, other.vector), _mm256_set1_epi8(-1)); }
+		SIMD operator>(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(vector, other.vector), vector), _mm256_set1_epi8(-1)); }
+		SIMD operator>=(const SIMD& other) const { return _mm256_cmpeq_epi8(_mm256_max_epu8(vector, other.vector), vector); }
+		SIMD operator<(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(vector, other.vector), vector), _mm256_set1_epi8(-1)); }
+		SIMD operator<=(const SIMD& other) const { return _mm256_cmpeq_epi8(_mm256_min_epu8(vector, other.vector), vector); }
+
+		SIMD operator&(const SIMD& other) const { return _mm256_and_si256(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm256_or_si256(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm256_xor_si256(vector, other.vector); }
+		SIMD operator~() const { return _mm256_xor_si256(vector, _mm256_set1_epi8(-1)); }
+
+	private:
+		__m256i vector;
+
+		SIMD(const __m256i m256) : vector(m256) {}
+		operator __m256i() const { return vector; }
+	};
+
+	template<>
+	class alignas(32) SIMD<uint16, 16> {
+	public:
+		using type = uint16;
+		static constexpr uint8 ElementCount = 16;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm256_set1_epi16(static_cast<int16>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 32> data) : vector(_mm256_load_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm256_set1_epi16(static_cast<int16>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 32> data) const { _mm256_store_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm256_min_epu16(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm256_max_epu16(a, b); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm256_adds_epu16(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm256_subs_epu16(a, b); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm256_slli_epi16(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm256_srli_epi16(vector, N); }
+
+		//Returns one bit per element, set if the element's most significant bit is set.
+		uint16 BitMask() const { return static_cast<uint16>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(vector, _mm256_setzero_si256()), 0b11011000))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm256_extract_epi16(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm256_add_epi16(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm256_sub_epi16(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm256_mullo_epi16(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm256_add_epi16(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm256_sub_epi16(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm256_mullo_epi16(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm256_cmpeq_epi16(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm256_andnot_si256(_mm256_cmpeq_epi16(vector, other.vector), _mm256_set1_epi16(-1)); }
+		SIMD operator>(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_min_epu16(vector, other.vector), vector), _mm256_set1_epi16(-1)); }
+		SIMD operator>=(const SIMD& other) const { return _mm256_cmpeq_epi16(_mm256_max_epu16(vector, other.vector), vector); }
+		SIMD operator<(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(vector, other.vector), vector), _mm256_set1_epi16(-1)); }
+		SIMD operator<=(const SIMD& other) const { return _mm256_cmpeq_epi16(_mm256_min_epu16(vector, other.vector), vector); }
+
+		SIMD operator&(const SIMD& other) const { return _mm256_and_si256(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm256_or_si256(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm256_xor_si256(vector, other.vector); }
+		SIMD operator~() const { return _mm256_xor_si256(vector, _mm256_set1_epi16(-1)); }
+
+	private:
+		__m256i vector;
+
+		SIMD(const __m256i m256) : vector(m256) {}
+		operator __m256i() const { return vector; }
+	};
+
+	template<>
+	class alignas(32) SIMD<uint32, 8> {
+	public:
+		using type = uint32;
+		static constexpr uint8 ElementCount = 8;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm256_set1_epi32(static_cast<int32>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 32> data) : vector(_mm256_load_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm256_set1_epi32(static_cast<int32>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 32> data) const { _mm256_store_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm256_min_epu32(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm256_max_epu32(a, b); }
+
+		//Moves elements across the whole vector, element i of the result is element indices[i] of a.
+		static SIMD Permute(const SIMD& a, const SIMD& indices) { return _mm256_permutevar8x32_epi32(a, indices); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm256_slli_epi32(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm256_srli_epi32(vector, N); }
+
+		uint8 BitMask() const { return static_cast<uint8>(_mm256_movemask_ps(_mm256_castsi256_ps(vector))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm256_extract_epi32(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm256_add_epi32(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm256_sub_epi32(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm256_mullo_epi32(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm256_add_epi32(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm256_sub_epi32(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm256_mullo_epi32(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm256_cmpeq_epi32(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm256_andnot_si256(_mm256_cmpeq_epi32(vector, other.vector), _mm256_set1_epi32(-1)); }
+		SIMD operator>(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(vector, other.vector), vector), _mm256_set1_epi32(-1)); }
+		SIMD operator>=(const SIMD& other) const { return _mm256_cmpeq_epi32(_mm256_max_epu32(vector, other.vector), vector); }
+		SIMD operator<(const SIMD& other)  const { return _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(vector, other.vector), vector), _mm256_set1_epi32(-1)); }
+		SIMD operator<=(const SIMD& other) const { return _mm256_cmpeq_epi32(_mm256_min_epu32(vector, other.vector), vector); }
+
+		SIMD operator&(const SIMD& other) const { return _mm256_and_si256(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm256_or_si256(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm256_xor_si256(vector, other.vector); }
+		SIMD operator~() const { return _mm256_xor_si256(vector, _mm256_set1_epi32(-1)); }
+
+	private:
+		__m256i vector;
+
+		SIMD(const __m256i m256) : vector(m256) {}
+		operator __m256i() const { return vector; }
+	};
+
+	template<>
+	class alignas(32) SIMD<uint64, 4> {
+	public:
+		using type = uint64;
+		static constexpr uint8 ElementCount = 4;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm256_set1_epi64x(static_cast<int64>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 32> data) : vector(_mm256_load_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.Get()))) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm256_set1_epi64x(static_cast<int64>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 32> data) const { _mm256_store_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data.Get()), vector); }
+
+		//Multiplies the low 32 bits of every element of a and b, giving the full 64 bit products.
+		static SIMD MultiplyLow32(const SIMD& a, const SIMD& b) { return _mm256_mul_epu32(a, b); }
+
+		//Swaps every even element with the odd one after it.
+		[[nodiscard]] SIMD SwapAdjacent() const { return _mm256_shuffle_epi32(vector, _MM_SHUFFLE(1, 0, 3, 2)); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm256_slli_epi64(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm256_srli_epi64(vector, N); }
+
+		uint8 BitMask() const { return static_cast<uint8>(_mm256_movemask_pd(_mm256_castsi256_pd(vector))); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm256_extract_epi64(vector, I)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm256_add_epi64(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm256_sub_epi64(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm256_add_epi64(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm256_sub_epi64(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm256_cmpeq_epi64(vector, other.vector); }
+		SIMD operator!=(const SIMD& other) const { return _mm256_andnot_si256(_mm256_cmpeq_epi64(vector, other.vector), _mm256_set1_epi64x(-1)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm256_and_si256(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm256_or_si256(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm256_xor_si256(vector, other.vector); }
+		SIMD& operator^=(const SIMD& other) { vector = _mm256_xor_si256(vector, other.vector); return *this; }
+		SIMD operator~() const { return _mm256_xor_si256(vector, _mm256_set1_epi64x(-1)); }
+
+	private:
+		__m256i vector;
+
+		SIMD(const __m256i m256) : vector(m256) {}
+		operator __m256i() const { return vector; }
+	};
+
+	template<>
+	class alignas(32) SIMD<float64, 4> {
+	public:
+		using type = float64;
+		static constexpr uint8 ElementCount = 4;
+
+		SIMD() : vector(_mm256_setzero_pd()) {}
+
+		SIMD(const type a) : vector(_mm256_set1_pd(a)) {}
+
+		SIMD(const AlignedPointer<const type, 32> data) : vector(_mm256_load_pd(data)) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm256_loadu_pd(data)) {}
+
+		SIMD(const type x, const type y, const type z, const type w) : vector(_mm256_setr_pd(x, y, z, w)) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm256_set1_pd(a); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 32> data) const { _mm256_store_pd(data, vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm256_storeu_pd(data, vector); }
+
+		static SIMD Abs(const SIMD& a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+
+		static SIMD Floor(const SIMD& a) { return _mm256_floor_pd(a); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm256_min_pd(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm256_max_pd(a, b); }
+
+		//Returns a * b + c, rounded once.
+		static SIMD MultiplyAdd(const SIMD& a, const SIMD& b, const SIMD& c) { return _mm256_fmadd_pd(a, b, c); }
+
+		static SIMD HorizontalAdd(const SIMD& a, const SIMD& b) { return _mm256_hadd_pd(a.vector, b.vector); }
+
+		[[nodiscard]] SIMD SquareRoot() const { return _mm256_sqrt_pd(vector); }
+
+		uint8 BitMask() const { return static_cast<uint8>(_mm256_movemask_pd(vector)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm256_add_pd(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm256_sub_pd(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm256_mul_pd(vector, other.vector); }
+		SIMD operator/(const SIMD& other) const { return _mm256_div_pd(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm256_add_pd(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm256_sub_pd(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm256_mul_pd(vector, other.vector); return *this; }
+		SIMD& operator/=(const SIMD& other) { vector = _mm256_div_pd(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return _mm256_cmp_pd(vector, other.vector, _CMP_EQ_OQ); }
+		SIMD operator!=(const SIMD& other) const { return _mm256_cmp_pd(vector, other.vector, _CMP_NEQ_OQ); }
+		SIMD operator>(const SIMD& other)  const { return _mm256_cmp_pd(vector, other.vector, _CMP_GT_OQ); }
+		SIMD operator>=(const SIMD& other) const { return _mm256_cmp_pd(vector, other.vector, _CMP_GE_OQ); }
+		SIMD operator<(const SIMD& other)  const { return _mm256_cmp_pd(vector, other.vector, _CMP_LT_OQ); }
+		SIMD operator<=(const SIMD& other) const { return _mm256_cmp_pd(vector, other.vector, _CMP_LE_OQ); }
+
+		SIMD operator&(const SIMD& other) const { return _mm256_and_pd(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm256_or_pd(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm256_xor_pd(vector, other.vector); }
+
+	private:
+		__m256d vector;
+
+		SIMD(const __m256d m256) : vector(m256) {}
+		operator __m256d() const { return vector; }
+	};
+
+GTSL_END_TARGET_FUNCTIONS
+
+GTSL_BEGIN_AVX512_FUNCTIONS
+
+	template<>
+	class alignas(64) SIMD<uint8, 64> {
+	public:
+		using type = uint8;
+		static constexpr uint8 ElementCount = 64;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm512_set1_epi8(static_cast<int8>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 64> data) : vector(_mm512_load_si512(data.Get())) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm512_loadu_si512(data.Get())) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm512_set1_epi8(static_cast<int8>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 64> data) const { _mm512_store_si512(data.Get(), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm512_storeu_si512(data.Get(), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm512_min_epu8(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm512_max_epu8(a, b); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm512_adds_epu8(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm512_subs_epu8(a, b); }
+
+		//Shuffles bytes within each 128 bit lane, using the low 4 bits of every byte in indices.
+		static SIMD ShuffleBytes(const SIMD& table, const SIMD& indices) { return _mm512_shuffle_epi8(table, indices); }
+
+		uint64 BitMask() const { return _mm512_movepi8_mask(vector); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm_extract_epi8(_mm512_extracti32x4_epi32(vector, I / 16), I % 16)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm512_add_epi8(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm512_sub_epi8(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm512_add_epi8(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm512_sub_epi8(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_EQ)); }
+		SIMD operator!=(const SIMD& other) const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_NE)); }
+		SIMD operator>(const SIMD& other)  const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_NLE)); }
+		SIMD operator>=(const SIMD& other) const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_NLT)); }
+		SIMD operator<(const SIMD& other)  const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_LT)); }
+		SIMD operator<=(const SIMD& other) const { return fromMask(_mm512_cmp_epu8_mask(vector, other.vector, _MM_CMPINT_LE)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm512_and_si512(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm512_or_si512(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm512_xor_si512(vector, other.vector); }
+		SIMD operator~() const { return _mm512_xor_si512(vector, _mm512_set1_epi8(-1)); }
+
+	private:
+		__m512i vector;
+
+		SIMD(const __m512i m512) : vector(m512) {}
+		operator __m512i() const { return vector; }
+
+		static SIMD fromMask(const __mmask64 mask) { return _mm512_maskz_set1_epi8(mask, -1); }
+	};
+
+	template<>
+	class alignas(64) SIMD<uint16, 32> {
+	public:
+		using type = uint16;
+		static constexpr uint8 ElementCount = 32;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm512_set1_epi16(static_cast<int16>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 64> data) : vector(_mm512_load_si512(data.Get())) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm512_loadu_si512(data.Get())) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm512_set1_epi16(static_cast<int16>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 64> data) const { _mm512_store_si512(data.Get(), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm512_storeu_si512(data.Get(), vector); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm512_min_epu16(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm512_max_epu16(a, b); }
+
+		static SIMD AddSaturated(const SIMD& a, const SIMD& b) { return _mm512_adds_epu16(a, b); }
+		static SIMD SubtractSaturated(const SIMD& a, const SIMD& b) { return _mm512_subs_epu16(a, b); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm512_slli_epi16(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm512_srli_epi16(vector, N); }
+
+		uint32 BitMask() const { return _mm512_movepi16_mask(vector); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm_extract_epi16(_mm512_extracti32x4_epi32(vector, I / 8), I % 8)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm512_add_epi16(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm512_sub_epi16(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm512_mullo_epi16(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm512_add_epi16(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm512_sub_epi16(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm512_mullo_epi16(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_EQ)); }
+		SIMD operator!=(const SIMD& other) const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_NE)); }
+		SIMD operator>(const SIMD& other)  const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_NLE)); }
+		SIMD operator>=(const SIMD& other) const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_NLT)); }
+		SIMD operator<(const SIMD& other)  const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_LT)); }
+		SIMD operator<=(const SIMD& other) const { return fromMask(_mm512_cmp_epu16_mask(vector, other.vector, _MM_CMPINT_LE)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm512_and_si512(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm512_or_si512(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm512_xor_si512(vector, other.vector); }
+		SIMD operator~() const { return _mm512_xor_si512(vector, _mm512_set1_epi16(-1)); }
+
+	private:
+		__m512i vector;
+
+		SIMD(const __m512i m512) : vector(m512) {}
+		operator __m512i() const { return vector; }
+
+		static SIMD fromMask(const __mmask32 mask) { return _mm512_maskz_set1_epi16(mask, -1); }
+	};
+
+	template<>
+	class alignas(64) SIMD<uint32, 16> {
+	public:
+		using type = uint32;
+		static constexpr uint8 ElementCount = 16;
+
+		SIMD() = default;
+
+		explicit SIMD(const type a) : vector(_mm512_set1_epi32(static_cast<int32>(a))) {}
+
+		SIMD(const AlignedPointer<const type, 64> data) : vector(_mm512_load_si512(data.Get())) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm512_loadu_si512(data.Get())) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm512_set1_epi32(static_cast<int32>(a)); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 64> data) const { _mm512_store_si512(data.Get(), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm512_storeu_si512(data.Get(), vector); }
+
+		//Stores only the elements whose bit is set in mask, packed contiguously starting at data. Returns the number of stored elements.
+		uint32 CompressTo(const UnalignedPointer<type> data, const uint16 mask) const {
+			_mm512_mask_compressstoreu_epi32(data.Get(), mask, vector);
+#if _WIN64
+			return __popcnt16(mask);
+#elif __linux__
+			return static_cast<uint32>(__builtin_popcount(mask));
+#endif
+		}
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm512_min_epu32(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm512_max_epu32(a, b); }
+
+		//Moves elements across the whole vector, element i of the result is element indices[i] of a.
+		static SIMD Permute(const SIMD& a, const SIMD& indices) { return _mm512_permutexvar_epi32(indices, a); }
+
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftLeft() const { return _mm512_slli_epi32(vector, N); }
+		template<uint8 N>
+		[[nodiscard]] SIMD ShiftRight() const { return _mm512_srli_epi32(vector, N); }
+
+		uint16 BitMask() const { return _mm512_movepi32_mask(vector); }
+
+		template<uint8 I>
+		[[nodiscard]] type GetElement() const { return static_cast<type>(_mm_extract_epi32(_mm512_extracti32x4_epi32(vector, I / 4), I % 4)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm512_add_epi32(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm512_sub_epi32(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm512_mullo_epi32(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm512_add_epi32(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm512_sub_epi32(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm512_mullo_epi32(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_EQ)); }
+		SIMD operator!=(const SIMD& other) const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_NE)); }
+		SIMD operator>(const SIMD& other)  const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_NLE)); }
+		SIMD operator>=(const SIMD& other) const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_NLT)); }
+		SIMD operator<(const SIMD& other)  const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_LT)); }
+		SIMD operator<=(const SIMD& other) const { return fromMask(_mm512_cmp_epu32_mask(vector, other.vector, _MM_CMPINT_LE)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm512_and_si512(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm512_or_si512(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm512_xor_si512(vector, other.vector); }
+		SIMD operator~() const { return _mm512_xor_si512(vector, _mm512_set1_epi32(-1)); }
+
+	private:
+		__m512i vector;
+
+		SIMD(const __m512i m512) : vector(m512) {}
+		operator __m512i() const { return vector; }
+
+		static SIMD fromMask(const __mmask16 mask) { return _mm512_maskz_set1_epi32(mask, -1); }
+	};
+
+	template<>
+	class alignas(64) SIMD<float32, 16> {
+	public:
+		using type = float32;
+		static constexpr uint8 ElementCount = 16;
+
+		SIMD() : vector(_mm512_setzero_ps()) {}
+
+		SIMD(const type a) : vector(_mm512_set1_ps(a)) {}
+
+		SIMD(const SIMD a, const SIMD b, const SIMD mask) : vector(_mm512_mask_blend_ps(_mm512_movepi32_mask(_mm512_castps_si512(mask)), a, b)) {}
+
+		SIMD(const AlignedPointer<const type, 64> data) : vector(_mm512_load_ps(data.Get())) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm512_loadu_ps(data.Get())) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm512_set1_ps(a); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 64> data) const { _mm512_store_ps(data.Get(), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm512_storeu_ps(data.Get(), vector); }
+
+		static SIMD Abs(const SIMD& a) { return _mm512_abs_ps(a); }
+
+		static SIMD Floor(const SIMD& a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm512_min_ps(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm512_max_ps(a, b); }
+
+		//Returns a * b + c, rounded once.
+		static SIMD MultiplyAdd(const SIMD& a, const SIMD& b, const SIMD& c) { return _mm512_fmadd_ps(a, b, c); }
+
+		//Computes x * 2^floor(n).
+		static SIMD Scale(const SIMD& x, const SIMD& n) { return _mm512_scalef_ps(x, n); }
+
+		//Returns the unbiased exponent of every element, floor(log2(|x|)), as a float.
+		static SIMD GetExponent(const SIMD& x) { return _mm512_getexp_ps(x); }
+
+		//Returns the mantissa of every element, normalized to [1, 2) and without sign.
+		static SIMD GetMantissa(const SIMD& x) { return _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero); }
+
+		//Returns the sum of all elements.
+		[[nodiscard]] type HorizontalSum() const { return _mm512_reduce_add_ps(vector); }
+
+		[[nodiscard]] SIMD SquareRoot() const { return _mm512_sqrt_ps(vector); }
+
+		//Approximates 1 / sqrt(x), with a relative error below 2^-14.
+		[[nodiscard]] SIMD ReciprocalSquareRootEstimate() const { return _mm512_rsqrt14_ps(vector); }
+
+		uint16 BitMask() const { return _mm512_movepi32_mask(_mm512_castps_si512(vector)); }
+
+		SIMD operator-() const { return _mm512_xor_ps(vector, _mm512_set1_ps(-0.0f)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm512_add_ps(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm512_sub_ps(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm512_mul_ps(vector, other.vector); }
+		SIMD operator/(const SIMD& other) const { return _mm512_div_ps(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm512_add_ps(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm512_sub_ps(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm512_mul_ps(vector, other.vector); return *this; }
+		SIMD& operator/=(const SIMD& other) { vector = _mm512_div_ps(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_EQ_OQ)); }
+		SIMD operator!=(const SIMD& other) const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_NEQ_OQ)); }
+		SIMD operator>(const SIMD& other)  const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_GT_OQ)); }
+		SIMD operator>=(const SIMD& other) const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_GE_OQ)); }
+		SIMD operator<(const SIMD& other)  const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_LT_OQ)); }
+		SIMD operator<=(const SIMD& other) const { return fromMask(_mm512_cmp_ps_mask(vector, other.vector, _CMP_LE_OQ)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm512_and_ps(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm512_or_ps(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm512_xor_ps(vector, other.vector); }
+
+	private:
+		__m512 vector;
+
+		SIMD(const __m512 m512) : vector(m512) {}
+		operator __m512() const { return vector; }
+
+		static SIMD fromMask(const __mmask16 mask) { return _mm512_castsi512_ps(_mm512_maskz_set1_epi32(mask, -1)); }
+	};
+
+	template<>
+	class alignas(64) SIMD<float64, 8> {
+	public:
+		using type = float64;
+		static constexpr uint8 ElementCount = 8;
+
+		SIMD() : vector(_mm512_setzero_pd()) {}
+
+		SIMD(const type a) : vector(_mm512_set1_pd(a)) {}
+
+		SIMD(const AlignedPointer<const type, 64> data) : vector(_mm512_load_pd(data.Get())) {}
+		SIMD(const UnalignedPointer<const type> data) : vector(_mm512_loadu_pd(data.Get())) {}
+
+		SIMD(const SIMD& other) = default;
+
+		~SIMD() = default;
+
+		SIMD& operator=(const type a) { vector = _mm512_set1_pd(a); return *this; }
+		SIMD& operator=(const SIMD& other) { vector = other.vector; return *this; }
+
+		void CopyTo(const AlignedPointer<type, 64> data) const { _mm512_store_pd(data.Get(), vector); }
+		void CopyTo(const UnalignedPointer<type> data) const { _mm512_storeu_pd(data.Get(), vector); }
+
+		static SIMD Abs(const SIMD& a) { return _mm512_abs_pd(a); }
+
+		static SIMD Floor(const SIMD& a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+		static SIMD Min(const SIMD& a, const SIMD& b) { return _mm512_min_pd(a, b); }
+		static SIMD Max(const SIMD& a, const SIMD& b) { return _mm512_max_pd(a, b); }
+
+		//Returns a * b + c, rounded once.
+		static SIMD MultiplyAdd(const SIMD& a, const SIMD& b, const SIMD& c) { return _mm512_fmadd_pd(a, b, c); }
+
+		//Returns the sum of all elements.
+		[[nodiscard]] type HorizontalSum() const { return _mm512_reduce_add_pd(vector); }
+
+		[[nodiscard]] SIMD SquareRoot() const { return _mm512_sqrt_pd(vector); }
+
+		uint8 BitMask() const { return _mm512_movepi64_mask(_mm512_castpd_si512(vector)); }
+
+		SIMD operator+(const SIMD& other) const { return _mm512_add_pd(vector, other.vector); }
+		SIMD operator-(const SIMD& other) const { return _mm512_sub_pd(vector, other.vector); }
+		SIMD operator*(const SIMD& other) const { return _mm512_mul_pd(vector, other.vector); }
+		SIMD operator/(const SIMD& other) const { return _mm512_div_pd(vector, other.vector); }
+
+		SIMD& operator+=(const SIMD& other) { vector = _mm512_add_pd(vector, other.vector); return *this; }
+		SIMD& operator-=(const SIMD& other) { vector = _mm512_sub_pd(vector, other.vector); return *this; }
+		SIMD& operator*=(const SIMD& other) { vector = _mm512_mul_pd(vector, other.vector); return *this; }
+		SIMD& operator/=(const SIMD& other) { vector = _mm512_div_pd(vector, other.vector); return *this; }
+
+		SIMD operator==(const SIMD& other) const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_EQ_OQ)); }
+		SIMD operator!=(const SIMD& other) const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_NEQ_OQ)); }
+		SIMD operator>(const SIMD& other)  const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_GT_OQ)); }
+		SIMD operator>=(const SIMD& other) const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_GE_OQ)); }
+		SIMD operator<(const SIMD& other)  const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_LT_OQ)); }
+		SIMD operator<=(const SIMD& other) const { return fromMask(_mm512_cmp_pd_mask(vector, other.vector, _CMP_LE_OQ)); }
+
+		SIMD operator&(const SIMD& other) const { return _mm512_and_pd(vector, other.vector); }
+		SIMD operator|(const SIMD& other) const { return _mm512_or_pd(vector, other.vector); }
+		SIMD operator^(const SIMD& other) const { return _mm512_xor_pd(vector, other.vector); }
+
+	private:
+		__m512d vector;
+
+		SIMD(const __m512d m512) : vector(m512) {}
+		operator __m512d() const { return vector; }
+
+		static SIMD fromMask(const __mmask8 mask) { return _mm512_castsi512_pd(_mm512_maskz_set1_epi64(mask, -1)); }
+	};
+
+GTSL_END_TARGET_FUNCTIONS
+
 	inline SIMD<float32, 4>::SIMD(const SIMD<int32, 4> other) : vector(_mm_castsi128_ps(other.vector)) {}
+GTSL_BEGIN_AVX2_FUNCTIONS
 	inline SIMD<float, 8>::SIMD(const SIMD<int32, 8> other) : vector(_mm256_castsi256_ps(other.vector)) {}
+	inline SIMD<int32, 8> SIMD<float32, 8>::RoundToInt32() const { return SIMD<int32, 8>(_mm256_cvtps_epi32(vector)); }
+	inline SIMD<float32, 8> SIMD<float32, 8>::ConvertFromInt32(const SIMD<int32, 8> integers) { return _mm256_cvtepi32_ps(integers.vector); }
+	inline SIMD<float32, 8> SIMD<float32, 8>::Gather(const float32* base, const SIMD<int32, 8> indices) { return _mm256_i32gather_ps(base, indices.vector, 4); }
+GTSL_END_TARGET_FUNCTIONS
 
 	using float4x = SIMD<float32, 4>;
 	using float8x = SIMD<float32, 8>;
+	using float16x = SIMD<float32, 16>;
 }
\ No newline at end of file
@@ -7,6 +7,22 @@
 #include "Atomic.hpp"
 
 namespace GTSL {
+    /**
+     * \brief Intrusive node which gets called when a Semaphore or Notification reaches zero, allows waiting without blocking a thread.
+     */
+    struct SynchronizationWaiter {
+        SynchronizationWaiter* Next = nullptr;
+        void(*Callback)(SynchronizationWaiter*) = nullptr;
+    };
+
+    inline void NotifyWaiters(SynchronizationWaiter* waiter) {
+        while (waiter) {
+            auto* next = waiter->Next; // callback may destroy the node
+            waiter->Callback(waiter);
+            waiter = next;
+        }
+    }
+
     class Semaphore {
     public:
         Semaphore() = default;
@@ -23,12 +39,16 @@ namespace GTSL {
         Semaphore& operator++() { Add(); return *this; }
     	
         void Post() noexcept {
+            SynchronizationWaiter* toNotify = nullptr;
+
             {
                 Lock lock(mutex);
                 --count;
+                if (count == 0) { toNotify = waiters; waiters = nullptr; }
             }
         	
             cv.NotifyOne();
+            NotifyWaiters(toNotify);
         }
     	
         Semaphore& operator--() { Post(); return *this; }
@@ -37,11 +57,23 @@ namespace GTSL {
             Lock lock(mutex);
             cv.Wait(lock, [&]() { return count == 0; });
         }
+
+        /**
+         * \brief Registers waiter to be called, from the thread that makes the count reach zero, instead of blocking.
+         * \return False if count already is zero, in which case waiter will not be called.
+         */
+        bool AddWaiter(SynchronizationWaiter* waiter) noexcept {
+            Lock lock(mutex);
+            if (count == 0) { return false; }
+            waiter->Next = waiters; waiters = waiter;
+            return true;
+        }
     
     private:
         int32 count = 0;
         Mutex mutex;
         ConditionVariable cv;
+        SynchronizationWaiter* waiters = nullptr;
     };
 
     class Notification {
@@ -53,7 +85,15 @@ namespace GTSL {
         Notification& operator++() { Add(); return *this; }
 
         void Post() noexcept {
-        	--count;
+            if (--count == 0) {
+                SynchronizationWaiter* toNotify = nullptr;
+                {
+                    Lock lock(waitersMutex);
+                    toNotify = waiters; waiters = nullptr;
+                }
+                NotifyWaiters(toNotify);
+            }
+
             cv.NotifyAll();
         }
 
@@ -65,8 +105,21 @@ namespace GTSL {
             cv.Wait(lock);
         }
 
+        /**
+         * \brief Registers waiter to be called, from the thread that makes the count reach zero, instead of blocking.
+         * \return False if count already is zero, in which case waiter will not be called.
+         */
+        bool AddWaiter(SynchronizationWaiter* waiter) noexcept {
+            Lock lock(waitersMutex);
+            if (!count) { return false; }
+            waiter->Next = waiters; waiters = waiter;
+            return true;
+        }
+
     private:
         Atomic<uint32> count;
         ConditionVariable cv;
+        Mutex waitersMutex;
+        SynchronizationWaiter* waiters = nullptr;
     };
 }
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Core.h"
+#include "Atomic.hpp"
+#include "Memory.h"
+
+#include <type_traits>
+
+namespace GTSL
+{
+	/**
+	 * \brief Sequence lock, protects a small trivially copyable value which is read far more often than written.
+	 * Readers never write to shared memory, they copy the value optimistically and retry if a writer was active while copying.
+	 * Writers are serialized among themselves by spinning on the sequence counter.
+	 * \tparam T Type of the protected value, must be trivially copyable.
+	 */
+	template<typename T>
+	class SeqLock {
+		static_assert(std::is_trivially_copyable_v<T>, "SeqLock can only protect trivially copyable types.");
+	public:
+		SeqLock() = default;
+		explicit SeqLock(const T& value) : value(value) {}
+
+		SeqLock(const SeqLock&) = delete;
+		SeqLock& operator=(const SeqLock&) = delete;
+
+		/**
+		 * \brief Returns a consistent snapshot of the protected value, spins while a write is in progress.
+		 * \return Copy of the protected value.
+		 */
+		[[nodiscard]] T Read() const noexcept {
+			T result;
+			while (!TryRead(&result)) { SpinPause(); }
+			return result;
+		}
+
+		/**
+		 * \brief Tries to take a consistent snapshot of the protected value once.
+		 * \param result Pointer to write the snapshot to, contents are unspecified if false is returned.
+		 * \return Whether the snapshot is consistent.
+		 */
+		bool TryRead(T* result) const noexcept {
+			const uint32 begin = AtomicLoad(sequence, MemoryOrder::ACQUIRE);
+			if (begin & 1u) { return false; }
+			MemCopy(sizeof(T), &value, result);
+			AtomicFence(MemoryOrder::ACQUIRE);
+			return AtomicLoad(sequence, MemoryOrder::RELAXED) == begin;
+		}
+
+		/**
+		 * \brief Replaces the protected value.
+		 * \param newValue Value to store.
+		 */
+		void Write(const T& newValue) noexcept {
+			beginWrite();
+			MemCopy(sizeof(T), &newValue, &value);
+			endWrite();
+		}
+
+		/**
+		 * \brief Modifies the protected value in place while holding the write side of the lock.
+		 * \param function Callable which takes a T& as it's parameter.
+		 */
+		template<typename F>
+		void Modify(F&& function) noexcept {
+			beginWrite();
+			function(value);
+			endWrite();
+		}
+
+		/**
+		 * \brief Returns the current sequence number, can be used to cheaply check if the value changed since a previous read.
+		 */
+		[[nodiscard]] uint32 GetSequence() const noexcept { return AtomicLoad(sequence, MemoryOrder::ACQUIRE); }
+
+	private:
+		alignas(64) uint32 sequence = 0;
+		T value{};
+
+		void beginWrite() noexcept {
+			uint32 current = AtomicLoad(sequence, MemoryOrder::RELAXED);
+
+			while ((current & 1u) || !AtomicCompareExchange(sequence, &current, current + 1, MemoryOrder::ACQUIRE)) {
+				SpinPause();
+				current = AtomicLoad(sequence, MemoryOrder::RELAXED);
+			}
+
+			AtomicFence(MemoryOrder::RELEASE);
+		}
+
+		void endWrite() noexcept {
+			AtomicStore(sequence, sequence + 1, MemoryOrder::RELEASE);
+		}
+	};
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Core.h"
+#include "Assert.h"
+#include "Atomic.hpp"
+#include "Thread.hpp"
+
+#include <concepts>
+#include <limits>
+
+namespace GTSL
+{
+	/**
+	 * \brief Counter split in one cache line per thread(indexed by Thread::ThisTreadID()) so concurrent increments never contend.
+	 * Every slot is only written by it's owning thread, which makes increments wait free plain stores, reads aggregate every slot.
+	 * Slot 0 is shared by the main thread and every thread not started by GTSL::Thread, which all report id 0, so it's updated with atomic read-modify-writes instead.
+	 * \tparam MAX_THREADS Maximum number of threads that can use this counter, thread ids must be lower than this.
+	 */
+	template<uint32 MAX_THREADS = 64>
+	class ShardedCounter {
+	public:
+		ShardedCounter() = default;
+		ShardedCounter(const ShardedCounter&) = delete;
+		ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+		void Add(const uint64 delta = 1) noexcept {
+			const uint32 threadId = getThreadId(); auto& value = slots[threadId].Value;
+			if (threadId) { AtomicStore(value, AtomicLoad(value, MemoryOrder::RELAXED) + delta, MemoryOrder::RELAXED); } else { AtomicFetchAdd(value, delta, MemoryOrder::RELAXED); }
+		}
+
+		ShardedCounter& operator++() noexcept { Add(1); return *this; }
+		ShardedCounter& operator+=(const uint64 delta) noexcept { Add(delta); return *this; }
+
+		/**
+		 * \brief Returns the sum of all slots, concurrent increments may or may not be accounted for.
+		 */
+		[[nodiscard]] uint64 Read() const noexcept {
+			uint64 sum = 0;
+			for (const auto& slot : slots) { sum += AtomicLoad(slot.Value, MemoryOrder::RELAXED); }
+			return sum;
+		}
+
+		/**
+		 * \brief Sets every slot to zero, must not be called while other threads are adding.
+		 */
+		void Reset() noexcept {
+			for (auto& slot : slots) { AtomicStore(slot.Value, 0ull, MemoryOrder::RELAXED); }
+		}
+
+	private:
+		struct alignas(64) Slot {
+			uint64 Value = 0;
+		};
+
+		Slot slots[MAX_THREADS];
+
+		static uint32 getThreadId() noexcept {
+			GTSL_ASSERT(Thread::ThisTreadID() < MAX_THREADS, "Thread id is out of bounds for this counter.")
+			return Thread::ThisTreadID();
+		}
+	};
+
+	/**
+	 * \brief Aggregated view of a sharded gauge or histogram.
+	 */
+	template<typename T>
+	struct Statistics {
+		uint64 Count = 0;
+		T Sum = 0, Min = 0, Max = 0;
+
+		[[nodiscard]] T GetAverage() const { return Count ? Sum / static_cast<T>(Count) : T(0); }
+	};
+
+	/**
+	 * \brief Count/sum/min/max of the samples taken by a single thread, only written by it's owning thread unless it's shared.
+	 */
+	template<std::integral T>
+	struct StatisticsSlot {
+		static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 4 and 8 byte types are supported.");
+
+		uint64 Count = 0;
+		T Sum = 0, Min = std::numeric_limits<T>::max(), Max = std::numeric_limits<T>::lowest();
+
+		/**
+		 * \param shared Whether other threads may sample into this slot concurrently, shared slots are updated with atomic read-modify-writes.
+		 */
+		void Sample(const T value, const bool shared) noexcept {
+			if (shared) {
+				T current = AtomicLoad(Min, MemoryOrder::RELAXED);
+				while (value < current && !AtomicCompareExchange(Min, &current, value, MemoryOrder::RELAXED)) {}
+				current = AtomicLoad(Max, MemoryOrder::RELAXED);
+				while (value > current && !AtomicCompareExchange(Max, &current, value, MemoryOrder::RELAXED)) {}
+
+				AtomicFetchAdd(Sum, value, MemoryOrder::RELAXED);
+				AtomicFetchAdd(Count, static_cast<uint64>(1), MemoryOrder::RELAXED);
+				return;
+			}
+
+			if (value < AtomicLoad(Min, MemoryOrder::RELAXED)) { AtomicStore(Min, value, MemoryOrder::RELAXED); }
+			if (value > AtomicLoad(Max, MemoryOrder::RELAXED)) { AtomicStore(Max, value, MemoryOrder::RELAXED); }
+
+			AtomicStore(Sum, static_cast<T>(AtomicLoad(Sum, MemoryOrder::RELAXED) + value), MemoryOrder::RELAXED);
+			AtomicStore(Count, AtomicLoad(Count, MemoryOrder::RELAXED) + 1, MemoryOrder::RELAXED);
+		}
+
+		void Aggregate(Statistics<T>& statistics) const noexcept {
+			const uint64 slotCount = AtomicLoad(Count, MemoryOrder::RELAXED);
+			if (!slotCount) { return; }
+
+			const T slotMin = AtomicLoad(Min, MemoryOrder::RELAXED), slotMax = AtomicLoad(Max, MemoryOrder::RELAXED);
+
+			if (!statistics.Count || slotMin < statistics.Min) { statistics.Min = slotMin; }
+			if (!statistics.Count || slotMax > statistics.Max) { statistics.Max = slotMax; }
+
+			statistics.Sum += AtomicLoad(Sum, MemoryOrder::RELAXED);
+			statistics.Count += slotCount;
+		}
+	};
+
+	/**
+	 * \brief Per thread sharded count/sum/min/max tracker for sampled values such as latencies or queue depths. Slot 0 is shared like ShardedCounter's.
+	 * \tparam T Integral type of the sampled values.
+	 * \tparam MAX_THREADS Maximum number of threads that can use this gauge, thread ids must be lower than this.
+	 */
+	template<std::integral T, uint32 MAX_THREADS = 64>
+	class ShardedGauge {
+	public:
+		ShardedGauge() = default;
+		ShardedGauge(const ShardedGauge&) = delete;
+		ShardedGauge& operator=(const ShardedGauge&) = delete;
+
+		void Sample(const T value) noexcept { const uint32 threadId = getThreadId(); slots[threadId].Samples.Sample(value, !threadId); }
+
+		/**
+		 * \brief Aggregates every slot, concurrent samples may or may not be accounted for.
+		 */
+		[[nodiscard]] Statistics<T> Read() const noexcept {
+			Statistics<T> statistics;
+			for (const auto& slot : slots) { slot.Samples.Aggregate(statistics); }
+			return statistics;
+		}
+
+		/**
+		 * \brief Clears every slot, must not be called while other threads are sampling.
+		 */
+		void Reset() noexcept {
+			for (auto& slot : slots) { slot = Slot(); }
+		}
+
+	private:
+		struct alignas(64) Slot {
+			StatisticsSlot<T> Samples;
+		};
+
+		Slot slots[MAX_THREADS];
+
+		static uint32 getThreadId() noexcept {
+			GTSL_ASSERT(Thread::ThisTreadID() < MAX_THREADS, "Thread id is out of bounds for this gauge.")
+			return Thread::ThisTreadID();
+		}
+	};
+
+	/**
+	 * \brief Per thread sharded histogram with power of two buckets, bucket 0 counts zeroes and bucket i counts values in [2^(i-1), 2^i).
+	 * Values past the last bucket are counted in the last bucket. Also tracks count/sum/min/max like ShardedGauge. Slot 0 is shared like ShardedCounter's.
+	 * \tparam T Integral type of the sampled values.
+	 * \tparam BUCKETS Number of buckets.
+	 * \tparam MAX_THREADS Maximum number of threads that can use this histogram, thread ids must be lower than this.
+	 */
+	template<std::integral T, uint32 BUCKETS = 32, uint32 MAX_THREADS = 64>
+	class ShardedHistogram {
+		static_assert(BUCKETS > 1 && BUCKETS <= 65, "Bucket count must be between 2 and 65.");
+	public:
+		ShardedHistogram() = default;
+		ShardedHistogram(const ShardedHistogram&) = delete;
+		ShardedHistogram& operator=(const ShardedHistogram&) = delete;
+
+		void Sample(const T value) noexcept {
+			const uint32 threadId = getThreadId(); auto& slot = slots[threadId];
+			auto& bucket = slot.Buckets[GetBucketIndex(value)];
+			if (threadId) { AtomicStore(bucket, AtomicLoad(bucket, MemoryOrder::RELAXED) + 1, MemoryOrder::RELAXED); } else { AtomicFetchAdd(bucket, static_cast<uint64>(1), MemoryOrder::RELAXED); }
+			slot.Samples.Sample(value, !threadId);
+		}
+
+		[[nodiscard]] Statistics<T> GetStatistics() const noexcept {
+			Statistics<T> statistics;
+			for (const auto& slot : slots) { slot.Samples.Aggregate(statistics); }
+			return statistics;
+		}
+
+		/**
+		 * \brief Returns the number of samples which fell in bucket, aggregated across all threads.
+		 */
+		[[nodiscard]] uint64 GetBucket(const uint32 bucket) const noexcept {
+			uint64 count = 0;
+			for (const auto& slot : slots) { count += AtomicLoad(slot.Buckets[bucket], MemoryOrder::RELAXED); }
+			return count;
+		}
+
+		/**
+		 * \brief Returns an upper bound of the value below which percentile(0 - 1) of the samples fall, resolution is that of the buckets.
+		 */
+		[[nodiscard]] uint64 GetPercentileUpperBound(const float64 percentile) const noexcept {
+			uint64 buckets[BUCKETS], total = 0;
+			for (uint32 i = 0; i < BUCKETS; ++i) { buckets[i] = GetBucket(i); total += buckets[i]; }
+
+			const uint64 target = static_cast<uint64>(static_cast<float64>(total) * percentile);
+
+			uint64 accumulated = 0;
+			for (uint32 i = 0; i < BUCKETS; ++i) {
+				accumulated += buckets[i];
+				if (accumulated >= target && accumulated) { return i ? (i < 64 ? (1ull << i) - 1 : ~0ull) : 0; }
+			}
+
+			return 0;
+		}
+
+		static uint32 GetBucketIndex(const T value) noexcept {
+			if (value <= 0) { return 0; }
+#if _WIN64
+			unsigned long lastSetBit; _BitScanReverse64(&lastSetBit, static_cast<uint64>(value));
+			const uint32 bits = static_cast<uint32>(lastSetBit) + 1;
+#elif __linux__
+			const uint32 bits = 64 - static_cast<uint32>(__builtin_clzll(static_cast<uint64>(value)));
+#endif
+			return bits < BUCKETS ? bits : BUCKETS - 1;
+		}
+
+		/**
+		 * \brief Clears every slot, must not be called while other threads are sampling.
+		 */
+		void Reset() noexcept {
+			for (auto& slot : slots) { slot = Slot(); }
+		}
+
+	private:
+		struct alignas(64) Slot {
+			StatisticsSlot<T> Samples;
+			uint64 Buckets[BUCKETS]{};
+		};
+
+		Slot slots[MAX_THREADS];
+
+		static uint32 getThreadId() noexcept {
+			GTSL_ASSERT(Thread::ThisTreadID() < MAX_THREADS, "Thread id is out of bounds for this histogram.")
+			return Thread::ThisTreadID();
+		}
+	};
+}
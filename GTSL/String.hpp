@@ -7,7 +7,11 @@
 
 namespace GTSL
 {
-	//UTF-8
+	/**
+	 * \brief Growable UTF-8 string which knows it's length in bytes and code points.
+	 * Strings of up to 21 bytes are stored inside the object and never allocate, longer ones spill to the allocator transparently.
+	 * The text is always followed by at least 3 null bytes.
+	 */
 	template<class ALLOCATOR>
 	class String {
 	public:
@@ -32,8 +36,8 @@ namespace GTSL
 			copy(other);
 		}
 
-		String(String&& other) noexcept requires std::move_constructible<ALLOCATOR> : allocator(MoveRef(other.allocator)), data(other.data), codePoints(other.codePoints), bytes(other.bytes), capacity(other.capacity) {
-			other.data = nullptr; other.bytes = 0; other.codePoints = 0; other.capacity = 0;
+		String(String&& other) noexcept requires std::move_constructible<ALLOCATOR> : allocator(MoveRef(other.allocator)) {
+			take(other);
 		}
 
 		String& operator=(const StringView range) {
@@ -51,20 +55,14 @@ namespace GTSL
 		}
 
 		String& operator=(String&& other) noexcept requires std::move_constructible<ALLOCATOR> {
-			//free current
+			if (!isInline()) { allocator.Deallocate(capacity, 16, data); }
 			allocator = MoveRef(other.allocator);
-			data = other.data;
-			bytes = other.bytes;
-			codePoints = other.codePoints;
-			capacity = other.capacity;
-
-			other.bytes = 0; other.codePoints = 0; other.capacity = 0; other.data = nullptr;
-
+			take(other);
 			return *this;
 		}
 
 		~String() {
-			if (data) { allocator.Deallocate(capacity, 16, data); }
+			if (!isInline()) { allocator.Deallocate(capacity, 16, data); }
 		}
 
 		char32_t operator[](const uint32 cp) const noexcept {
@@ -85,7 +83,9 @@ namespace GTSL
 		//Return the length of this String.
 		[[nodiscard]] uint32 GetBytes() const { return bytes; }
 		[[nodiscard]] uint32 GetCodepoints() const { return codePoints; }
-		[[nodiscard]] uint32 GetCapacity() const { return capacity; }
+		[[nodiscard]] uint32 GetCapacity() const { return isInline() ? INLINE_CAPACITY : capacity; }
+		//Returns whether the text is stored inside the object, not allocated.
+		[[nodiscard]] bool IsInline() const { return isInline(); }
 		//Returns whether this String is empty.
 		[[nodiscard]] bool IsEmpty() const { return !bytes; }
 
@@ -129,9 +129,9 @@ namespace GTSL
 		}
 
 		String& operator+=(char8_t character) {
-			tryResize(1 + 3/*res len*/);
+			tryResize(bytes + 1);
 			data[bytes++] = character;
-			for (uint8 i = 0; i < 4; ++i)
+			for (uint8 i = 0; i < 3; ++i)
 				data[bytes + i] = u8'\0';
 			++codePoints;
 			return *this;
@@ -170,9 +170,9 @@ namespace GTSL
 		 */
 		void Drop(uint32 cp) {
 			auto pos = getByteAndLengthForCodePoint(cp);
-			bytes = Get<0>(pos); data[Get<0>(pos)] = u8'\0';
+			bytes = Get<0>(pos);
 			codePoints = Get<1>(pos);
-			for (uint8 i = 0; i < 4; ++i)
+			for (uint8 i = 0; i < 3; ++i) // only 3 bytes of null padding are reserved past the text
 				data[Get<0>(pos) + i] = u8'\0';
 		}
 
@@ -236,6 +236,12 @@ namespace GTSL
 		//	}
 		//}
 
+		//Lowers every ASCII letter in place, a vector at a time.
+		friend void ToLowerCase(String& string) { ToLowerCase(string.data, string.bytes); }
+
+		//Raises every ASCII letter in place, a vector at a time.
+		friend void ToUpperCase(String& string) { ToUpperCase(string.data, string.bytes); }
+
 		friend void ReplaceAll(String& string, char8_t a, char8_t with) {
 			for (uint32 i = 0; i < string.bytes; ++i) { if (string.data[i] == a) { string.data[i] = with; } }
 		}
@@ -303,7 +309,7 @@ namespace GTSL
 
 				string.codePoints -= Get<1>(p);
 
-				for (uint8 i = 0; i < 4; ++i)
+				for (uint8 i = 0; i < 3; ++i)
 					string.data[string.bytes + i] = u8'\0';
 
 				return true;
@@ -324,7 +330,7 @@ namespace GTSL
 
 				string.codePoints -= Get<1>(p);
 
-				for (uint8 i = 0; i < 4; ++i)
+				for (uint8 i = 0; i < 3; ++i)
 					string.data[string.bytes + i] = u8'\0';
 
 				return true;
@@ -343,9 +349,29 @@ namespace GTSL
 		}
 	
 	private:
+		static constexpr uint32 INLINE_CAPACITY = 24;
+
 		[[no_unique_address]] ALLOCATOR allocator;
-		char8_t* data = nullptr;
-		uint32 codePoints = 0, bytes = 0, capacity = 0;
+		char8_t* data = inlineData; // points to inlineData until the text spills to the allocator
+		uint32 codePoints = 0, bytes = 0;
+		union { uint32 capacity; char8_t inlineData[INLINE_CAPACITY] = {}; }; // capacity is only used once data is allocated
+
+		bool isInline() const { return data == inlineData; }
+
+		// takes other's text, copying it if inline and stealing the allocation if not, and leaves other empty
+		void take(String& other) {
+			codePoints = other.codePoints; bytes = other.bytes;
+
+			if (other.isInline()) {
+				data = inlineData;
+				for (uint32 i = 0; i < INLINE_CAPACITY; ++i) { inlineData[i] = other.inlineData[i]; }
+			} else {
+				data = other.data; capacity = other.capacity;
+			}
+
+			other.data = other.inlineData; other.bytes = 0; other.codePoints = 0;
+			for (uint8 i = 0; i < 3; ++i) { other.inlineData[i] = u8'\0'; }
+		}
 
 		uint32 getCodepoints() const { return codePoints; }
 		uint32 getBytes() const { return bytes; }
@@ -368,18 +394,21 @@ namespace GTSL
 		void tryResize(uint32 newSize) {
 			newSize += 3; /*null terminator padding*/
 
-			if (newSize > capacity) {				
-				if(data) {
-					GTSL::Resize(allocator, &data, &capacity, newSize * 2, bytes);
+			if (newSize > GetCapacity()) {
+				if (isInline()) {
+					char8_t* allocated; uint32 allocatedBytes;
+					Allocate(allocator, newSize, &allocated, &allocatedBytes);
+					MemCopy(bytes, inlineData, allocated);
+					data = allocated; capacity = allocatedBytes;
 				} else {
-					Allocate(allocator, newSize, &data, &capacity);
+					GTSL::Resize(allocator, &data, &capacity, newSize * 2, bytes);
 				}
 			}
 		}
 		
 		void copy(const Range<const char8_t*> string) {
 			tryResize(bytes + string.GetBytes());
-			for(uint32 i = 0; i < string.GetBytes(); ++i) { data[bytes + i] = string.GetData()[i]; }
+			if (string.GetBytes()) { MemCopy(string.GetBytes(), string.GetData(), data + bytes); }
 			bytes += string.GetBytes(); codePoints += string.GetCodepoints();
 			for (uint32 i = 0, pos = bytes; i < 3; ++i, ++pos) { data[pos] = u8'\0'; }
 		}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "Core.h"
+#include "Allocator.hpp"
+#include "StringCommon.h"
+#include "Unicode.hpp"
+
+#include <cstring>
+
+namespace GTSL
+{
+	/**
+	 * \brief Assembles large UTF-8 text by appending in to a chain of fixed size chunks, so growing never moves or copies what was already written.
+	 * Numbers are formatted straight in to chunk space. Chunks split on code point boundaries, so every chunk is valid text on it's own,
+	 * and they can be written to a File as one scatter/gather write without ever joining them.
+	 * Works with every function taking a string to append to, like ToString and the JSON serializer.
+	 * \tparam ALLOCATOR Allocator for the chunks.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class StringBuilder {
+	public:
+		/**
+		 * \param chunkBytes Capacity of every chunk. Appends longer than a chunk get a chunk of their own size, so they are copied once.
+		 */
+		explicit StringBuilder(const uint32 chunkBytes = 16 * 1024, const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), chunkBytes(chunkBytes < MAX_FORMATTED_BYTES ? MAX_FORMATTED_BYTES : chunkBytes) {}
+
+		StringBuilder(const StringBuilder&) = delete;
+		StringBuilder& operator=(const StringBuilder&) = delete;
+
+		StringBuilder(StringBuilder&& other) noexcept : allocator(MoveRef(other.allocator)), chunkBytes(other.chunkBytes), first(other.first), last(other.last), bytes(other.bytes), codepoints(other.codepoints), chunks(other.chunks) {
+			other.first = nullptr; other.last = nullptr; other.bytes = 0; other.codepoints = 0; other.chunks = 0;
+		}
+
+		~StringBuilder() { freeChunks(first); }
+
+		StringBuilder& operator+=(const StringView string) {
+			const char8_t* data = string.GetData(); uint32 remaining = string.GetBytes(), remainingCodepoints = string.GetCodepoints();
+
+			while (remaining) {
+				uint32 fit = last ? last->Capacity - last->Bytes : 0;
+
+				if (fit < remaining) {
+					while (fit && (data[fit] & 0xC0) == 0x80) { --fit; } // don't split a code point between chunks
+					if (!fit) { newChunk(remaining); continue; }
+				} else {
+					fit = remaining;
+				}
+
+				const uint32 fitCodepoints = fit == remaining ? remainingCodepoints : CountUTF8Codepoints(data, fit);
+				std::memcpy(getData(last) + last->Bytes, data, fit);
+				last->Bytes += fit; last->Codepoints += fitCodepoints;
+				bytes += fit; codepoints += fitCodepoints;
+				data += fit; remaining -= fit; remainingCodepoints -= fitCodepoints;
+			}
+
+			return *this;
+		}
+
+		StringBuilder& operator+=(const char8_t character) {
+			char8_t* space = reserve(1);
+			*space = character;
+			commit(1, 1);
+			return *this;
+		}
+
+		StringBuilder& operator<<(const StringView string) { return *this += string; }
+
+		/**
+		 * \brief Formats number directly in to the last chunk, without a temporary string. See FormatInteger.
+		 */
+		template<std::integral I> requires (!std::same_as<I, char8_t>)
+		friend void ToString(StringBuilder& builder, const I number) {
+			const uint32 length = FormatInteger(number, builder.reserve(MAX_FORMATTED_BYTES));
+			builder.commit(length, length);
+		}
+
+		/**
+		 * \brief Formats number directly in to the last chunk, without a temporary string. See FormatFloat.
+		 */
+		template<std::floating_point F>
+		friend void ToString(StringBuilder& builder, const F number) {
+			const uint32 length = FormatFloat(number, builder.reserve(MAX_FORMATTED_BYTES));
+			builder.commit(length, length);
+		}
+
+		/**
+		 * \brief Calls onChunk(StringView) for every chunk, in order. Every chunk is whole code points.
+		 */
+		template<typename F>
+		void ForEachChunk(F&& onChunk) const {
+			for (const chunk* c = first; c; c = c->Next) {
+				if (c->Bytes) { onChunk(StringView(c->Bytes, c->Codepoints, getData(c))); }
+			}
+		}
+
+		/**
+		 * \brief Writes every chunk to file in order, as one scatter/gather write per batch of chunks, without joining them.
+		 * \param file Anything with a Write(Range<const Range<const byte*>*>) like File.
+		 * \return Bytes written.
+		 */
+		template<class F>
+		uint64 WriteTo(const F& file) const {
+			constexpr uint32 BATCH = 64;
+			Range<const byte*> pieces[BATCH]; uint32 count = 0; uint64 written = 0;
+
+			for (const chunk* c = first; c; c = c->Next) {
+				pieces[count++] = Range<const byte*>(c->Bytes, reinterpret_cast<const byte*>(getData(c)));
+				if (count == BATCH) { written += file.Write(Range<const Range<const byte*>*>(count, pieces)); count = 0; }
+			}
+
+			if (count) { written += file.Write(Range<const Range<const byte*>*>(count, pieces)); }
+
+			return written;
+		}
+
+		/**
+		 * \brief Appends everything built to string, for when one contiguous string is needed after all.
+		 */
+		template<class S>
+		void CopyTo(S& string) const { ForEachChunk([&](const StringView chunk) { string += chunk; }); }
+
+		/**
+		 * \brief Empties the builder, keeping the first chunk to build again in to.
+		 */
+		void Clear() {
+			if (!first) { return; }
+			freeChunks(first->Next);
+			first->Next = nullptr; first->Bytes = 0; first->Codepoints = 0;
+			last = first; chunks = 1; bytes = 0; codepoints = 0;
+		}
+
+		/**
+		 * \brief Chops the text at the last occurrence of c, removing c and everything after it.
+		 * \return Whether c was found.
+		 */
+		friend bool RTrimLast(StringBuilder& builder, const char8_t c) {
+			chunk* found = nullptr; uint32 position = 0;
+
+			if (builder.last && findLast(builder.last, c, position)) { // trailing characters are nearly always in the last chunk
+				found = builder.last;
+			} else {
+				for (chunk* e = builder.first; e != builder.last; e = e->Next) {
+					if (uint32 p = 0; findLast(e, c, p)) { found = e; position = p; }
+				}
+			}
+
+			if (!found) { return false; }
+
+			for (chunk* e = found->Next; e; e = e->Next) { builder.bytes -= e->Bytes; builder.codepoints -= e->Codepoints; --builder.chunks; }
+			builder.freeChunks(found->Next);
+			found->Next = nullptr; builder.last = found;
+
+			const uint32 droppedCodepoints = CountUTF8Codepoints(getData(found) + position, found->Bytes - position);
+			builder.bytes -= found->Bytes - position; builder.codepoints -= droppedCodepoints;
+			found->Bytes = position; found->Codepoints -= droppedCodepoints;
+
+			return true;
+		}
+
+		[[nodiscard]] uint64 GetBytes() const { return bytes; }
+		[[nodiscard]] uint64 GetCodepoints() const { return codepoints; }
+		[[nodiscard]] uint32 GetChunkCount() const { return chunks; }
+		[[nodiscard]] bool IsEmpty() const { return !bytes; }
+
+	private:
+		static constexpr uint32 MAX_FORMATTED_BYTES = 32; // longest FormatInteger or FormatFloat output
+
+		struct chunk { chunk* Next; uint32 Bytes, Codepoints, Capacity, Words; }; // followed by Capacity bytes
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		uint32 chunkBytes;
+		chunk* first = nullptr; chunk* last = nullptr;
+		uint64 bytes = 0, codepoints = 0;
+		uint32 chunks = 0;
+
+		static bool findLast(const chunk* c, const char8_t character, uint32& position) {
+			for (uint32 i = c->Bytes; i--;) { if (getData(c)[i] == character) { position = i; return true; } }
+			return false;
+		}
+
+		static char8_t* getData(chunk* c) { return reinterpret_cast<char8_t*>(c + 1); }
+		static const char8_t* getData(const chunk* c) { return reinterpret_cast<const char8_t*>(c + 1); }
+
+		void newChunk(const uint32 atLeast) {
+			const uint32 capacity = atLeast > chunkBytes ? atLeast : chunkBytes;
+			const uint32 words = static_cast<uint32>((sizeof(chunk) + capacity + 7) / 8);
+
+			uint64* block; Allocate(allocator, words, &block);
+			auto* c = reinterpret_cast<chunk*>(block);
+			c->Next = nullptr; c->Bytes = 0; c->Codepoints = 0; c->Capacity = capacity; c->Words = words;
+
+			if (last) { last->Next = c; } else { first = c; }
+			last = c; ++chunks;
+		}
+
+		void freeChunks(chunk* c) {
+			while (c) {
+				chunk* next = c->Next;
+				Deallocate(allocator, c->Words, reinterpret_cast<uint64*>(c));
+				c = next;
+			}
+		}
+
+		// returns space for count bytes in the last chunk, opening a new one if they don't fit
+		char8_t* reserve(const uint32 count) {
+			if (!last || last->Capacity - last->Bytes < count) { newChunk(count); }
+			return getData(last) + last->Bytes;
+		}
+
+		void commit(const uint32 writtenBytes, const uint32 writtenCodepoints) {
+			last->Bytes += writtenBytes; last->Codepoints += writtenCodepoints;
+			bytes += writtenBytes; codepoints += writtenCodepoints;
+		}
+	};
+}
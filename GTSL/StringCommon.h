@@ -1,5 +1,6 @@
 #pragma once
 #include <regex>
+#include <type_traits>
 
 #include "Core.h"
 
@@ -8,7 +9,10 @@
 #include "Tuple.hpp"
 #include "Math/Math.hpp"
 #include "Unicode.hpp"
+#include "NumberConversion.hpp"
 #include "Algorithm.hpp"
+#include "Flags.h"
+#include "Hashing.hpp"
 
 namespace GTSL
 {
@@ -20,7 +24,12 @@ namespace GTSL
 	constexpr uint32 StringByteLength(const char8_t* text) noexcept { uint32 i{ 0 }; while (text[i] != '\0') { ++i; } return i; }
 	constexpr uint32 StringByteLengthNull(const char8_t* text) noexcept { return StringByteLength(text) + 1; }
 
+	/**
+	* \brief Computes the byte length, without the null terminator, and code point count of a c string. Vectorized at runtime, see UTF8Lengths.
+	*/
 	constexpr Pair<uint32, uint32> StringLengths(const char8_t* text) noexcept { 
+		if (!std::is_constant_evaluated()) { return UTF8Lengths(text); }
+
 		uint32 bytes = 0, cp = 0;
 		while (text[bytes] != u8'\0') { bytes += UTF8CodePointLength(text[bytes]); ++cp; }
 		return { bytes, cp };
@@ -84,7 +93,9 @@ namespace GTSL
 			bytes = lengths.First; codepoints = lengths.Second;
 		}
 
-		constexpr Range(const Byte bytes, const char8_t* string) : data(string), bytes(GTSL::uint64(bytes)) {
+		constexpr Range(const Byte bytes, const char8_t* string) : data(string), bytes(static_cast<uint32>(bytes.GetCount())) {
+			GTSL_ASSERT(bytes.GetCount() <= 0xFFFFFFFFull, "String views are limited to 4GB.")
+			if (!std::is_constant_evaluated()) { codepoints = CountUTF8Codepoints(data, this->bytes); return; }
 			for (uint32 i = 0; i < bytes.GetCount();) { i += UTF8CodePointLength(data[i]); ++codepoints; }
 		}
 
@@ -92,6 +103,7 @@ namespace GTSL
 		}
 
 		constexpr Range(const StringIterator start, const StringIterator end) : data(start.data + start.currentByte) {
+			if (!std::is_constant_evaluated()) { bytes = end.currentByte - start.currentByte; codepoints = CountUTF8Codepoints(data, bytes); return; }
 			while (start.currentByte + bytes < end.currentByte) { bytes += UTF8CodePointLength(data[bytes]); ++codepoints; }
 		}
 
@@ -127,215 +139,290 @@ namespace GTSL
 	struct Hash<StringView> {
 		uint64 value = 0;
 
-		constexpr Hash(const StringView& string_view) {
-			uint64 primary_hash(525201411107845655ull);
-
-			for (uint32 i = 0; i < string_view.GetBytes(); ++i) {
-				primary_hash ^= string_view[i]; primary_hash *= 0x5bd1e9955bd1e995; primary_hash ^= primary_hash >> 47;
-			}
-
-			value = primary_hash;
-		}
+		constexpr Hash(const StringView& string_view) : value(HashBytes(string_view.GetData(), string_view.GetBytes())) {}
 
 		constexpr operator uint64() const { return value; }
 	};
 
 	Hash(const StringView) -> Hash<StringView>;
 
-	class SubstringIterator {
-	public:
-		SubstringIterator(const StringView sv) : stringView(sv), begin(sv.begin()), end(sv.begin()) {}
+	//Bit mask of the bytes of block equal to any of delimiters.
+	template<typename... C>
+	uint32 delimiterMask(const UTF8Vector block, C... delimiters) {
+		return static_cast<uint32>(((block == UTF8Vector(static_cast<uint8>(delimiters))) | ...).BitMask());
+	}
 
-		template<typename...C>
-		bool operator()(C ... divs) {
+	/**
+	 * \brief Returns the offset of the first byte at or after from which is a delimiter, or isn't when IS_DELIMITER is false, or bytes if there is none.
+	 */
+	template<bool IS_DELIMITER, typename... C>
+	uint32 findDelimiter(const char8_t* data, const uint32 bytes, uint32 from, C... delimiters) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector), ALL = WIDTH == 32 ? ~0u : 0xFFFFu;
+
+		for (; from + WIDTH <= bytes; from += WIDTH) {
+			const uint32 mask = delimiterMask(UTF8Vector(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + from))), delimiters...);
+			const uint32 found = IS_DELIMITER ? mask : ~mask & ALL;
+			if (found) { return from + FindFirstSetBit(found).Get(); }
+		}
 
-			while (end < stringView.end() && ((*end == divs) || ...)) {
-				++end;
-			}
+		for (; from < bytes; ++from) { if (((data[from] == delimiters) || ...) == IS_DELIMITER) { return from; } }
 
-			begin = end;
+		return bytes;
+	}
 
-			while (end < stringView.end() and ((*end != divs) && ...)) {
-				++end;
-			}
+	/**
+	 * \brief Walks the substrings of a string separated by any number of delimiters, by bytes, so delimiters must be ASCII and can't match inside a multi byte code point.
+	 */
+	class SubstringIterator {
+	public:
+		SubstringIterator(const StringView sv) : stringView(sv) {}
 
+		/**
+		 * \brief Advances to the next non empty substring.
+		 * \return Whether there was one.
+		 */
+		template<typename...C>
+		bool operator()(C ... divs) {
+			begin = findDelimiter<false>(stringView.GetData(), stringView.GetBytes(), end, divs...);
+			end = findDelimiter<true>(stringView.GetData(), stringView.GetBytes(), begin, divs...);
 			return begin != end;
 		}
 
 		StringView operator*() {
-			return StringView(begin, end);
+			return StringView(Byte(end - begin), stringView.GetData() + begin);
 		}
 
 	private:
 		StringView stringView;
-		StringIterator begin, end;
-
-		//static_assert(sizeof...(C) != 0, "You need at least one parameter to divide substrings.");
+		uint32 begin = 0, end = 0;
 	};
 
+	/**
+	 * \brief Calls f(StringView) for every non empty substring between delimiters.
+	 * Scans a vector of bytes at a time, every delimiter is compared against the whole vector and substring bounds are read off the bit mask,
+	 * code points of every substring are counted from the same vectors so they aren't walked a second time.
+	 * \param divs Delimiters, must be ASCII so they can't match inside a multi byte code point.
+	 */
 	template<typename...C>
 	void ForEachSubstring(const StringView string, auto&& f, C ... divs) {
 		static_assert(sizeof...(C) != 0, "You need at least one parameter to divide substrings.");
+		GTSL_ASSERT(((static_cast<char32_t>(divs) < 0x80) && ...), "Delimiters must be ASCII.");
 
-		auto it = string.begin();
+		constexpr uint32 WIDTH = sizeof(UTF8Vector), ALL = WIDTH == 32 ? ~0u : 0xFFFFu;
+		const UTF8Vector continuationMask(static_cast<uint8>(0xC0)), continuation(static_cast<uint8>(0x80));
 
-		while (it < string.end()) {
-			while (it < string.end() && ((*it == divs) || ...)) {
-				++it;
-			}
+		const char8_t* const data = string.GetData(); const uint32 bytes = string.GetBytes();
+		bool inSubstring = false;
+		uint32 start = 0, continuations = 0, startContinuations = 0; // continuation bytes before the current block and before the substring's start
+
+		auto emit = [&](const uint32 end, const uint32 endContinuations) {
+			f(StringView(end - start, (end - start) - (endContinuations - startContinuations), data + start));
+			inSubstring = false;
+		};
 
-			auto start = it;
+		uint32 i = 0;
 
-			while (it < string.end() and ((*it != divs) && ...)) {
-				++it;
+		for (; i + WIDTH <= bytes; i += WIDTH) {
+			const UTF8Vector block(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + i)));
+			const uint32 delimiters = delimiterMask(block, divs...);
+			const uint32 continuationBits = static_cast<uint32>(((block & continuationMask) == continuation).BitMask());
+
+			for (uint32 remaining = ALL; true;) { // flip between looking for the next substring start and end in this block
+				const uint32 boundaries = (inSubstring ? delimiters : ~delimiters) & remaining;
+				if (!boundaries) { break; }
+
+				const uint32 position = FindFirstSetBit(boundaries).Get();
+				const uint32 before = continuations + NumberOfSetBits(continuationBits & ((1u << position) - 1));
+
+				if (inSubstring) { emit(i + position, before); } else { start = i + position; startContinuations = before; inSubstring = true; }
+
+				remaining = ~((2u << position) - 1) & ALL; // bits after position, none when it's the last
 			}
 
-			f({ start, it });
+			continuations += NumberOfSetBits(continuationBits);
+		}
+
+		for (; i < bytes; ++i) {
+			const bool isDelimiter = ((data[i] == divs) || ...);
+
+			if (inSubstring && isDelimiter) { emit(i, continuations); }
+			else if (!inSubstring && !isDelimiter) { start = i; startContinuations = continuations; inSubstring = true; }
+
+			continuations += (data[i] & 0xC0) == 0x80;
 		}
+
+		if (inSubstring) { emit(bytes, continuations); }
 	}
 
+	/**
+	 * \brief Calls f(StringView) for every non empty line.
+	 */
 	void ForEachLine(const StringView string, auto&& f) {
-		ForEachSubstring(string, f, U'\n');
+		ForEachSubstring(string, f, u8'\n');
 	}
 
+	/**
+	 * \brief Appends every non empty substring between delimiters to container, as an element constructed empty and then appended to.
+	 */
 	template<typename...C>
 	void Substrings(const StringView string, auto& container, C... divs) {
 		static_assert(sizeof...(C) != 0, "You need at least one parameter to divide substrings.");
-		auto it = string.begin();
-
-		while (it < string.end() - 2) {
-			auto& a = container.EmplaceBack();
-
-			while (it < string.end() and ((*it == divs) || ...)) {
-				++it;
-			}
-
-			while (it < string.end() and ((*it != divs) && ...)) {
-				a += *it;
-				++it;
-			}
-		}
+		ForEachSubstring(string, [&](const StringView substring) { container.EmplaceBack() += substring; }, divs...);
 	}
 
 	void Lines(const StringView string, auto& container) {
 		Substrings(string, container, U'\n');
 	}
 
-	inline bool IsNumber(const StringView string) {
-		for (const auto e : string) {
-			if (e != U'0' and e != U'1' and e != U'2' and e != U'3' and e != U'4' and e != U'5' and e != U'6' and e != U'7' and e != U'8' and e != U'9' and e != U'.' and e != U',' and e != U'-') {
-				return false;
-			}
-		}
-		return string.GetBytes();
-	}
+	using CharacterClass = Flags<uint8, struct CharacterClassTag>;
 
-	inline bool IsDecimalNumber(const StringView string) {
-		bool hasDecimalSeparator = false;
+	// Bits of CharacterClass. Only ASCII is classified, every byte of a multi byte code point is NON_ASCII.
+	namespace CharacterClasses {
+		constexpr CharacterClass LOWER{ 1 }, UPPER{ 2 }, DIGIT{ 4 }, WHITESPACE{ 8 }, SYMBOL{ 16 }, CONTROL{ 32 }, NON_ASCII{ 128 };
+		constexpr CharacterClass LETTER{ 1 | 2 };
+	}
 
-		for (const auto e : string) {
-			if (e != U'0' and e != U'1' and e != U'2' and e != U'3' and e != U'4' and e != U'5' and e != U'6' and e != U'7' and e != U'8' and e != U'9' and e != U'.' and e != U'-') {
-				return false;
-			}
+	constexpr std::array<uint8, 256> characterClassTable() {
+		std::array<uint8, 256> table{};
 
-			if (e == U'.') { hasDecimalSeparator = true; }
+		for (uint32 c = 0; c < 128; ++c) {
+			if (u8'a' <= c && c <= u8'z') { table[c] = CharacterClasses::LOWER; }
+			else if (u8'A' <= c && c <= u8'Z') { table[c] = CharacterClasses::UPPER; }
+			else if (u8'0' <= c && c <= u8'9') { table[c] = CharacterClasses::DIGIT; }
+			else if (c == u8' ' || c == u8'\t') { table[c] = CharacterClasses::WHITESPACE; }
+			else if (c < 0x20 || c == 0x7F) { table[c] = CharacterClasses::CONTROL; }
+			else if (c != u8'@' && c != u8'\\' && c != u8'`') { table[c] = CharacterClasses::SYMBOL; }
 		}
 
-		return hasDecimalSeparator;
-	}
-
-	template<class S>
-	void ToString(S& string, char8_t str) {
-		string += str;
-	}
-
-	template<class S>
-	void ToString(S& string, const char8_t* str) {
-		string += StringView(str);
-	}
+		for (uint32 c = 128; c < 256; ++c) { table[c] = CharacterClasses::NON_ASCII; }
 
-	template<class S>
-	void ToString(S& string, const Range<const char8_t*> str) {
-		string += str;
+		return table;
 	}
 
-	template<class S, std::unsigned_integral I>
-	void ToString(S& string, I num) {
-		uint8 i = 30, len = 0;
+	// CharacterClass of every byte.
+	inline constexpr std::array<uint8, 256> CHARACTER_CLASSES = characterClassTable();
 
-		char8_t str[32]; str[31] = u8'\0';
+	// Classifies a vector of bytes through the table, one shuffle per row of 16 ASCII characters, bytes with the high bit set shuffle to 0 and get NON_ASCII.
+	inline UTF8Vector classifyVector(const UTF8Vector block) {
+		const UTF8Vector rows = block.ShiftBitsRight<4>();
+		UTF8Vector classes = block & UTF8Vector(static_cast<uint8>(CharacterClasses::NON_ASCII));
 
-		do {
-			// Process individual digits 
-			str[i--] = (num % 10) + u8'0';
-			num /= 10;
-			++len;
-		} while (num);
+		for (uint8 row = 0; row < 8; ++row) {
+			const UTF8Vector table = UTF8Vector::LoadLane(UnalignedPointer<const uint8>(CHARACTER_CLASSES.data() + row * 16));
+			classes = classes | (UTF8Vector::ShuffleBytes(table, block) & (rows == UTF8Vector(row)));
+		}
 
-		string += Range<const char8_t*>(len, len, str + i + 1);
+		return classes;
 	}
 
-	template<class S, std::signed_integral I>
-	void ToString(S& string, I num) {
-		uint8 i = 30, len = 0;
+	template<bool STORE>
+	CharacterClass classifyCharacters(const StringView string, uint8* classes) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+		const auto* data = reinterpret_cast<const uint8*>(string.GetData());
 
-		char8_t str[32]; str[31] = u8'\0'; bool isNegative = false;
+		UTF8Vector all(static_cast<uint8>(0));
+		uint32 i = 0;
 
-		if (num < 0.0f) { num = -num; isNegative = true; }
+		for (; i + WIDTH <= string.GetBytes(); i += WIDTH) {
+			const UTF8Vector block = classifyVector(UTF8Vector(UnalignedPointer<const uint8>(data + i)));
+			if constexpr (STORE) { block.CopyTo(UnalignedPointer<uint8>(classes + i)); }
+			all = all | block;
+		}
 
-		do {
-			// Process individual digits 
-			str[i--] = (num % 10) + u8'0';
-			num /= 10;
-			++len;
-		} while (num);
+		alignas(32) uint8 lanes[WIDTH]; all.CopyTo(UnalignedPointer<uint8>(lanes));
+		uint8 result = 0;
+		for (const auto e : lanes) { result |= e; }
 
-		if (isNegative) { str[i--] = u8'-'; ++len; }
+		for (; i < string.GetBytes(); ++i) {
+			if constexpr (STORE) { classes[i] = CHARACTER_CLASSES[data[i]]; }
+			result |= CHARACTER_CLASSES[data[i]];
+		}
 
-		string += GTSL::Range<const char8_t*>(len, len, str + i + 1);
+		return CharacterClass(result);
 	}
 
-	template<class S>
-	void ToString(S& string, float32 num) {
-		uint8 i = 30, len = 0;
-		char8_t str[32]; str[31] = u8'\0'; bool isNegative = false;
+	/**
+	 * \brief Returns the union of the CharacterClass of every byte of string, to tell at once whether a string has, or only has, some kind of characters.
+	 */
+	inline CharacterClass GetCharacterClasses(const StringView string) { return classifyCharacters<false>(string, nullptr); }
 
-		if (num < 0.0f) { num = -num; isNegative = true; }
+	/**
+	 * \brief Writes the CharacterClass of every byte of string to classes, which must hold GetBytes() bytes.
+	 * \return Union of every class written.
+	 */
+	inline CharacterClass ClassifyCharacters(const StringView string, uint8* classes) { return classifyCharacters<true>(string, classes); }
+
+	// Whether every byte is a digit, '-', '.', or ',' if COMMA, and whether any is a '.'.
+	template<bool COMMA>
+	Pair<bool, bool> scanNumberCharacters(const StringView string) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector), ALL = WIDTH == 32 ? ~0u : 0xFFFFu;
+		const auto* data = reinterpret_cast<const uint8*>(string.GetData());
+		bool point = false;
+		uint32 i = 0;
+
+		for (; i + WIDTH <= string.GetBytes(); i += WIDTH) {
+			const UTF8Vector block(UnalignedPointer<const uint8>(data + i));
+			const UTF8Vector points = block == UTF8Vector(static_cast<uint8>(u8'.'));
+			UTF8Vector valid = ((block - UTF8Vector(static_cast<uint8>(u8'0'))) <= UTF8Vector(static_cast<uint8>(9))) | points | (block == UTF8Vector(static_cast<uint8>(u8'-')));
+			if constexpr (COMMA) { valid = valid | (block == UTF8Vector(static_cast<uint8>(u8','))); }
+			if (static_cast<uint32>(valid.BitMask()) != ALL) { return { false, false }; }
+			point = point || points.BitMask();
+		}
 
-		// Extract integer part 
-		int32 ipart = static_cast<int32>(num);
+		for (; i < string.GetBytes(); ++i) {
+			const uint8 c = data[i];
+			if (!(CHARACTER_CLASSES[c] & CharacterClasses::DIGIT) && c != u8'.' && c != u8'-' && !(COMMA && c == u8',')) { return { false, false }; }
+			point = point || c == u8'.';
+		}
 
-		// Extract floating part 
-		float32 fpart = num - static_cast<float32>(ipart);
+		return { true, point };
+	}
 
-		auto intToStr = [&](int32 integer) {
-			do {
-				// Process individual digits 
-				str[i--] = (integer % 10) + u8'0';
-				integer /= 10;
-				++len;
-			} while (integer);
-		};
+	/**
+	 * \brief Returns whether string is not empty and only has digits, '.', ',' and '-'.
+	 */
+	inline bool IsNumber(const StringView string) {
+		return string.GetBytes() && scanNumberCharacters<true>(string).First;
+	}
 
-		// check for display option after point 
-		if (6 != 0) {
-			// Get the value of fraction part upto given no. 
-			// of points after dot. The third parameter  
-			// is needed to handle cases like 233.007 
-			fpart = fpart * Math::Power(10.0f, 6.0f);
+	/**
+	 * \brief Returns whether string only has digits, '.' and '-', and has a '.'.
+	 */
+	inline bool IsDecimalNumber(const StringView string) {
+		const auto scan = scanNumberCharacters<false>(string);
+		return scan.First && scan.Second;
+	}
 
-			intToStr(static_cast<int32>(fpart));
+	template<class S>
+	void ToString(S& string, char8_t str) {
+		string += str;
+	}
 
-			str[i--] = u8'.'; // add dot
-			++len;
-		}
+	template<class S>
+	void ToString(S& string, const char8_t* str) {
+		string += StringView(str);
+	}
 
-		// convert integer part to string 
-		intToStr(ipart);
+	template<class S>
+	void ToString(S& string, const Range<const char8_t*> str) {
+		string += str;
+	}
 
-		if (isNegative) { str[i--] = u8'-'; ++len; }
+	template<class S, std::integral I>
+	void ToString(S& string, I num) {
+		char8_t str[20];
+		const uint32 len = FormatInteger(num, str);
+		string += Range<const char8_t*>(len, len, str);
+	}
 
-		string += GTSL::Range<const char8_t*>(len, len, str + i + 1);
+	/**
+	 * \brief Appends the shortest representation of num which parses back to the same value. See FormatFloat.
+	 */
+	template<class S, std::floating_point F>
+	void ToString(S& string, F num) {
+		char8_t str[32];
+		const uint32 len = FormatFloat(num, str);
+		string += Range<const char8_t*>(len, len, str);
 	}
 	
 	/**
@@ -347,139 +434,128 @@ namespace GTSL
 	template<typename T>
 	Result<T> ToNumber(Range<const char8_t*> numberString);
 
-	template<std::unsigned_integral T>
-	Result<T> ToNumber(Range<const char8_t*> numberString) {
-		T value = 0, mult = 1;
-
-		for (uint64 j = 0, c = numberString.GetBytes() - 1; j < numberString.GetBytes(); ++j, --c) {
-			uint8 num;
-
-			switch (numberString[c]) {
-			case u8'0': num = 0; break; case u8'1': num = 1; break;
-			case u8'2': num = 2; break; case u8'3': num = 3; break;
-			case u8'4': num = 4; break; case u8'5': num = 5; break;
-			case u8'6': num = 6; break; case u8'7': num = 7; break;
-			case u8'8': num = 8; break; case u8'9': num = 9; break;
-			case u8'\0': continue;
-			default: return Result(static_cast<T>(0), false);
-			}
-
-			value += num * mult;
-			mult *= 10;
-		}
-
-		return Result(MoveRef(value), true);
+	inline const char8_t* trimNullTerminators(const Range<const char8_t*> numberString) {
+		const char8_t* end = numberString.GetData() + numberString.GetBytes();
+		while (end != numberString.GetData() && *(end - 1) == u8'\0') { --end; }
+		return end;
 	}
 
-	template<std::signed_integral T>
+	/**
+	 * \brief Fails if the string has anything other than the number, or the number doesn't fit in T.
+	 */
+	template<std::integral T>
 	Result<T> ToNumber(Range<const char8_t*> numberString) {
-		T value = 0, mult = 1;
-
-		for (uint64 j = 0, c = numberString.GetBytes() - 1; j < numberString.GetBytes(); ++j, --c) {
-			uint8 num;
-
-			switch (numberString[c]) {
-			case u8'0': num = 0; break; case u8'1': num = 1; break;
-			case u8'2': num = 2; break; case u8'3': num = 3; break;
-			case u8'4': num = 4; break; case u8'5': num = 5; break;
-			case u8'6': num = 6; break; case u8'7': num = 7; break;
-			case u8'8': num = 8; break; case u8'9': num = 9; break;
-			case u8'-': num = 0; value = -value; break;
-			case u8'\0': continue;
-			default: return Result(static_cast<T>(0), false);
-			}
-
-			value += num * mult;
-			mult *= 10;
-		}
-
+		const char8_t* const end = trimNullTerminators(numberString);
+		T value = 0;
+		if (ParseInteger(numberString.GetData(), end, value) != end) { return Result(static_cast<T>(0), false); }
 		return Result(MoveRef(value), true);
 	}
 
-	template<>
-	inline Result<float32> ToNumber(Range<const char8_t*> numberString) {
-		float32 value = 0; uint64 c = numberString.GetBytes() - 1/*because of inverse parse*/;
-
-		{
-			float32 div = 1.0f;
-
-			while (c <= numberString.GetBytes() - 1) {
-				uint8 num;
-
-				switch (numberString[c--]) {
-				case u8'0': num = 0; break; case u8'1': num = 1; break;
-				case u8'2': num = 2; break; case u8'3': num = 3; break;
-				case u8'4': num = 4; break; case u8'5': num = 5; break;
-				case u8'6': num = 6; break; case u8'7': num = 7; break;
-				case u8'8': num = 8; break; case u8'9': num = 9; break;
-				case u8'.': {
-					value /= div;
-					num = 0; div = 0.1f;
-					break;
-				}
-				case u8'\0': continue;
-				case u8'-': {
-					value *= -1; num = 0;
-					break;
-				}
-				default: return Result<float32>(0, false);
-				}
-
-				value += num * div;
-				div *= 10;
-			}
-		}
-
+	/**
+	 * \brief Accepts decimal and scientific notation, result is correctly rounded. Fails if the string has anything other than the number.
+	 */
+	template<std::floating_point T>
+	Result<T> ToNumber(Range<const char8_t*> numberString) {
+		const char8_t* const end = trimNullTerminators(numberString);
+		T value = 0;
+		if (ParseFloat(numberString.GetData(), end, value) != end) { return Result(static_cast<T>(0), false); }
 		return Result(MoveRef(value), true);
 	}
 
-	inline char8_t ToLowerCase(char8_t c) {
-		if (u8'A' <= c && c <= u8'Z') return c += (u8'a' - u8'A');
-		return c;
+	inline char8_t ToLowerCase(const char8_t c) {
+		return static_cast<char8_t>(c + (CHARACTER_CLASSES[c] & CharacterClasses::UPPER ? u8'a' - u8'A' : 0));
 	}
 
-	inline char8_t ToUpperCase(char8_t c) {
-		if (u8'a' <= c && c <= u8'z') return c += (u8'a' - u8'A');
-		return c;
+	inline char8_t ToUpperCase(const char8_t c) {
+		return static_cast<char8_t>(c - (CHARACTER_CLASSES[c] & CharacterClasses::LOWER ? u8'a' - u8'A' : 0));
 	}
 
 	inline bool CompareCaseInsensitive(const char8_t a, const char8_t b) {
-		return a == ToLowerCase(b) || a == ToUpperCase(b);
+		return ToLowerCase(a) == ToLowerCase(b);
 	}
 
-	inline bool IsLetter(const char32_t character) {
-		constexpr char32_t table[] = { U'A', U'B', U'C', U'D', U'E', U'F', U'G', U'H', U'I', U'J', U'K', U'L', U'M', U'N', U'O', U'P', U'Q', U'R', U'S', U'T', U'U', U'V', U'W', U'X', U'Y', U'Z',
-			                           U'a', U'b', U'c', U'd', U'e', U'f', U'g', U'h', U'i', U'j', U'k', U'l', U'm', U'n', U'o', U'p', U'q', U'r', U's', U't', U'u', U'v', U'w', U'x', U'y', U'z'};
-
-		for (auto& e : table) { if (e == character) { return true; } }
-
-		return false;
-	}
+	inline bool IsLetter(const char32_t character) { return character < 128 && CHARACTER_CLASSES[character] & CharacterClasses::LETTER; }
 
-	inline bool IsWhitespace(const char32_t character) { return character == U' ' || character == U'	'; }
+	inline bool IsWhitespace(const char32_t character) { return character < 128 && CHARACTER_CLASSES[character] & CharacterClasses::WHITESPACE; }
 
 	inline bool IsSpecialCharacter(const char32_t character) {
 		return character == U'\n' || character == U'\0' || character == U'\r' || character == U'\f' || character == U'\b';
 	}
 	
-	inline bool IsNumber(const char32_t character) {
-		switch (character) {
-		case U'0': case U'1': case U'2': case U'3': case U'4': case U'5': case U'6': case U'7': case U'8': case U'9':
-			return true;
-		}
+	inline bool IsNumber(const char32_t character) { return character < 128 && CHARACTER_CLASSES[character] & CharacterClasses::DIGIT; }
 
-		return false;
+	inline bool IsSymbol(const char32_t character) { return character < 128 && CHARACTER_CLASSES[character] & CharacterClasses::SYMBOL; }
+
+	// Adds 'a' - 'A' to every byte in [first, first + 25], lowers upper case letters or raises lower case ones. Other bytes, including every byte of multi byte code points, are kept.
+	inline UTF8Vector shiftCase(const UTF8Vector block, const uint8 first, const uint8 delta) {
+		const UTF8Vector letters = (block - UTF8Vector(first)) <= UTF8Vector(static_cast<uint8>(25));
+		return block + (letters & UTF8Vector(delta));
 	}
 
-	inline bool IsSymbol(const char32_t character) {
-		switch (character) {
-		case U'!': case U'\"': case U'#': case U'|': case U'\'': case U'$': case U'%': case U'&': case U'/': case U'(': case U')':
-		case U'=': case U'?':  case U'[': case U']': case U'^':  case U'*': case U'{': case U'}': case U',': case U'.': case U';': case U':':
-		case U'<': case U'>':  case U'_': case U'~': case U'-':  case U'+':
-			return true;
+	inline void shiftCase(char8_t* data, const uint32 bytes, const uint8 first, const uint8 delta) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+		auto* characters = reinterpret_cast<uint8*>(data);
+		uint32 i = 0;
+
+		for (; i + WIDTH <= bytes; i += WIDTH) { shiftCase(UTF8Vector(UnalignedPointer<const uint8>(characters + i)), first, delta).CopyTo(UnalignedPointer<uint8>(characters + i)); }
+		for (; i < bytes; ++i) { if (static_cast<uint8>(characters[i] - first) <= 25) { characters[i] += delta; } }
+	}
+
+	/**
+	 * \brief Lowers every ASCII letter in bytes bytes of data, a vector at a time. Other code points are kept.
+	 */
+	inline void ToLowerCase(char8_t* data, const uint32 bytes) { shiftCase(data, bytes, u8'A', u8'a' - u8'A'); }
+
+	/**
+	 * \brief Raises every ASCII letter in bytes bytes of data, a vector at a time. Other code points are kept.
+	 */
+	inline void ToUpperCase(char8_t* data, const uint32 bytes) { shiftCase(data, bytes, u8'a', static_cast<uint8>(u8'A' - u8'a')); }
+
+	// Returns the difference of the first differing bytes of a and b, lowering ASCII letters first if FOLD, or 0 if all bytes are the same.
+	template<bool FOLD>
+	int32 compareBytes(const char8_t* a, const char8_t* b, const uint32 bytes) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector), ALL = WIDTH == 32 ? ~0u : 0xFFFFu;
+		const auto* left = reinterpret_cast<const uint8*>(a); const auto* right = reinterpret_cast<const uint8*>(b);
+		uint32 i = 0;
+
+		for (; i + WIDTH <= bytes; i += WIDTH) {
+			UTF8Vector l(UnalignedPointer<const uint8>(left + i)), r(UnalignedPointer<const uint8>(right + i));
+			if constexpr (FOLD) { l = shiftCase(l, u8'A', u8'a' - u8'A'); r = shiftCase(r, u8'A', u8'a' - u8'A'); }
+			if (const uint32 equal = static_cast<uint32>((l == r).BitMask()); equal != ALL) { i += FindFirstSetBit(~equal).Get(); break; }
 		}
 
-		return false;
+		for (; i < bytes; ++i) {
+			const uint8 l = FOLD ? static_cast<uint8>(ToLowerCase(a[i])) : left[i], r = FOLD ? static_cast<uint8>(ToLowerCase(b[i])) : right[i];
+			if (l != r) { return static_cast<int32>(l) - static_cast<int32>(r); }
+		}
+
+		return 0;
+	}
+
+	// Orders a and b by their first differing byte, or by length if one is a prefix of the other.
+	template<bool FOLD>
+	int32 compareStrings(const StringView a, const StringView b) {
+		const uint32 common = a.GetBytes() < b.GetBytes() ? a.GetBytes() : b.GetBytes();
+		if (const int32 difference = compareBytes<FOLD>(a.GetData(), b.GetData(), common)) { return difference; }
+		return a.GetBytes() == b.GetBytes() ? 0 : (a.GetBytes() < b.GetBytes() ? -1 : 1);
+	}
+
+	/**
+	 * \brief Lexicographically compares a and b by bytes, which for UTF-8 is the same as by code points, a vector of bytes at a time.
+	 * \return Negative if a goes before b, 0 if they are equal, positive if a goes after b.
+	 */
+	inline int32 Compare(const StringView a, const StringView b) { return compareStrings<false>(a, b); }
+
+	/**
+	 * \brief Like Compare, but ASCII letters compare equal to their other case, as for matching paths and names.
+	 */
+	inline int32 CompareCaseInsensitive(const StringView a, const StringView b) { return compareStrings<true>(a, b); }
+
+	/**
+	 * \brief Returns whether a and b are equal ignoring the case of ASCII letters.
+	 */
+	inline bool EqualsCaseInsensitive(const StringView a, const StringView b) {
+		return a.GetBytes() == b.GetBytes() && !compareBytes<true>(a.GetData(), b.GetData(), a.GetBytes());
 	}
 
 	struct Join {
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Core.h"
+#include "Allocator.hpp"
+#include "Assert.h"
+#include "Atomic.hpp"
+#include "Bitman.h"
+#include "Buffer.hpp"
+#include "Id.h"
+#include "Mutex.h"
+#include "Pair.hpp"
+#include "Result.h"
+#include "StringCommon.h"
+#include "Vector.hpp"
+
+#include <cstring>
+
+namespace GTSL
+{
+	/**
+	 * \brief Maps strings to the same Id64 Id64(string) computes, and keeps every string so ids can be mapped back to them for debugging and serialization.
+	 * Strings are copied once in to an arena whose pages never move, so returned StringViews stay valid for the interner's lifetime.
+	 * The index is an open addressing table keyed by the hash, lookups of interned strings and of ids don't take any lock, only inserting does.
+	 * When the table grows a new one is published and the old one kept until destruction, so readers still probing it stay safe.
+	 * A string hashing to the id of a different interned string is detected and refused.
+	 * \tparam ALLOCATOR Allocator for the arena and tables, must be safe to call from every thread that interns.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class StringInterner {
+	public:
+		/**
+		 * \param expectedStrings Number of strings the index is sized for up front, it grows past it.
+		 */
+		explicit StringInterner(const uint32 expectedStrings = 256, const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), allocations(allocator) {
+			table = newTable(NextPowerOfTwo(expectedStrings * 2 > 16 ? expectedStrings * 2 : 16u));
+		}
+
+		StringInterner(const StringInterner&) = delete;
+		StringInterner& operator=(const StringInterner&) = delete;
+
+		~StringInterner() {
+			for (const auto& e : allocations) { Deallocate(allocator, e.Second, e.First); }
+		}
+
+		/**
+		 * \brief Interns string, copying it the first time it's seen. Thread safe, strings already interned are found without locking.
+		 * \return Id of string, fails if a different string with the same id was interned before.
+		 */
+		Result<Id64> Intern(const StringView string) {
+			const uint64 hash = Hash(string);
+			if (const entry* found = find(hash)) { return Result(Id64(hash), matches(found, string)); }
+
+			Lock<Mutex> lock(mutex);
+			return insert(string, hash);
+		}
+
+		/**
+		 * \brief Interns every null terminated string stored back to back in buffer, taking the lock once. Empty strings are skipped, the last terminator can be omitted.
+		 * \param onString Called as onString(Result<Id64>, StringView) for every string in order, the view points in to the interner.
+		 * \return Number of strings.
+		 */
+		template<class B>
+		uint32 InternAll(const Buffer<B>& buffer, auto&& onString) {
+			Lock<Mutex> lock(mutex);
+			uint32 strings = 0;
+
+			ForEachSubstring(static_cast<StringView>(buffer), [&](const StringView string) {
+				const auto id = insert(string, Hash(string));
+				onString(id, id.State() ? GetString(id.Get()).Get() : string);
+				++strings;
+			}, u8'\0');
+
+			return strings;
+		}
+
+		/**
+		 * \brief Finds the id of string if it was interned, without locking.
+		 */
+		[[nodiscard]] Result<Id64> Find(const StringView string) const {
+			const uint64 hash = Hash(string);
+			const entry* found = find(hash);
+			return Result(Id64(hash), found && matches(found, string));
+		}
+
+		/**
+		 * \brief Returns the string which was interned as id, without locking.
+		 */
+		[[nodiscard]] Result<StringView> GetString(const Id64 id) const {
+			const entry* found = find(id.GetID());
+			if (!found) { return Result<StringView>(false); }
+			return Result(StringView(found->Bytes, found->Codepoints, reinterpret_cast<const char8_t*>(found + 1)), true);
+		}
+
+		[[nodiscard]] uint32 GetCount() const { return AtomicLoad(count, MemoryOrder::RELAXED); }
+
+	private:
+		static constexpr uint64 PAGE_BYTES = 64 * 1024;
+
+		struct entry { uint64 Hash; uint32 Bytes, Codepoints; }; // followed by the string and a null terminator
+		struct indexTable { uint64 Mask; entry** Slots; }; // null slots are empty
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		Mutex mutex;
+		indexTable* table = nullptr;
+		uint32 count = 0;
+		uint64* page = nullptr; uint64 pageUsed = 0, pageCapacity = 0; // in 8 byte words
+		Vector<Pair<uint64*, uint64>, ALLOCATOR> allocations; // every block, as words, freed on destruction
+
+		static bool matches(const entry* found, const StringView string) {
+			return found->Bytes == string.GetBytes() && !std::memcmp(found + 1, string.GetData(), string.GetBytes());
+		}
+
+		const entry* find(const uint64 hash) const {
+			const indexTable* current = AtomicLoad(table, MemoryOrder::ACQUIRE);
+
+			for (uint64 i = hash & current->Mask; true; i = (i + 1) & current->Mask) {
+				const entry* slot = AtomicLoad(current->Slots[i], MemoryOrder::ACQUIRE);
+				if (!slot) { return nullptr; }
+				if (slot->Hash == hash) { return slot; }
+			}
+		}
+
+		uint64* allocateWords(const uint64 words) {
+			uint64* block; Allocate(allocator, words, &block);
+			allocations.EmplaceBack(block, words);
+			return block;
+		}
+
+		indexTable* newTable(const uint64 capacity) {
+			auto* newTable = reinterpret_cast<indexTable*>(allocateWords((sizeof(indexTable) + 7) / 8));
+			newTable->Mask = capacity - 1;
+			newTable->Slots = reinterpret_cast<entry**>(allocateWords(capacity));
+			for (uint64 i = 0; i < capacity; ++i) { newTable->Slots[i] = nullptr; }
+			return newTable;
+		}
+
+		// Called with the mutex held, the only writer.
+		Result<Id64> insert(const StringView string, const uint64 hash) {
+			indexTable* current = table;
+
+			uint64 i = hash & current->Mask;
+			for (; current->Slots[i]; i = (i + 1) & current->Mask) {
+				if (current->Slots[i]->Hash == hash) { return Result(Id64(hash), matches(current->Slots[i], string)); }
+			}
+
+			if ((count + 1) * 2 > current->Mask + 1) { // keep the load under a half so probes stay short
+				indexTable* grown = newTable((current->Mask + 1) * 2);
+
+				for (uint64 s = 0; s <= current->Mask; ++s) {
+					if (entry* e = current->Slots[s]) {
+						uint64 j = e->Hash & grown->Mask;
+						while (grown->Slots[j]) { j = (j + 1) & grown->Mask; }
+						grown->Slots[j] = e;
+					}
+				}
+
+				AtomicStore(table, grown, MemoryOrder::RELEASE); // the old table stays valid for readers probing it
+				current = grown;
+				for (i = hash & current->Mask; current->Slots[i]; i = (i + 1) & current->Mask) {}
+			}
+
+			const uint64 words = (sizeof(entry) + string.GetBytes() + 1 + 7) / 8;
+
+			uint64* block;
+
+			if (words > PAGE_BYTES / 8 / 4) { // big strings get their own block so they don't waste the rest of a page
+				block = allocateWords(words);
+			} else {
+				if (pageUsed + words > pageCapacity) { page = allocateWords(PAGE_BYTES / 8); pageCapacity = PAGE_BYTES / 8; pageUsed = 0; }
+				block = page + pageUsed; pageUsed += words;
+			}
+
+			auto* e = reinterpret_cast<entry*>(block);
+
+			e->Hash = hash; e->Bytes = string.GetBytes(); e->Codepoints = string.GetCodepoints();
+			auto* bytes = reinterpret_cast<char8_t*>(e + 1);
+			std::memcpy(bytes, string.GetData(), string.GetBytes()); bytes[string.GetBytes()] = u8'\0';
+
+			AtomicStore(current->Slots[i], e, MemoryOrder::RELEASE); // publishes the entry's contents
+			AtomicStore(count, count + 1, MemoryOrder::RELAXED);
+
+			return Result(Id64(hash), true);
+		}
+	};
+}
@@ -1 +1,242 @@
 #pragma once
+
+#include "Core.h"
+#include "Bitman.h"
+#include "Pair.hpp"
+#include "Result.h"
+#include "StringCommon.h"
+#include "Unicode.hpp"
+#include "Vector.hpp"
+
+#include <cstring>
+
+namespace GTSL
+{
+	/**
+	 * \brief Boyer-Moore-Horspool substring search. On a mismatch the text byte under the pattern's last position decides how far to skip, up to the whole pattern length,
+	 * so long patterns touch a fraction of the text. Build once and reuse it to search many texts for the same pattern.
+	 * Doesn't copy the pattern, it must outlive the searcher.
+	 */
+	class BoyerMooreHorspool {
+	public:
+		explicit BoyerMooreHorspool(const StringView pattern) : pattern(pattern.GetData()), length(pattern.GetBytes()) {
+			for (auto& e : shifts) { e = length; }
+			for (uint32 i = 0; i + 1 < length; ++i) { shifts[static_cast<uint8>(this->pattern[i])] = length - 1 - i; }
+		}
+
+		/**
+		 * \return Byte offset of the first occurrence of the pattern in text at or after from.
+		 */
+		[[nodiscard]] Result<uint32> Find(const StringView text, uint32 from = 0) const {
+			const char8_t* const data = text.GetData();
+			if (!length) { return Result(MoveRef(from), from <= text.GetBytes()); }
+
+			const char8_t last = pattern[length - 1];
+
+			while (from + length <= text.GetBytes()) {
+				const char8_t character = data[from + length - 1];
+				if (character == last && !std::memcmp(data + from, pattern, length - 1)) { return Result(MoveRef(from), true); }
+				from += shifts[static_cast<uint8>(character)];
+			}
+
+			return Result<uint32>(false);
+		}
+
+		[[nodiscard]] uint32 GetLength() const { return length; }
+
+	private:
+		const char8_t* pattern; uint32 length;
+		uint32 shifts[256]; // distance from the last occurrence of every byte, ignoring the final position, to the end of the pattern
+	};
+
+	/**
+	 * \brief Finds the first occurrence of pattern in text at or after from, comparing bytes so it works on any encoding.
+	 * Patterns shorter than a vector compare their first and last byte against a whole vector of candidate positions at once, only positions where both match are compared in full,
+	 * which skips nearly every position even with frequent first bytes. Longer patterns use BoyerMooreHorspool, which skips more than a vector per step on their long shifts.
+	 * \return Byte offset of the occurrence.
+	 */
+	inline Result<uint32> Find(const StringView text, const StringView pattern, uint32 from = 0) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+
+		const char8_t* const data = text.GetData(); const uint32 bytes = text.GetBytes(), length = pattern.GetBytes();
+
+		if (from > bytes || length > bytes - from) { return Result<uint32>(false); }
+		if (!length) { return Result(MoveRef(from), true); }
+
+		if (length == 1) {
+			const void* const found = std::memchr(data + from, pattern.GetData()[0], bytes - from);
+			if (!found) { return Result<uint32>(false); }
+			return Result(static_cast<uint32>(static_cast<const char8_t*>(found) - data), true);
+		}
+
+		if (length >= WIDTH) { return BoyerMooreHorspool(pattern).Find(text, from); }
+
+		const char8_t* const needle = pattern.GetData();
+		const UTF8Vector first(static_cast<uint8>(needle[0])), last(static_cast<uint8>(needle[length - 1]));
+
+		for (; from + length - 1 + WIDTH <= bytes; from += WIDTH) {
+			const UTF8Vector firstBytes(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + from)));
+			const UTF8Vector lastBytes(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + from + length - 1)));
+
+			for (uint32 candidates = static_cast<uint32>(((firstBytes == first) & (lastBytes == last)).BitMask()); candidates; candidates &= candidates - 1) {
+				uint32 position = from + FindFirstSetBit(candidates).Get();
+				if (!std::memcmp(data + position + 1, needle + 1, length - 2)) { return Result(MoveRef(position), true); }
+			}
+		}
+
+		for (; from + length <= bytes; ++from) {
+			if (data[from] == needle[0] && !std::memcmp(data + from + 1, needle + 1, length - 1)) { return Result(MoveRef(from), true); }
+		}
+
+		return Result<uint32>(false);
+	}
+
+	/**
+	 * \brief Aho-Corasick automaton, finds every occurrence of any of a set of patterns in one pass over the text, no matter how many patterns there are.
+	 * Built as a full DFA, failure links are folded in to the transitions so every text byte costs exactly one table lookup.
+	 * Bytes are first mapped to the classes of bytes which appear in the patterns, every byte no pattern contains shares class 0, which keeps the table rows as narrow as the patterns' alphabet.
+	 * Matches are reported as byte offsets.
+	 * \tparam ALLOCATOR Allocator used for the patterns and tables.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class AhoCorasick {
+	public:
+		explicit AhoCorasick(const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), patternBytes(allocator), patternEnds(allocator), transitions(allocator),
+		outputs(allocator), dictionaryLinks(allocator), samePatterns(allocator) {}
+
+		/**
+		 * \brief Adds a pattern, Build must be called after adding patterns and before searching.
+		 * \param pattern Pattern to add, can't be empty. Copied.
+		 * \return Index of the pattern, in the order they were added, which identifies it in matches.
+		 */
+		uint32 AddPattern(const StringView pattern) {
+			GTSL_ASSERT(pattern.GetBytes(), "Empty patterns would match everywhere.");
+			for (uint32 i = 0; i < pattern.GetBytes(); ++i) { patternBytes.EmplaceBack(pattern.GetData()[i]); }
+			patternEnds.EmplaceBack(patternBytes.GetLength());
+			return patternEnds.GetLength() - 1;
+		}
+
+		/**
+		 * \brief Builds the automaton for every pattern added, in time linear in the total pattern length times the number of byte classes.
+		 */
+		void Build() {
+			for (auto& e : classes) { e = 0; }
+			classCount = 1;
+			for (const auto e : patternBytes) { if (!classes[static_cast<uint8>(e)]) { classes[static_cast<uint8>(e)] = classCount++; } }
+
+			const uint32 patternCount = patternEnds.GetLength();
+
+			// trie, state 0 is the root, which is never a child, so 0 marks missing edges
+			transitions.Resize(0); transitions.EmplaceGroup(classCount, 0u);
+			outputs.Resize(0); outputs.EmplaceBack(NONE);
+			samePatterns.Resize(0); samePatterns.EmplaceGroup(patternCount, NONE);
+
+			for (uint32 p = 0, begin = 0; p < patternCount; begin = patternEnds[p++]) {
+				uint32 state = 0;
+
+				for (uint32 i = begin; i < patternEnds[p]; ++i) {
+					const uint32 edge = state * classCount + classes[static_cast<uint8>(patternBytes[i])];
+
+					if (!transitions[edge]) {
+						transitions[edge] = outputs.GetLength();
+						transitions.EmplaceGroup(classCount, 0u); outputs.EmplaceBack(NONE);
+					}
+
+					state = transitions[edge];
+				}
+
+				samePatterns[p] = outputs[state]; outputs[state] = p; // duplicates share a state, chain them
+			}
+
+			const uint32 stateCount = outputs.GetLength();
+			GTSL_ASSERT(static_cast<uint64>(stateCount) * classCount < MATCH, "Too many states for the transition table.");
+
+			// breadth first, so the failure state of every state, which is shallower, has all of it's transitions resolved before they are copied
+			Vector<uint32, ALLOCATOR> failures(stateCount, allocator), queue(stateCount, allocator);
+			failures.EmplaceGroup(stateCount, 0u);
+			dictionaryLinks.Resize(0); dictionaryLinks.EmplaceGroup(stateCount, NONE);
+
+			for (uint32 c = 0; c < classCount; ++c) { if (transitions[c]) { queue.EmplaceBack(transitions[c]); } }
+
+			for (uint32 q = 0; q < queue.GetLength(); ++q) {
+				const uint32 state = queue[q], failure = failures[state];
+
+				for (uint32 c = 0; c < classCount; ++c) {
+					const uint32 child = transitions[state * classCount + c];
+
+					if (child) {
+						const uint32 childFailure = transitions[failure * classCount + c];
+						failures[child] = childFailure;
+						dictionaryLinks[child] = outputs[childFailure] != NONE ? childFailure : dictionaryLinks[childFailure];
+						queue.EmplaceBack(child);
+					} else {
+						transitions[state * classCount + c] = transitions[failure * classCount + c];
+					}
+				}
+			}
+
+			// store row offsets instead of state indices to save a multiplication per byte, and flag states which end a pattern
+			for (auto& e : transitions) { e = e * classCount | (outputs[e] != NONE || dictionaryLinks[e] != NONE ? MATCH : 0u); }
+		}
+
+		/**
+		 * \brief Calls onMatch(uint32 pattern, uint32 offset) for every occurrence of every pattern, including overlapping ones, in the order they end.
+		 * \return Number of matches.
+		 */
+		template<typename F>
+		uint32 ForEachMatch(const StringView text, F&& onMatch) const {
+			uint32 count = 0;
+			scan(text, [&](const uint32 pattern, const uint32 offset) { onMatch(pattern, offset); ++count; return true; });
+			return count;
+		}
+
+		/**
+		 * \brief Finds the occurrence which ends first, if several end on the same byte the longest.
+		 * \return Pattern index and byte offset of the match.
+		 */
+		[[nodiscard]] Result<Pair<uint32, uint32>> FindFirst(const StringView text) const {
+			Pair<uint32, uint32> match(NONE, 0u);
+			scan(text, [&](const uint32 pattern, const uint32 offset) { match.First = pattern; match.Second = offset; return false; });
+			return Result(MoveRef(match), match.First != NONE);
+		}
+
+		[[nodiscard]] uint32 GetPatternCount() const { return patternEnds.GetLength(); }
+
+		[[nodiscard]] uint32 GetStateCount() const { return outputs.GetLength(); }
+
+	private:
+		static constexpr uint32 NONE = ~0u, MATCH = 1u << 31;
+
+		[[no_unique_address]] ALLOCATOR allocator;
+		Vector<char8_t, ALLOCATOR> patternBytes; // every pattern, back to back
+		Vector<uint32, ALLOCATOR> patternEnds;
+		uint16 classes[256] = {}; uint32 classCount = 1;
+		Vector<uint32, ALLOCATOR> transitions; // class count entries per state, row offset of the next state, MATCH set if it ends a pattern itself or through a suffix
+		Vector<uint32, ALLOCATOR> outputs; // longest pattern ending at every state, NONE if none
+		Vector<uint32, ALLOCATOR> dictionaryLinks; // closest proper suffix state with an output
+		Vector<uint32, ALLOCATOR> samePatterns; // next pattern with the same bytes
+
+		uint32 patternLength(const uint32 pattern) const { return patternEnds[pattern] - (pattern ? patternEnds[pattern - 1] : 0); }
+
+		// onMatch returns whether to keep scanning
+		template<typename F>
+		void scan(const StringView text, F&& onMatch) const {
+			if (!transitions.GetLength()) { return; }
+
+			const char8_t* const data = text.GetData();
+			uint32 row = 0;
+
+			for (uint32 i = 0; i < text.GetBytes(); ++i) {
+				const uint32 next = transitions[row + classes[static_cast<uint8>(data[i])]];
+				row = next & ~MATCH;
+				if (!(next & MATCH)) { continue; }
+
+				for (uint32 state = row / classCount; state != NONE; state = dictionaryLinks[state]) {
+					for (uint32 p = outputs[state]; p != NONE; p = samePatterns[p]) {
+						if (!onMatch(p, i + 1 - patternLength(p))) { return; }
+					}
+				}
+			}
+		}
+	};
+}
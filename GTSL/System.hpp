@@ -1,6 +1,7 @@
 #pragma once
 #include "Core.h"
 #include "DataSizes.h"
+#include "Dispatch.hpp"
 #include "Extent.h"
 #include "Range.hpp"
 #include "StringCommon.h"
@@ -11,9 +12,11 @@
 #include <Windows.h>
 #include <shellapi.h>
 #include <VersionHelpers.h>
+#include <immintrin.h>
 #elif __linux__
 #include <cpuid.h>
 #include <sys/sysinfo.h>
+#include <unistd.h>
 #endif
 
 namespace GTSL
@@ -24,19 +27,6 @@ namespace GTSL
 		Byte ProcessAvailableMemory;
 	};
 
-	struct CPUVectorInfo {
-		bool HW_MMX = false, HW_x64 = false, HW_ABM = false, HW_RDRAND = false, HW_BMI1 = false, HW_BMI2 = false, HW_ADX = false, HW_PREFETCHWT1 = false, HW_MPX = false;
-
-		//  SIMD: 128-bit
-		bool HW_SSE = false, HW_SSE2 = false, HW_SSE3 = false, HW_SSSE3 = false, HW_SSE41 = false, HW_SSE42 = false, HW_SSE4a = false, HW_AES = false, HW_SHA = false;
-
-		//  SIMD: 256-bit
-		bool HW_AVX = false, HW_XOP = false, HW_FMA3 = false, HW_FMA4 = false, HW_AVX2 = false;
-
-		//  SIMD: 512-bit
-		bool HW_AVX512_F = false, HW_AVX512_PF = false, HW_AVX512_ER = false, HW_AVX512_CD = false, HW_AVX512_VL = false, HW_AVX512_BW = false, HW_AVX512_DQ = false, HW_AVX512_IFMA = false, HW_AVX512_VBMI = false;
-	};
-
 	struct SystemInfo {
 		struct CPUInfo {
 			CPUVectorInfo VectorInfo;
@@ -70,125 +60,7 @@ namespace GTSL
 			return ramInfo;
 		}
 
-		static CPUVectorInfo GetVectorInfo() {
-			CPUVectorInfo vectorInfo;
-#if _WIN64
-			//https://stackoverflow.com/questions/6121792/how-to-check-if-a-cpu-supports-the-sse3-instruction-set
-
-			int info[4];
-			__cpuidex(info, 0, 0);
-			const int nIds = info[0];
-
-			__cpuidex(info, 0x8000000, 0);
-			const uint32 nExIds = info[0];
-
-			//  Detect Features
-			if (nIds >= 0x00000001) {
-				__cpuidex(info, 0x00000001, 0);
-				vectorInfo.HW_MMX = (info[3] & (static_cast<int>(1) << 23)) != 0;
-				vectorInfo.HW_SSE = (info[3] & (static_cast<int>(1) << 25)) != 0;
-				vectorInfo.HW_SSE2 = (info[3] & (static_cast<int>(1) << 26)) != 0;
-				vectorInfo.HW_SSE3 = (info[2] & (static_cast<int>(1) << 0)) != 0;
-
-				vectorInfo.HW_SSSE3 = (info[2] & (static_cast<int>(1) << 9)) != 0;
-				vectorInfo.HW_SSE41 = (info[2] & (static_cast<int>(1) << 19)) != 0;
-				vectorInfo.HW_SSE42 = (info[2] & (static_cast<int>(1) << 20)) != 0;
-				vectorInfo.HW_AES = (info[2] & (static_cast<int>(1) << 25)) != 0;
-
-				vectorInfo.HW_AVX = (info[2] & (static_cast<int>(1) << 28)) != 0;
-				vectorInfo.HW_FMA3 = (info[2] & (static_cast<int>(1) << 12)) != 0;
-
-				vectorInfo.HW_RDRAND = (info[2] & (static_cast<int>(1) << 30)) != 0;
-			}
-			if (nIds >= 0x00000007) {
-				__cpuidex(info, 0x00000007, 0);
-				vectorInfo.HW_AVX2 = (info[1] & (static_cast<int>(1) << 5)) != 0;
-
-				vectorInfo.HW_BMI1 = (info[1] & (static_cast<int>(1) << 3)) != 0;
-				vectorInfo.HW_BMI2 = (info[1] & (static_cast<int>(1) << 8)) != 0;
-				vectorInfo.HW_ADX = (info[1] & (static_cast<int>(1) << 19)) != 0;
-				vectorInfo.HW_MPX = (info[1] & (static_cast<int>(1) << 14)) != 0;
-				vectorInfo.HW_SHA = (info[1] & (static_cast<int>(1) << 29)) != 0;
-				vectorInfo.HW_PREFETCHWT1 = (info[2] & (static_cast<int>(1) << 0)) != 0;
-
-				vectorInfo.HW_AVX512_F = (info[1] & (static_cast<int>(1) << 16)) != 0;
-				vectorInfo.HW_AVX512_CD = (info[1] & (static_cast<int>(1) << 28)) != 0;
-				vectorInfo.HW_AVX512_PF = (info[1] & (static_cast<int>(1) << 26)) != 0;
-				vectorInfo.HW_AVX512_ER = (info[1] & (static_cast<int>(1) << 27)) != 0;
-				vectorInfo.HW_AVX512_VL = (info[1] & (static_cast<int>(1) << 31)) != 0;
-				vectorInfo.HW_AVX512_BW = (info[1] & (static_cast<int>(1) << 30)) != 0;
-				vectorInfo.HW_AVX512_DQ = (info[1] & (static_cast<int>(1) << 17)) != 0;
-				vectorInfo.HW_AVX512_IFMA = (info[1] & (static_cast<int>(1) << 21)) != 0;
-				vectorInfo.HW_AVX512_VBMI = (info[2] & (static_cast<int>(1) << 1)) != 0;
-			}
-			if (nExIds >= 0x80000001) {
-				__cpuidex(info, 0x80000001, 0);
-				vectorInfo.HW_x64 = (info[3] & (static_cast<int>(1) << 29)) != 0;
-				vectorInfo.HW_ABM = (info[2] & (static_cast<int>(1) << 5)) != 0;
-				vectorInfo.HW_SSE4a = (info[2] & (static_cast<int>(1) << 6)) != 0;
-				vectorInfo.HW_FMA4 = (info[2] & (static_cast<int>(1) << 16)) != 0;
-				vectorInfo.HW_XOP = (info[2] & (static_cast<int>(1) << 11)) != 0;
-			}
-#elif __linux__
-			uint32 info[4] = {0};
-			__cpuid(0, info[0], info[1], info[2], info[3]);
-			const uint32 nIds = info[0];
-
-			__cpuid(0x80000000, info[0], info[1], info[2], info[3]);
-			const uint32 nExIds = info[0];
-
-			//  Detect Features
-			if (nIds >= 0x00000001) {
-				__cpuid(0x00000001, info[0], info[1], info[2], info[3]);
-				vectorInfo.HW_MMX = (info[3] & (static_cast<int>(1) << 23)) != 0;
-				vectorInfo.HW_SSE = (info[3] & (static_cast<int>(1) << 25)) != 0;
-				vectorInfo.HW_SSE2 = (info[3] & (static_cast<int>(1) << 26)) != 0;
-				vectorInfo.HW_SSE3 = (info[2] & (static_cast<int>(1) << 0)) != 0;
-
-				vectorInfo.HW_SSSE3 = (info[2] & (static_cast<int>(1) << 9)) != 0;
-				vectorInfo.HW_SSE41 = (info[2] & (static_cast<int>(1) << 19)) != 0;
-				vectorInfo.HW_SSE42 = (info[2] & (static_cast<int>(1) << 20)) != 0;
-				vectorInfo.HW_AES = (info[2] & (static_cast<int>(1) << 25)) != 0;
-
-				vectorInfo.HW_AVX = (info[2] & (static_cast<int>(1) << 28)) != 0;
-				vectorInfo.HW_FMA3 = (info[2] & (static_cast<int>(1) << 12)) != 0;
-
-				vectorInfo.HW_RDRAND = (info[2] & (static_cast<int>(1) << 30)) != 0;
-			}
-			if (nIds >= 0x00000007) {
-				__cpuid_count(0x00000007, 0, info[0], info[1], info[2], info[3]);
-
-				vectorInfo.HW_AVX2 = (info[1] & (static_cast<int>(1) << 5)) != 0;
-
-				vectorInfo.HW_BMI1 = (info[1] & (static_cast<int>(1) << 3)) != 0;
-				vectorInfo.HW_BMI2 = (info[1] & (static_cast<int>(1) << 8)) != 0;
-				vectorInfo.HW_ADX = (info[1] & (static_cast<int>(1) << 19)) != 0;
-				vectorInfo.HW_MPX = (info[1] & (static_cast<int>(1) << 14)) != 0;
-				vectorInfo.HW_SHA = (info[1] & (static_cast<int>(1) << 29)) != 0;
-				vectorInfo.HW_PREFETCHWT1 = (info[2] & (static_cast<int>(1) << 0)) != 0;
-
-				vectorInfo.HW_AVX512_F = (info[1] & (static_cast<int>(1) << 16)) != 0;
-				vectorInfo.HW_AVX512_CD = (info[1] & (static_cast<int>(1) << 28)) != 0;
-				vectorInfo.HW_AVX512_PF = (info[1] & (static_cast<int>(1) << 26)) != 0;
-				vectorInfo.HW_AVX512_ER = (info[1] & (static_cast<int>(1) << 27)) != 0;
-				vectorInfo.HW_AVX512_VL = (info[1] & (static_cast<int>(1) << 31)) != 0;
-				vectorInfo.HW_AVX512_BW = (info[1] & (static_cast<int>(1) << 30)) != 0;
-				vectorInfo.HW_AVX512_DQ = (info[1] & (static_cast<int>(1) << 17)) != 0;
-				vectorInfo.HW_AVX512_IFMA = (info[1] & (static_cast<int>(1) << 21)) != 0;
-				vectorInfo.HW_AVX512_VBMI = (info[2] & (static_cast<int>(1) << 1)) != 0;
-			}
-			if (nExIds >= 0x80000001) {
-				__cpuid_count(0x80000001, 0, info[0], info[1], info[2], info[3]);
-
-				vectorInfo.HW_x64 = (info[3] & (static_cast<int>(1) << 29)) != 0;
-				vectorInfo.HW_ABM = (info[2] & (static_cast<int>(1) << 5)) != 0;
-				vectorInfo.HW_SSE4a = (info[2] & (static_cast<int>(1) << 6)) != 0;
-				vectorInfo.HW_FMA4 = (info[2] & (static_cast<int>(1) << 16)) != 0;
-				vectorInfo.HW_XOP = (info[2] & (static_cast<int>(1) << 11)) != 0;
-			}
-#endif
-			return vectorInfo;
-		}
+		static CPUVectorInfo GetVectorInfo() { return GetCPUVectorInfo(); }
 
 		static SystemInfo GetSystemInfo() {
 			SystemInfo systemInfo;
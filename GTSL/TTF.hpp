@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "HashMap.hpp"
+#include "PerfectHash.hpp"
 
 /*
 * ttf-parser
@@ -547,7 +548,13 @@ namespace GTSL {
 	inline bool MakeFont(const Range<const byte*> buffer, Font* fontData) {
 		const char* data = reinterpret_cast<const char*>(buffer.begin());
 
-		HashMap<StringView, TableEntry, DefaultAllocatorReference> tables;
+		enum class ttfTable : uint8 { HEAD, MAXP, NAME, LOCA, CMAP, HHEA, GLYF, KERN, HMTX };
+		static constexpr PerfectHashMap TABLES({ u8"head", u8"maxp", u8"name", u8"loca", u8"cmap", u8"hhea", u8"glyf", u8"kern", u8"hmtx" },
+			{ ttfTable::HEAD, ttfTable::MAXP, ttfTable::NAME, ttfTable::LOCA, ttfTable::CMAP, ttfTable::HHEA, ttfTable::GLYF, ttfTable::KERN, ttfTable::HMTX });
+
+		// only the tables read below are kept, found through a compile time perfect hash of their tags instead of a map built per font
+		TableEntry tableEntries[TABLES.GetLength()]; bool tablesFound[TABLES.GetLength()] = {};
+		auto getTable = [&](const ttfTable table) { return Result(TableEntry(tableEntries[static_cast<uint8>(table)]), tablesFound[static_cast<uint8>(table)]); };
 
 		uint32 ptr = 0;
 
@@ -558,11 +565,11 @@ namespace GTSL {
 			for (uint16 i = 0; i < header.NumberOfTables; i++) {
 				TableEntry te;
 				te.Parse(data, ptr);
-				tables.Emplace(te.tagstr, te);
+				if (const auto table = TABLES.TryGet(StringView(te.tagstr))) { tableEntries[static_cast<uint8>(table.Get())] = te; tablesFound[static_cast<uint8>(table.Get())] = true; }
 			}
 		}
 
-		auto head_table_entry = tables.TryGet(u8"head");
+		auto head_table_entry = getTable(ttfTable::HEAD);
 		if (!head_table_entry) { return false; }
 
 		ptr = head_table_entry.Get().offsetPos;
@@ -572,14 +579,14 @@ namespace GTSL {
 
 		if (headTable.magicNumber != 0x5F0F3CF5) { return false; }
 
-		auto maxp_table_entry = tables.TryGet(u8"maxp");
+		auto maxp_table_entry = getTable(ttfTable::MAXP);
 		if (!maxp_table_entry) { return false; }
 
 		ptr = maxp_table_entry.Get().offsetPos;
 
 		MaximumProfile max_profile;
 		max_profile.Parse(data, ptr);
-		auto name_table_entry = tables.TryGet(u8"name");
+		auto name_table_entry = getTable(ttfTable::NAME);
 		if (!name_table_entry) { return false; }
 
 		ptr = name_table_entry.Get().offsetPos;
@@ -589,7 +596,7 @@ namespace GTSL {
 
 		fontData->FullFontName = fontData->NameTable[1] + " " + fontData->NameTable[2];
 
-		auto loca_table_entry = tables.TryGet(u8"loca");
+		auto loca_table_entry = getTable(ttfTable::LOCA);
 		if (!loca_table_entry) { return false; }
 
 		std::vector<uint32> glyphIndices(max_profile.numGlyphs);
@@ -616,7 +623,7 @@ namespace GTSL {
 			read(&end_of_glyf, data, &byte_offset);
 		}
 
-		auto cmap_table_entry = tables.TryGet(u8"cmap");
+		auto cmap_table_entry = getTable(ttfTable::CMAP);
 		if (!cmap_table_entry) { return false; }
 
 		uint32 cmap_offset = cmap_table_entry.Get().offsetPos + sizeof(uint16); //Skip version
@@ -711,7 +718,7 @@ namespace GTSL {
 		if (!valid_cmap_table) { return false; }
 
 		HHEATable hheaTable;
-		auto hhea_table_entry = tables.TryGet(u8"hhea");
+		auto hhea_table_entry = getTable(ttfTable::HHEA);
 		if (!hhea_table_entry) { return false; }
 		ptr = hhea_table_entry.Get().offsetPos;
 		hheaTable.Parse(data, ptr);
@@ -721,18 +728,18 @@ namespace GTSL {
 		fontData->Metadata.Descender = hheaTable.Descender;
 		fontData->Metadata.LineGap = hheaTable.LineGap;
 
-		auto glyf_table_entry = tables.TryGet(u8"glyf");
+		auto glyf_table_entry = getTable(ttfTable::GLYF);
 		if (!glyf_table_entry) { return false; }
 		
 		uint32 glyf_offset = glyf_table_entry.Get().offsetPos;
 
-		auto kern_table_entry = tables.TryGet(u8"kern");
+		auto kern_table_entry = getTable(ttfTable::KERN);
 		uint32 kernOffset = 0;
 		if (kern_table_entry) {
 			kernOffset = kern_table_entry.Get().offsetPos;
 		}
 
-		auto hmtx_table_entry = tables.TryGet(u8"hmtx");
+		auto hmtx_table_entry = getTable(ttfTable::HMTX);
 		if (!hmtx_table_entry) {
 			return false;
 		}
@@ -0,0 +1,376 @@
+#pragma once
+
+#include "Core.h"
+#include "Allocator.hpp"
+#include "Assert.h"
+#include "BlockingQueue.h"
+#include "ConditionVariable.h"
+#include "Delegate.hpp"
+#include "File.hpp"
+#include "Mutex.h"
+#include "Semaphore.h"
+#include "Thread.hpp"
+#include "Time.h"
+#include "TimerWheel.hpp"
+#include "Vector.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+namespace GTSL
+{
+	/**
+	 * \brief Anything coroutines can be resumed on.
+	 */
+	template<typename T>
+	concept Executor = requires(T t, std::coroutine_handle<> handle) { t.Schedule(handle); };
+
+	/**
+	 * \brief Allocates coroutine frames through ALLOCATOR instead of global new.
+	 * If the coroutine's first parameter is an ALLOCATOR it is used, else a default constructed one is.
+	 * A copy of the allocator is stored after the frame so it can be freed with the same instance.
+	 */
+	template<class ALLOCATOR>
+	struct CoroutineFrameAllocation {
+		static void* operator new(const std::size_t size) {
+			return allocate(size, ALLOCATOR());
+		}
+
+		template<typename... ARGS>
+		static void* operator new(const std::size_t size, const ALLOCATOR& allocator, ARGS&...) {
+			return allocate(size, allocator);
+		}
+
+		static void operator delete(void* data, const std::size_t size) {
+			auto* allocatorAddress = reinterpret_cast<ALLOCATOR*>(static_cast<byte*>(data) + allocatorOffset(size));
+			ALLOCATOR allocator(MoveRef(*allocatorAddress)); Destroy(*allocatorAddress);
+			allocator.Deallocate(allocatorOffset(size) + sizeof(ALLOCATOR), FRAME_ALIGNMENT, data);
+		}
+
+	private:
+		static constexpr uint64 FRAME_ALIGNMENT = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+		static constexpr uint64 allocatorOffset(const uint64 size) { return (size + alignof(ALLOCATOR) - 1) & ~(alignof(ALLOCATOR) - 1); }
+
+		static void* allocate(const uint64 size, const ALLOCATOR& allocator) {
+			ALLOCATOR frameAllocator(allocator);
+			void* data; uint64 allocatedSize;
+			frameAllocator.Allocate(allocatorOffset(size) + sizeof(ALLOCATOR), FRAME_ALIGNMENT, &data, &allocatedSize);
+			::new(static_cast<byte*>(data) + allocatorOffset(size)) ALLOCATOR(MoveRef(frameAllocator));
+			return data;
+		}
+	};
+
+	template<typename T>
+	struct TaskResult {
+		TaskResult() = default;
+		~TaskResult() { if (isSet) { Destroy(GetResult()); } }
+
+		template<typename V>
+		void return_value(V&& value) { ::new(storage) T(ForwardRef<V>(value)); isSet = true; }
+
+		T& GetResult() { return *reinterpret_cast<T*>(storage); }
+
+	private:
+		alignas(T) byte storage[sizeof(T)];
+		bool isSet = false;
+	};
+
+	template<>
+	struct TaskResult<void> {
+		void return_void() {}
+		void GetResult() {}
+	};
+
+	/**
+	 * \brief Lazily started coroutine which produces a T. Awaiting it starts it and resumes the awaiter once it finishes through symmetric transfer, so long chains of tasks never grow the stack.
+	 * \tparam T Type of the value produced by the coroutine.
+	 * \tparam ALLOCATOR Allocator used for the coroutine frame.
+	 */
+	template<typename T = void, class ALLOCATOR = DefaultAllocatorReference>
+	class Task {
+	public:
+		struct promise_type : CoroutineFrameAllocation<ALLOCATOR>, TaskResult<T> {
+			Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+			std::suspend_always initial_suspend() noexcept { return {}; }
+
+			struct FinalAwaiter {
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+					if (auto continuation = handle.promise().Continuation) { return continuation; }
+					return std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+
+			FinalAwaiter final_suspend() noexcept { return {}; }
+
+			void unhandled_exception() noexcept { std::terminate(); }
+
+			std::coroutine_handle<> Continuation;
+			bool Started = false; // set by Start, a started task is running on it's own and must not be awaited
+		};
+
+		Task() = default;
+		Task(const Task&) = delete;
+		Task(Task&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+
+		Task& operator=(Task&& other) noexcept {
+			if (handle) { handle.destroy(); }
+			handle = other.handle; other.handle = nullptr;
+			return *this;
+		}
+
+		~Task() { if (handle) { handle.destroy(); } }
+
+		auto operator co_await() noexcept {
+			struct Awaiter {
+				std::coroutine_handle<promise_type> Handle;
+
+				bool await_ready() noexcept { return !Handle || Handle.done(); }
+
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept {
+					GTSL_ASSERT(!Handle.promise().Started, "Awaiting a task which was started and hasn't finished would resume it twice.")
+					Handle.promise().Continuation = awaiter;
+					return Handle;
+				}
+
+				decltype(auto) await_resume() {
+					if constexpr (std::is_void_v<T>) { return; } else { return MoveRef(Handle.promise().GetResult()); }
+				}
+			};
+
+			return Awaiter{ handle };
+		}
+
+		/**
+		 * \brief Starts the coroutine on the calling thread, it will run until it's first suspension point.
+		 * A started task can't be awaited or SyncWait-ed until it's done, poll IsDone instead, or use a DetachedTask for work nobody waits on.
+		 */
+		void Start() { handle.promise().Started = true; handle.resume(); }
+
+		[[nodiscard]] bool IsDone() const noexcept { return !handle || handle.done(); }
+
+		/**
+		 * \brief Returns the produced value, only valid once the task is done.
+		 */
+		decltype(auto) GetResult() { return handle.promise().GetResult(); }
+
+		explicit operator bool() const noexcept { return static_cast<bool>(handle); }
+
+	private:
+		std::coroutine_handle<promise_type> handle;
+
+		explicit Task(const std::coroutine_handle<promise_type> handle) : handle(handle) {}
+	};
+
+	/**
+	 * \brief Eagerly started coroutine which destroys itself when it finishes, used to launch work nobody awaits.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	struct DetachedTask {
+		struct promise_type : CoroutineFrameAllocation<ALLOCATOR> {
+			DetachedTask get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	/**
+	 * \brief Awaitable which suspends the current coroutine and resumes it on executor.
+	 */
+	template<Executor E>
+	auto ScheduleOn(E& executor) noexcept {
+		struct Awaiter {
+			E& TargetExecutor;
+			bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { TargetExecutor.Schedule(handle); }
+			void await_resume() noexcept {}
+		};
+
+		return Awaiter{ executor };
+	}
+
+	/**
+	 * \brief Awaitable which resumes the current coroutine on executor once the Semaphore or Notification reaches zero, without blocking any thread.
+	 * \param synchronizationPrimitive Semaphore or Notification to wait on.
+	 * \param executor Executor to resume the coroutine on.
+	 */
+	template<class S, Executor E>
+	auto AsyncWait(S& synchronizationPrimitive, E& executor) noexcept {
+		struct Awaiter : SynchronizationWaiter {
+			S& Primitive; E& TargetExecutor;
+			std::coroutine_handle<> Handle;
+
+			Awaiter(S& primitive, E& executor) : Primitive(primitive), TargetExecutor(executor) {
+				Callback = [](SynchronizationWaiter* waiter) { auto* self = static_cast<Awaiter*>(waiter); self->TargetExecutor.Schedule(self->Handle); };
+			}
+
+			bool await_ready() noexcept { return false; }
+			bool await_suspend(std::coroutine_handle<> handle) { Handle = handle; return Primitive.AddWaiter(this); }
+			void await_resume() noexcept {}
+		};
+
+		return Awaiter(synchronizationPrimitive, executor);
+	}
+
+	/**
+	 * \brief Awaitable which resumes the current coroutine once time has passed. The executor must provide ScheduleAt(handle, deadline).
+	 * \param executor Executor to resume the coroutine on.
+	 * \param time Minimum time to wait for.
+	 */
+	template<class E>
+	auto Delay(E& executor, const Nanoseconds time) noexcept {
+		struct Awaiter {
+			E& TargetExecutor; Nanoseconds Deadline;
+			bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { TargetExecutor.ScheduleAt(handle, Deadline); }
+			void await_resume() noexcept {}
+		};
+
+		return Awaiter{ executor, GetMonotonicTime() + time };
+	}
+
+	/**
+	 * \brief Awaitable which performs a blocking file read on ioExecutor's threads and resumes the current coroutine on resumeExecutor.
+	 * Keeping I/O on a small dedicated executor lets thousands of loads be in flight without one thread per load.
+	 * \return Number of bytes read.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference, Executor IO, Executor E>
+	auto AsyncRead(IO& ioExecutor, E& resumeExecutor, const File& file, const Range<byte*> buffer) noexcept {
+		struct Awaiter {
+			IO& IOExecutor; E& ResumeExecutor;
+			const File& SourceFile; Range<byte*> Buffer;
+			uint64 BytesRead = 0;
+
+			bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { read(handle); }
+			uint64 await_resume() noexcept { return BytesRead; }
+
+		private:
+			DetachedTask<ALLOCATOR> read(std::coroutine_handle<> handle) {
+				co_await ScheduleOn(IOExecutor);
+				BytesRead = SourceFile.Read(Buffer.Bytes(), Buffer.begin());
+				ResumeExecutor.Schedule(handle);
+			}
+		};
+
+		return Awaiter{ ioExecutor, resumeExecutor, file, buffer };
+	}
+
+	template<class ALLOCATOR = DefaultAllocatorReference, Executor IO>
+	auto AsyncRead(IO& ioExecutor, const File& file, const Range<byte*> buffer) noexcept {
+		return AsyncRead<ALLOCATOR>(ioExecutor, ioExecutor, file, buffer);
+	}
+
+	/**
+	 * \brief Blocks the calling thread until task completes and returns it's result. Meant for the boundary between regular and coroutine code.
+	 */
+	template<typename T, class ALLOCATOR>
+	decltype(auto) SyncWait(Task<T, ALLOCATOR>& task) {
+		Mutex mutex; ConditionVariable conditionVariable; bool done = false;
+
+		auto wait = [](Task<T, ALLOCATOR>& task, Mutex& mutex, ConditionVariable& conditionVariable, bool& done) -> DetachedTask<ALLOCATOR> {
+			co_await task;
+			Lock lock(mutex); done = true; conditionVariable.NotifyAll();
+		};
+
+		wait(task, mutex, conditionVariable, done);
+
+		{
+			Lock lock(mutex);
+			conditionVariable.Wait(lock, [&]() { return done; });
+		}
+
+		return task.GetResult();
+	}
+
+	/**
+	 * \brief Executor which resumes coroutines on a fixed set of GTSL::Threads and keeps a TimerWheel of timed resumptions.
+	 * \tparam ALLOCATOR Allocator used for thread data and internal storage.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class ThreadPoolExecutor {
+	public:
+		/**
+		 * \brief Launches the worker threads.
+		 * \param threadCount Number of threads resuming coroutines.
+		 * \param firstThreadId Thread id given to the first worker, the rest, and the timer thread, are given consecutive ids. Id 0 is usually the main thread.
+		 */
+		ThreadPoolExecutor(const uint8 threadCount, const uint8 firstThreadId = 1, const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), threads(threadCount + 1, allocator), timerWheel(Milliseconds(1), 1024, allocator) {
+			for (uint8 i = 0; i < threadCount; ++i) {
+				threads.EmplaceBack(this->allocator, static_cast<uint8>(firstThreadId + i), Delegate<void(ThreadPoolExecutor*)>::template Create<&ThreadPoolExecutor::work>(), this);
+			}
+
+			threads.EmplaceBack(this->allocator, static_cast<uint8>(firstThreadId + threadCount), Delegate<void(ThreadPoolExecutor*)>::template Create<&ThreadPoolExecutor::serviceTimers>(), this);
+		}
+
+		ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+		ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+		~ThreadPoolExecutor() {
+			{
+				Lock lock(timersMutex);
+				stop = true;
+			}
+
+			timersConditionVariable.NotifyAll();
+			queue.End();
+
+			for (auto& thread : threads) { thread.Join(allocator); }
+		}
+
+		void Schedule(const std::coroutine_handle<> handle) { queue.Push(handle); }
+
+		/**
+		 * \brief Resumes handle on one of the worker threads once deadline, as returned by GetMonotonicTime, is reached.
+		 */
+		void ScheduleAt(const std::coroutine_handle<> handle, const Nanoseconds deadline) {
+			{
+				Lock lock(timersMutex);
+				timerWheel.Schedule(deadline, TimerWheel<ALLOCATOR>::Callback::template Create<ThreadPoolExecutor, &ThreadPoolExecutor::onTimer>(this), Nanoseconds(0), handle.address());
+			}
+
+			timersConditionVariable.NotifyOne();
+		}
+
+	private:
+		[[no_unique_address]] ALLOCATOR allocator;
+		BlockingQueue<std::coroutine_handle<>> queue;
+		Vector<Thread, ALLOCATOR> threads;
+
+		Mutex timersMutex;
+		ConditionVariable timersConditionVariable;
+		TimerWheel<ALLOCATOR> timerWheel;
+		bool stop = false;
+
+		static void work(ThreadPoolExecutor* self) {
+			std::coroutine_handle<> handle;
+			while (self->queue.Pop(handle)) { handle.resume(); self->queue.Done(); }
+		}
+
+		static void serviceTimers(ThreadPoolExecutor* self) {
+			self->serviceTimers();
+		}
+
+		void serviceTimers() {
+			Lock lock(timersMutex);
+
+			while (!stop) {
+				if (!timerWheel.GetTimerCount()) { timersConditionVariable.Wait(timersMutex); continue; }
+
+				timerWheel.Advance();
+
+				if (timerWheel.GetTimerCount()) { timersConditionVariable.Wait(timersMutex, timerWheel.GetTimeUntilNextTick()); }
+			}
+		}
+
+		void onTimer(const TimerHandle timerHandle) {
+			Schedule(std::coroutine_handle<>::from_address(timerWheel.GetUserData(timerHandle)));
+		}
+	};
+}
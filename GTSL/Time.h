@@ -3,6 +3,12 @@
 #include "Core.h"
 #include "RatioUnit.hpp"
 
+#if (_WIN64)
+#include <Windows.h>
+#elif __linux__
+#include <time.h>
+#endif
+
 namespace GTSL
 {
 	using SignedNanoseconds  = RatioUnit<int64, 1, 1000000000>;
@@ -17,6 +23,35 @@ namespace GTSL
 	using Minutes      = RatioUnit<uint64, 60, 1>;
 	using Hour		   = RatioUnit<uint64, 3600, 1>;
 	using Day		   = RatioUnit<uint64, 86400, 1>;
+
+	/**
+	 * \brief Returns the time elapsed since an unspecified point in the past. Unaffected by changes to the system clock.
+	 * \return Monotonic time.
+	 */
+	inline Nanoseconds GetMonotonicTime() noexcept {
+#if (_WIN64)
+		LARGE_INTEGER counter, frequency;
+		QueryPerformanceCounter(&counter); QueryPerformanceFrequency(&frequency);
+		const uint64 seconds = counter.QuadPart / frequency.QuadPart, remainder = counter.QuadPart % frequency.QuadPart;
+		return Nanoseconds(seconds * 1000000000ull + remainder * 1000000000ull / frequency.QuadPart);
+#elif __linux__
+		timespec time;
+		clock_gettime(CLOCK_MONOTONIC, &time);
+		return Nanoseconds(static_cast<uint64>(time.tv_sec) * 1000000000ull + static_cast<uint64>(time.tv_nsec));
+#endif
+	}
+
+	/**
+	 * \brief Suspends the calling thread for at least duration.
+	 */
+	inline void SleepFor(const Nanoseconds duration) noexcept {
+#if (_WIN64)
+		Sleep(static_cast<DWORD>(duration.GetCount() / 1000000ull));
+#elif __linux__
+		timespec time{ static_cast<time_t>(duration.GetCount() / 1000000000ull), static_cast<long>(duration.GetCount() % 1000000000ull) };
+		while (nanosleep(&time, &time) == -1) {}
+#endif
+	}
 	
 	//template<typename T, uint64 ratio>
 	//T TimeUnitCast(const UnsignedTimeUnit<ratio>& timeUnit) { return T(timeUnit.count / ratio); }
@@ -0,0 +1,321 @@
+#pragma once
+
+#include "Core.h"
+#include "Allocator.hpp"
+#include "Assert.h"
+#include "ConditionVariable.h"
+#include "Delegate.hpp"
+#include "Mutex.h"
+#include "Thread.hpp"
+#include "Time.h"
+#include "Vector.hpp"
+
+namespace GTSL
+{
+	/**
+	 * \brief Identifies a scheduled timer. Handles of fired or cancelled timers are detected as stale.
+	 */
+	struct TimerHandle {
+		uint32 Index = ~0u, Generation = 0;
+
+		explicit operator bool() const { return Index != ~0u; }
+		bool operator==(const TimerHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+	};
+
+	/**
+	 * \brief Hierarchical timing wheel, schedules Delegate callbacks at deadlines on the monotonic clock.
+	 * Time is split in ticks of a fixed resolution, timers are bucketed in 4 levels of 256 slots so insertion and cancellation are O(1)
+	 * and expiring a slot fires all of it's timers in one batch. Timers further than 2^32 ticks away are clamped and re-bucketed on cascade.
+	 * Not thread safe, meant to be advanced from a worker loop, see TimerThread for a self servicing version.
+	 * \tparam ALLOCATOR Allocator used for the timer storage.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class TimerWheel {
+	public:
+		using Callback = Delegate<void(TimerHandle)>;
+
+		/**
+		 * \param resolution Duration of a tick, deadlines are rounded up to it.
+		 * \param initialCapacity Number of timers to allocate storage for.
+		 * \param allocator Allocator used for the timer storage.
+		 */
+		explicit TimerWheel(const Nanoseconds resolution = Milliseconds(1), const uint32 initialCapacity = 1024, const ALLOCATOR& allocator = ALLOCATOR()) : timers(initialCapacity, allocator),
+		resolution(resolution.GetCount()), start(GetMonotonicTime().GetCount()) {
+			for (auto& slot : slots) { slot = INVALID; }
+		}
+
+		/**
+		 * \brief Schedules callback to be called once deadline is reached.
+		 * \param deadline Time, as returned by GetMonotonicTime, at which to fire.
+		 * \param callback Delegate to call, it receives the timer's handle.
+		 * \param period If not zero the timer will be rescheduled every period after firing until it's cancelled.
+		 * \param userData Pointer which can be retrieved with GetUserData from within the callback.
+		 * \return Handle to the timer.
+		 */
+		TimerHandle Schedule(const Nanoseconds deadline, const Callback callback, const Nanoseconds period = Nanoseconds(0), void* userData = nullptr) {
+			if (!timerCount) { Advance(); } // an empty wheel isn't advanced by it's servicing loop, catch up first so the timer isn't placed in the past
+
+			uint32 index;
+
+			if (freeList != INVALID) {
+				index = freeList; freeList = timers[index].Next;
+			} else {
+				index = timers.GetLength(); timers.EmplaceBack();
+			}
+
+			auto& timer = timers[index];
+			timer.Deadline = toTick(deadline.GetCount()); timer.Period = period.GetCount() ? ceilDivide(period.GetCount(), resolution) : 0;
+			timer.Function = callback; timer.UserData = userData;
+
+			if (timer.Deadline <= currentTick) { timer.Deadline = currentTick + 1; } // already due, the current tick has expired so fire on the next one
+
+			insert(index);
+			++timerCount;
+
+			return TimerHandle{ index, timer.Generation };
+		}
+
+		/**
+		 * \brief Schedules callback to be called once delay has passed from now.
+		 */
+		TimerHandle ScheduleAfter(const Nanoseconds delay, const Callback callback, const Nanoseconds period = Nanoseconds(0), void* userData = nullptr) {
+			return Schedule(GetMonotonicTime() + delay, callback, period, userData);
+		}
+
+		/**
+		 * \brief Cancels a pending timer, can be called from within callbacks.
+		 * \return Whether the timer was pending, false if it already fired or was cancelled.
+		 */
+		bool Cancel(const TimerHandle handle) {
+			if (!IsPending(handle)) { return false; }
+			unlink(handle.Index);
+			release(handle.Index);
+			return true;
+		}
+
+		[[nodiscard]] bool IsPending(const TimerHandle handle) const {
+			return handle.Index < timers.GetLength() && timers[handle.Index].Generation == handle.Generation && timers[handle.Index].Slot != FREE;
+		}
+
+		[[nodiscard]] void* GetUserData(const TimerHandle handle) const { return timers[handle.Index].UserData; }
+
+		/**
+		 * \brief Fires every timer whose deadline is at or before now, in deadline order at tick granularity.
+		 * Timers due at a tick cascade into it's level 0 slot before it's expired, so they fire at exactly their tick.
+		 * \param now Current time, as returned by GetMonotonicTime.
+		 * \return Number of fired callbacks.
+		 */
+		uint32 Advance(const Nanoseconds now = GetMonotonicTime()) {
+			const uint64 target = now.GetCount() > start ? (now.GetCount() - start) / resolution : 0;
+			uint32 fired = 0;
+
+			while (currentTick < target) {
+				if (!timerCount) { currentTick = target; break; } // nothing to cascade or fire, jump ahead
+
+				++currentTick;
+
+				for (uint32 level = LEVELS - 1; level > 0; --level) { // cascade higher levels first so their timers can flow down to level 0
+					if ((currentTick & ((1ull << (level * SLOT_BITS)) - 1)) == 0) { cascade(level); }
+				}
+
+				fired += expire(slotIndex(0, currentTick));
+			}
+
+			return fired;
+		}
+
+		/**
+		 * \brief Returns the time until the next tick boundary, useful to decide how long a servicing thread can sleep.
+		 */
+		[[nodiscard]] Nanoseconds GetTimeUntilNextTick(const Nanoseconds now = GetMonotonicTime()) const {
+			const uint64 nextTickTime = start + (currentTick + 1) * resolution;
+			return Nanoseconds(nextTickTime > now.GetCount() ? nextTickTime - now.GetCount() : 0);
+		}
+
+		[[nodiscard]] uint32 GetTimerCount() const { return timerCount; }
+
+		[[nodiscard]] Nanoseconds GetResolution() const { return Nanoseconds(resolution); }
+
+	private:
+		static constexpr uint32 LEVELS = 4, SLOT_BITS = 8, SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+		static constexpr uint32 INVALID = ~0u;
+		static constexpr uint16 FREE = 0xFFFF, BATCH = 0xFFFE;
+
+		struct Timer {
+			uint64 Deadline = 0, Period = 0;
+			Callback Function;
+			void* UserData = nullptr;
+			uint32 Next = INVALID, Previous = INVALID;
+			uint32 Generation = 0;
+			uint16 Slot = FREE;
+		};
+
+		Vector<Timer, ALLOCATOR> timers;
+		uint32 slots[LEVELS * SLOTS_PER_LEVEL];
+		uint32 batch = INVALID, freeList = INVALID, timerCount = 0;
+		uint64 resolution, start, currentTick = 0;
+
+		static uint64 ceilDivide(const uint64 a, const uint64 b) { return (a + b - 1) / b; }
+
+		static uint32 slotIndex(const uint32 level, const uint64 tick) { return level * SLOTS_PER_LEVEL + static_cast<uint32>((tick >> (level * SLOT_BITS)) & (SLOTS_PER_LEVEL - 1)); }
+
+		uint64 toTick(const uint64 time) const { return time > start ? ceilDivide(time - start, resolution) : 0; }
+
+		uint32& headOf(const uint16 slot) { return slot == BATCH ? batch : slots[slot]; }
+
+		void insert(const uint32 index) {
+			auto& timer = timers[index];
+
+			if (timer.Deadline < currentTick) { timer.Deadline = currentTick; }
+
+			const uint64 delta = timer.Deadline - currentTick;
+
+			uint32 level = 0;
+			while (level < LEVELS - 1 && delta >= (1ull << ((level + 1) * SLOT_BITS))) { ++level; }
+
+			const uint64 maxDelta = (1ull << (LEVELS * SLOT_BITS)) - 1;
+			const uint16 slot = static_cast<uint16>(slotIndex(level, delta > maxDelta ? currentTick + maxDelta : timer.Deadline));
+
+			link(index, slot);
+		}
+
+		void link(const uint32 index, const uint16 slot) {
+			auto& timer = timers[index]; auto& head = headOf(slot);
+			timer.Slot = slot; timer.Previous = INVALID; timer.Next = head;
+			if (head != INVALID) { timers[head].Previous = index; }
+			head = index;
+		}
+
+		void unlink(const uint32 index) {
+			auto& timer = timers[index];
+			if (timer.Previous != INVALID) { timers[timer.Previous].Next = timer.Next; } else { headOf(timer.Slot) = timer.Next; }
+			if (timer.Next != INVALID) { timers[timer.Next].Previous = timer.Previous; }
+			timer.Next = timer.Previous = INVALID;
+		}
+
+		void release(const uint32 index) {
+			auto& timer = timers[index];
+			timer.Slot = FREE; ++timer.Generation;
+			timer.Next = freeList; freeList = index;
+			--timerCount;
+		}
+
+		void cascade(const uint32 level) {
+			auto& head = slots[slotIndex(level, currentTick)];
+			uint32 index = head; head = INVALID;
+
+			while (index != INVALID) {
+				const uint32 next = timers[index].Next;
+				insert(index);
+				index = next;
+			}
+		}
+
+		uint32 expire(const uint32 slot) {
+			GTSL_ASSERT(batch == INVALID, "Advance called from within a timer callback.")
+
+			batch = slots[slot]; slots[slot] = INVALID; // detach the whole slot, callbacks may schedule into it
+			for (uint32 index = batch; index != INVALID; index = timers[index].Next) { timers[index].Slot = BATCH; }
+
+			uint32 fired = 0;
+
+			while (batch != INVALID) {
+				const uint32 index = batch;
+				unlink(index);
+
+				const TimerHandle handle{ index, timers[index].Generation };
+				timers[index].Slot = BATCH; // keep it cancellable from within it's own callback
+				timers[index].Function(handle);
+				++fired;
+
+				if (IsPending(handle)) {
+					auto& timer = timers[index];
+					if (timer.Period) {
+						timer.Deadline = currentTick + timer.Period; insert(index);
+					} else {
+						release(index);
+					}
+				}
+			}
+
+			return fired;
+		}
+	};
+
+	/**
+	 * \brief TimerWheel serviced by a dedicated GTSL::Thread. Scheduling and cancelling is thread safe, callbacks run on the timer thread.
+	 */
+	template<class ALLOCATOR = DefaultAllocatorReference>
+	class TimerThread {
+	public:
+		/**
+		 * \param threadId Id given to the servicing thread.
+		 * \param resolution Duration of a tick.
+		 * \param allocator Allocator used for the timer storage and thread data.
+		 */
+		explicit TimerThread(const uint8 threadId, const Nanoseconds resolution = Milliseconds(1), const ALLOCATOR& allocator = ALLOCATOR()) : allocator(allocator), timerWheel(resolution, 1024, allocator),
+		thread(allocator, threadId, Delegate<void(TimerThread*)>::template Create<&TimerThread::run>(), this) {}
+
+		TimerThread(const TimerThread&) = delete;
+		TimerThread& operator=(const TimerThread&) = delete;
+
+		~TimerThread() {
+			{
+				Lock lock(mutex);
+				stop = true;
+			}
+
+			conditionVariable.NotifyAll();
+			thread.Join(allocator);
+		}
+
+		TimerHandle Schedule(const Nanoseconds deadline, const typename TimerWheel<ALLOCATOR>::Callback callback, const Nanoseconds period = Nanoseconds(0), void* userData = nullptr) {
+			TimerHandle handle;
+
+			{
+				Lock lock(mutex);
+				handle = timerWheel.Schedule(deadline, callback, period, userData);
+			}
+
+			conditionVariable.NotifyOne();
+			return handle;
+		}
+
+		TimerHandle ScheduleAfter(const Nanoseconds delay, const typename TimerWheel<ALLOCATOR>::Callback callback, const Nanoseconds period = Nanoseconds(0), void* userData = nullptr) {
+			return Schedule(GetMonotonicTime() + delay, callback, period, userData);
+		}
+
+		bool Cancel(const TimerHandle handle) {
+			Lock lock(mutex);
+			return timerWheel.Cancel(handle);
+		}
+
+		/**
+		 * \brief Returns the user data of handle, only valid from within callbacks or for pending timers.
+		 */
+		void* GetUserData(const TimerHandle handle) {
+			Lock lock(mutex);
+			return timerWheel.GetUserData(handle);
+		}
+
+	private:
+		[[no_unique_address]] ALLOCATOR allocator;
+		Mutex mutex; // recursive, callbacks can schedule and cancel
+		ConditionVariable conditionVariable; // signaled when a timer is scheduled or the thread has to stop
+		TimerWheel<ALLOCATOR> timerWheel;
+		bool stop = false;
+		Thread thread;
+
+		static void run(TimerThread* self) {
+			Lock lock(self->mutex);
+
+			while (!self->stop) { // sleeps while there are no timers, otherwise wakes every tick or when a timer is scheduled
+				if (!self->timerWheel.GetTimerCount()) { self->conditionVariable.Wait(self->mutex); continue; }
+
+				self->timerWheel.Advance();
+
+				if (self->timerWheel.GetTimerCount()) { self->conditionVariable.Wait(self->mutex, self->timerWheel.GetTimeUntilNextTick()); }
+			}
+		}
+	};
+}
@@ -2,9 +2,11 @@
 
 #include "Core.h"
 #include <array>
+#include <cstring>
 #include "Result.h"
 #include "Pair.hpp"
 #include "Bitman.h"
+#include "SIMD.hpp"
 
 namespace GTSL {
 	struct utf_t {
@@ -132,4 +134,297 @@ namespace GTSL {
 
 		return { (char32_t)bigChar, !e };
 	}
-}
\ No newline at end of file
+
+	/**
+	 * Bulk UTF kernels. They process a vector of bytes at a time, 32 when the build's baseline includes AVX2 and 16 otherwise(SSE4.2),
+	 * so they can be called from anywhere without dispatching.
+	 */
+#if defined(__AVX2__)
+	using UTF8Vector = SIMD<uint8, 32>;
+#else
+	using UTF8Vector = SIMD<uint8, 16>;
+#endif
+
+	/**
+	 * \brief Vectorized UTF-8 validator, Keiser and Lemire's lookup algorithm(Validating UTF-8 In Less Than One Instruction Per Byte).
+	 * Every byte is classified by the high nibble of itself and the low and high nibbles of the byte before, three table lookups whose AND is non zero
+	 * only for malformed 2 byte windows. The 3rd and 4th bytes of longer sequences are checked against the leads 2 and 3 bytes back.
+	 * Blocks without non ASCII bytes only check that the previous block didn't end mid sequence.
+	 */
+	template<class V>
+	class utf8Validator {
+	public:
+		static constexpr uint32 WIDTH = sizeof(V);
+
+		utf8Validator() : byte1High(V::LoadLane(UnalignedPointer<const uint8>(BYTE_1_HIGH))), byte1Low(V::LoadLane(UnalignedPointer<const uint8>(BYTE_1_LOW))),
+		byte2High(V::LoadLane(UnalignedPointer<const uint8>(BYTE_2_HIGH))), maxValues(UnalignedPointer<const uint8>(MAX_VALUES + 32 - WIDTH)) {}
+
+		void Check(const V input) {
+			if (!input.BitMask()) {
+				error = error | previousIncomplete;
+				previousIncomplete = V(static_cast<uint8>(0)); previousInput = input;
+				return;
+			}
+
+			const V previous1 = V::template ShiftIn<1>(previousInput, input);
+			const V specialCases = V::ShuffleBytes(byte1High, previous1.template ShiftBitsRight<4>()) & V::ShuffleBytes(byte1Low, previous1 & V(static_cast<uint8>(0x0F))) & V::ShuffleBytes(byte2High, input.template ShiftBitsRight<4>());
+
+			const V previous2 = V::template ShiftIn<2>(previousInput, input), previous3 = V::template ShiftIn<3>(previousInput, input);
+			const V mustBeContinuation = V::SubtractSaturated(previous2, V(static_cast<uint8>(0xE0 - 0x80))) | V::SubtractSaturated(previous3, V(static_cast<uint8>(0xF0 - 0x80))); // high bit set 2 bytes after a 3+ byte lead or 3 after a 4 byte lead
+
+			error = error | ((mustBeContinuation & V(static_cast<uint8>(0x80))) ^ specialCases);
+			previousIncomplete = V::SubtractSaturated(input, maxValues);
+			previousInput = input;
+		}
+
+		/**
+		 * \brief Whether every checked byte was valid and the input didn't end mid sequence.
+		 */
+		[[nodiscard]] bool IsValid() const { return (error | previousIncomplete).IsZero(); }
+
+	private:
+		static constexpr uint8 TOO_SHORT = 1 << 0, TOO_LONG = 1 << 1, OVERLONG_3 = 1 << 2, TOO_LARGE = 1 << 3, SURROGATE = 1 << 4, OVERLONG_2 = 1 << 5, TOO_LARGE_1000 = 1 << 6, OVERLONG_4 = 1 << 6, TWO_CONTS = 1 << 7;
+		static constexpr uint8 CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+		static constexpr uint8 BYTE_1_HIGH[16] = { // high nibble of the first byte
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, // ASCII
+			TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, // continuation
+			TOO_SHORT | OVERLONG_2, TOO_SHORT, // 2 byte lead
+			TOO_SHORT | OVERLONG_3 | SURROGATE, // 3 byte lead
+			TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4 // 4 byte lead
+		};
+
+		static constexpr uint8 BYTE_1_LOW[16] = { // low nibble of the first byte
+			CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY,
+			CARRY | TOO_LARGE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000
+		};
+
+		static constexpr uint8 BYTE_2_HIGH[16] = { // high nibble of the second byte
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, // ASCII
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, // 1000____
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE, // 1001____
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, // 101_____
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT // lead
+		};
+
+		// a block is incomplete if any of it's last 3 bytes is a lead needing more bytes than are left
+		static constexpr uint8 MAX_VALUES[32] = { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+
+		V byte1High, byte1Low, byte2High, maxValues;
+		V error = V(static_cast<uint8>(0)), previousInput = V(static_cast<uint8>(0)), previousIncomplete = V(static_cast<uint8>(0));
+	};
+
+	/**
+	 * \brief Returns whether data is well formed UTF-8: no overlong encodings, surrogates, code points above U+10FFFF, stray continuation bytes or truncated sequences.
+	 */
+	inline bool ValidateUTF8(const char8_t* data, const uint32 bytes) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+		utf8Validator<UTF8Vector> validator;
+
+		uint32 i = 0;
+		for (; i + WIDTH <= bytes; i += WIDTH) { validator.Check(UTF8Vector(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + i)))); }
+
+		if (i < bytes) { // zero padding reads as ASCII, which flags sequences cut by the end of data
+			alignas(32) uint8 tail[WIDTH] = {};
+			for (uint32 j = 0; i + j < bytes; ++j) { tail[j] = static_cast<uint8>(data[i + j]); }
+			validator.Check(UTF8Vector(UnalignedPointer<const uint8>(tail)));
+		}
+
+		return validator.IsValid();
+	}
+
+	/**
+	 * \brief Counts the code points in bytes of UTF-8 as the bytes which aren't continuation bytes(10xxxxxx), a compare and a popcount per vector.
+	 */
+	inline uint32 CountUTF8Codepoints(const char8_t* data, const uint32 bytes) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+		const UTF8Vector continuationMask(static_cast<uint8>(0xC0)), continuation(static_cast<uint8>(0x80));
+
+		uint32 continuations = 0, i = 0;
+
+		for (; i + WIDTH <= bytes; i += WIDTH) {
+			const UTF8Vector block(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(data + i)));
+			continuations += NumberOfSetBits(static_cast<uint32>(((block & continuationMask) == continuation).BitMask()));
+		}
+
+		for (; i < bytes; ++i) { continuations += (data[i] & 0xC0) == 0x80; }
+
+		return bytes - continuations;
+	}
+
+	/**
+	 * \brief Returns the byte length, without the terminator, and code point count of a null terminated UTF-8 string.
+	 * The terminator is found by the C library's strlen, already vectorized and safe to run under sanitizers, and the code points counted by CountUTF8Codepoints while the bytes are still in cache.
+	 */
+	inline Pair<uint32, uint32> UTF8Lengths(const char8_t* text) {
+		const uint32 bytes = static_cast<uint32>(std::strlen(reinterpret_cast<const char*>(text)));
+		return { bytes, CountUTF8Codepoints(text, bytes) };
+	}
+
+	/**
+	 * \brief Encodes a code point as UTF-8.
+	 * \return Number of bytes written, 0 if codePoint is a surrogate or above U+10FFFF.
+	 */
+	inline uint8 EncodeUTF8(const char32_t codePoint, char8_t* destination) {
+		const uint32 c = static_cast<uint32>(codePoint);
+		if (c < 0x80) { destination[0] = static_cast<char8_t>(c); return 1; }
+		if (c < 0x800) { destination[0] = static_cast<char8_t>(0xC0 | c >> 6); destination[1] = static_cast<char8_t>(0x80 | (c & 0x3F)); return 2; }
+		if (c < 0x10000) {
+			if ((c >> 11) == 0x1B) { return 0; }
+			destination[0] = static_cast<char8_t>(0xE0 | c >> 12); destination[1] = static_cast<char8_t>(0x80 | (c >> 6 & 0x3F)); destination[2] = static_cast<char8_t>(0x80 | (c & 0x3F));
+			return 3;
+		}
+		if (c > 0x10FFFF) { return 0; }
+		destination[0] = static_cast<char8_t>(0xF0 | c >> 18); destination[1] = static_cast<char8_t>(0x80 | (c >> 12 & 0x3F)); destination[2] = static_cast<char8_t>(0x80 | (c >> 6 & 0x3F)); destination[3] = static_cast<char8_t>(0x80 | (c & 0x3F));
+		return 4;
+	}
+
+	/**
+	 * \brief Decodes UTF-8, calling onCodePoint(char32_t) for every code point. Runs of ASCII are found a vector at a time and handed to onASCII(const char8_t*, uint32 count).
+	 * \return Number of bytes consumed, less than bytes if an invalid or truncated sequence was found there.
+	 */
+	template<typename A, typename C>
+	uint32 decodeUTF8(const char8_t* source, const uint32 bytes, A&& onASCII, C&& onCodePoint) {
+		constexpr uint32 WIDTH = sizeof(UTF8Vector);
+		uint32 i = 0;
+
+		while (i < bytes) {
+			if (source[i] < 0x80 && i + WIDTH <= bytes && !UTF8Vector(UnalignedPointer<const uint8>(reinterpret_cast<const uint8*>(source + i))).BitMask()) {
+				onASCII(source + i, WIDTH); i += WIDTH;
+				continue;
+			}
+
+			const uint8 length = UTF8CodePointLength(source[i]);
+			if (!length || i + length > bytes) { return i; }
+
+			const auto codePoint = ToUTF32(source[i], length > 1 ? source[i + 1] : 0, length > 2 ? source[i + 2] : 0, length > 3 ? source[i + 3] : 0, length);
+			if (!codePoint.State()) { return i; }
+
+			onCodePoint(codePoint.Get()); i += length;
+		}
+
+		return i;
+	}
+
+	/**
+	 * \brief Converts UTF-8 to UTF-32, validating it.
+	 * \param destination Must have room for bytes code points, the worst case.
+	 * \return Number of code points written, fails at the first malformed sequence.
+	 */
+	inline Result<uint32> UTF8ToUTF32(const char8_t* source, const uint32 bytes, char32_t* destination) {
+		uint32 written = 0;
+		const uint32 consumed = decodeUTF8(source, bytes, [&](const char8_t* ascii, const uint32 count) { for (uint32 j = 0; j < count; ++j) { destination[written + j] = ascii[j]; } written += count; },
+			[&](const char32_t codePoint) { destination[written++] = codePoint; });
+		return Result(MoveRef(written), consumed == bytes);
+	}
+
+	/**
+	 * \brief Converts UTF-8 to UTF-16, validating it. Code points above U+FFFF become surrogate pairs.
+	 * \param destination Must have room for bytes code units, the worst case.
+	 * \return Number of code units written, fails at the first malformed sequence.
+	 */
+	inline Result<uint32> UTF8ToUTF16(const char8_t* source, const uint32 bytes, char16_t* destination) {
+		uint32 written = 0;
+		const uint32 consumed = decodeUTF8(source, bytes, [&](const char8_t* ascii, const uint32 count) { for (uint32 j = 0; j < count; ++j) { destination[written + j] = ascii[j]; } written += count; },
+			[&](const char32_t codePoint) {
+				if (codePoint < 0x10000) { destination[written++] = static_cast<char16_t>(codePoint); return; }
+				destination[written++] = static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10)); destination[written++] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+			});
+		return Result(MoveRef(written), consumed == bytes);
+	}
+
+	/**
+	 * \brief Converts UTF-16 to UTF-8, validating surrogate pairs. Blocks of 16 ASCII code units are narrowed without per unit branches.
+	 * \param destination Must have room for 3 bytes per code unit, the worst case.
+	 * \return Number of bytes written, fails at the first unpaired surrogate.
+	 */
+	inline Result<uint32> UTF16ToUTF8(const char16_t* source, const uint32 count, char8_t* destination) {
+		uint32 written = 0, i = 0;
+
+		while (i < count) {
+			if (i + 16 <= count) {
+				uint32 bits = 0;
+				for (uint32 j = 0; j < 16; ++j) { bits |= source[i + j]; }
+				if (bits < 0x80) { for (uint32 j = 0; j < 16; ++j) { destination[written + j] = static_cast<char8_t>(source[i + j]); } written += 16; i += 16; continue; }
+			}
+
+			char32_t codePoint = source[i];
+
+			if ((codePoint >> 10) == 0x36) { // high surrogate
+				if (i + 1 >= count || (source[i + 1] >> 10) != 0x37) { return Result(MoveRef(written), false); }
+				codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (source[i + 1] - 0xDC00); ++i;
+			}
+
+			const uint8 length = EncodeUTF8(codePoint, destination + written);
+			if (!length) { return Result(MoveRef(written), false); }
+			written += length; ++i;
+		}
+
+		return Result(MoveRef(written), true);
+	}
+
+	/**
+	 * \brief Converts UTF-32 to UTF-8, validating every code point. Blocks of 16 ASCII code points are narrowed without per element branches.
+	 * \param destination Must have room for 4 bytes per code point, the worst case.
+	 * \return Number of bytes written, fails at the first surrogate or code point above U+10FFFF.
+	 */
+	inline Result<uint32> UTF32ToUTF8(const char32_t* source, const uint32 count, char8_t* destination) {
+		uint32 written = 0, i = 0;
+
+		while (i < count) {
+			if (i + 16 <= count) {
+				uint32 bits = 0;
+				for (uint32 j = 0; j < 16; ++j) { bits |= source[i + j]; }
+				if (bits < 0x80) { for (uint32 j = 0; j < 16; ++j) { destination[written + j] = static_cast<char8_t>(source[i + j]); } written += 16; i += 16; continue; }
+			}
+
+			const uint8 length = EncodeUTF8(source[i], destination + written);
+			if (!length) { return Result(MoveRef(written), false); }
+			written += length; ++i;
+		}
+
+		return Result(MoveRef(written), true);
+	}
+
+	/**
+	 * \brief Converts UTF-16 to UTF-32, validating surrogate pairs.
+	 * \param destination Must have room for count code points, the worst case.
+	 * \return Number of code points written, fails at the first unpaired surrogate.
+	 */
+	inline Result<uint32> UTF16ToUTF32(const char16_t* source, const uint32 count, char32_t* destination) {
+		uint32 written = 0;
+
+		for (uint32 i = 0; i < count; ++i) {
+			const char32_t unit = source[i];
+
+			if ((unit >> 11) != 0x1B) { destination[written++] = unit; continue; }
+
+			if ((unit >> 10) != 0x36 || i + 1 >= count || (source[i + 1] >> 10) != 0x37) { return Result(MoveRef(written), false); }
+			destination[written++] = 0x10000 + ((unit - 0xD800) << 10) + (source[i + 1] - 0xDC00); ++i;
+		}
+
+		return Result(MoveRef(written), true);
+	}
+
+	/**
+	 * \brief Converts UTF-32 to UTF-16, code points above U+FFFF become surrogate pairs.
+	 * \param destination Must have room for 2 code units per code point, the worst case.
+	 * \return Number of code units written, fails at the first surrogate or code point above U+10FFFF.
+	 */
+	inline Result<uint32> UTF32ToUTF16(const char32_t* source, const uint32 count, char16_t* destination) {
+		uint32 written = 0;
+
+		for (uint32 i = 0; i < count; ++i) {
+			const uint32 codePoint = source[i];
+
+			if ((codePoint >> 11) == 0x1B || codePoint > 0x10FFFF) { return Result(MoveRef(written), false); }
+
+			if (codePoint < 0x10000) { destination[written++] = static_cast<char16_t>(codePoint); continue; }
+			destination[written++] = static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10)); destination[written++] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+		}
+
+		return Result(MoveRef(written), true);
+	}
+}
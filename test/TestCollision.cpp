@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include "GTSL/Math/Collision.hpp"
+#include "GTSL/Math/BVH.hpp"
+#include "GTSL/Math/SpatialHashGrid.hpp"
 
 struct SupportSphere {
 
@@ -24,4 +26,313 @@ TEST(GJK, NoIntersection) {
 TEST(GJK, Intersection) {
 	SupportSphere a({ 0.5f, -0.5, 0.1f }, 1), b({ 0.3f, 0.0f, 0.2f }, 1);
 	EXPECT_TRUE(GTSL::GJK(a, b));
-}
\ No newline at end of file
+}
+TEST(Collision, BatchCulling) {
+	GTSL::Frustum frustum; // box [-10, 10]^3 with inward normals, front plane slanted
+	auto setPlane = [](GTSL::Plane& plane, const GTSL::Vector3 normal, const GTSL::float32 d) { plane.Normal = normal; plane.D = d; };
+	setPlane(frustum.GetTopPlane(), { 0, -1, 0 }, -10); setPlane(frustum.GetBottomPlane(), { 0, 1, 0 }, -10);
+	setPlane(frustum.GetRightPlane(), { -1, 0, 0 }, -10); setPlane(frustum.GetLeftPlane(), { 1, 0, 0 }, -10);
+	setPlane(frustum.GetFrontPlane(), { 0.6f, 0, 0.8f }, -6); setPlane(frustum.GetBackPlane(), { 0, 0, -1 }, -10);
+
+	constexpr GTSL::uint32 COUNT = 1003, OFFSET = 3; // odd count and offset to exercise unaligned loads and the padded tail
+	GTSL::float32 data[6][COUNT + OFFSET];
+
+	GTSL::Math::RandomSeed seed(12345);
+	auto random = [&](const GTSL::float32 min, const GTSL::float32 max) { return seed.Float32(min, max); };
+
+	for (GTSL::uint32 i = 0; i < COUNT + OFFSET; ++i) {
+		for (GTSL::uint32 c = 0; c < 3; ++c) { data[c][i] = random(-20, 20); data[c + 3][i] = random(0, 4); }
+	}
+
+	GTSL::MultiRange<const GTSL::float32, const GTSL::float32, const GTSL::float32, const GTSL::float32> spheres(COUNT, data[0] + OFFSET, data[1] + OFFSET, data[2] + OFFSET, data[3] + OFFSET);
+	GTSL::MultiRange<const GTSL::float32, const GTSL::float32, const GTSL::float32, const GTSL::float32, const GTSL::float32, const GTSL::float32> boxes(COUNT, data[0] + OFFSET, data[1] + OFFSET, data[2] + OFFSET, data[3] + OFFSET, data[4] + OFFSET, data[5] + OFFSET);
+
+	auto distance = [&](const GTSL::uint32 p, const GTSL::uint32 i) {
+		const auto& plane = frustum.GetPlanes()[p];
+		return plane.Normal.X() * data[0][i + OFFSET] + plane.Normal.Y() * data[1][i + OFFSET] + plane.Normal.Z() * data[2][i + OFFSET] - plane.D;
+	};
+
+	auto sphereVisible = [&](const GTSL::uint32 i) {
+		for (GTSL::uint32 p = 0; p < 6; ++p) { if (distance(p, i) < -data[3][i + OFFSET]) { return false; } }
+		return true;
+	};
+
+	auto boxVisible = [&](const GTSL::uint32 i) {
+		for (GTSL::uint32 p = 0; p < 6; ++p) {
+			const auto& n = frustum.GetPlanes()[p].Normal;
+			const auto radius = GTSL::Math::Abs(n.X()) * data[3][i + OFFSET] + GTSL::Math::Abs(n.Y()) * data[4][i + OFFSET] + GTSL::Math::Abs(n.Z()) * data[5][i + OFFSET];
+			if (distance(p, i) < -radius) { return false; }
+		}
+		return true;
+	};
+
+	const GTSL::Vector3 queryCenter(2, -3, 1), queryExtents(5, 4, 6);
+
+	auto boxOverlaps = [&](const GTSL::uint32 i) {
+		const GTSL::float32 center[3]{ queryCenter.X(), queryCenter.Y(), queryCenter.Z() }, extents[3]{ queryExtents.X(), queryExtents.Y(), queryExtents.Z() };
+		for (GTSL::uint32 c = 0; c < 3; ++c) { if (GTSL::Math::Abs(data[c][i + OFFSET] - center[c]) > data[c + 3][i + OFFSET] + extents[c]) { return false; } }
+		return true;
+	};
+
+	GTSL::uint32 indices[COUNT]; GTSL::uint8 mask[(COUNT + 7) / 8];
+
+	auto check = [&](auto&& reference, const GTSL::uint32 count) {
+		GTSL::uint32 expectedCount = 0;
+
+		for (GTSL::uint32 i = 0; i < COUNT; ++i) {
+			const bool expected = reference(i);
+			EXPECT_EQ(static_cast<bool>(mask[i / 8] & (1 << (i % 8))), expected) << i;
+			if (expected) { ASSERT_LT(expectedCount, count); EXPECT_EQ(indices[expectedCount], i); ++expectedCount; }
+		}
+
+		EXPECT_EQ(expectedCount, count);
+		EXPECT_EQ(mask[COUNT / 8] >> (COUNT % 8), 0);
+		EXPECT_GT(count, 0u); EXPECT_LT(count, COUNT); // data spans both sides of the planes
+	};
+
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::CullSpheres(frustum, spheres, mask);
+	check(sphereVisible, GTSL::CullSpheres(frustum, spheres, indices));
+
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::CullAABBs(frustum, boxes, mask);
+	check(boxVisible, GTSL::CullAABBs(frustum, boxes, indices));
+
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::OverlapAABBs(queryCenter, queryExtents, boxes, mask);
+	check(boxOverlaps, GTSL::OverlapAABBs(queryCenter, queryExtents, boxes, indices));
+
+	// the fallbacks dispatched to on CPUs without AVX2 must give the same answers
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::cullSpheresScalar(frustum, spheres, mask);
+	check(sphereVisible, GTSL::cullSpheresScalar(frustum, spheres, indices));
+
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::cullAABBsScalar(frustum, boxes, mask);
+	check(boxVisible, GTSL::cullAABBsScalar(frustum, boxes, indices));
+
+	for (auto& byte : mask) { byte = 0xFF; }
+	GTSL::overlapAABBsScalar(queryCenter, queryExtents, boxes, mask);
+	check(boxOverlaps, GTSL::overlapAABBsScalar(queryCenter, queryExtents, boxes, indices));
+}
+
+TEST(BVH, Queries) {
+	constexpr GTSL::uint32 COUNT = 3000; // enough for the parallel build to split in tasks
+
+	GTSL::Math::RandomSeed seed(777);
+	auto random = [&](const GTSL::float32 min, const GTSL::float32 max) { return seed.Float32(min, max); };
+	auto randomBox = [&]() { const GTSL::Vector3 center(random(-100, 100), random(-100, 100), random(-100, 100)), extents(random(0, 2), random(0, 2), random(0, 2)); return GTSL::AABB(center - extents, center + extents); };
+
+	GTSL::Vector<GTSL::AABB, GTSL::DefaultAllocatorReference> boxes(COUNT);
+	for (GTSL::uint32 i = 0; i < COUNT; ++i) { boxes.EmplaceBack(randomBox()); }
+
+	auto rayBox = [](const GTSL::AABB& box, const GTSL::Vector3 origin, const GTSL::Vector3 direction, const GTSL::float32 maxDistance) {
+		GTSL::float32 near = 0.0f, far = maxDistance;
+		for (GTSL::uint8 a = 0; a < 3; ++a) {
+			const GTSL::float32 t0 = (box.Min[a] - origin[a]) / direction[a], t1 = (box.Max[a] - origin[a]) / direction[a];
+			near = GTSL::Math::Max(near, GTSL::Math::Min(t0, t1)); far = GTSL::Math::Min(far, GTSL::Math::Max(t0, t1));
+		}
+		return near <= far ? near : GTSL::FLOAT_MAX;
+	};
+
+	auto boxDistanceSquared = [](const GTSL::AABB& box, const GTSL::Vector3 point) {
+		GTSL::float32 distance = 0.0f;
+		for (GTSL::uint8 a = 0; a < 3; ++a) { const GTSL::float32 d = GTSL::Math::Max(GTSL::Math::Max(box.Min[a] - point[a], point[a] - box.Max[a]), 0.0f); distance += d * d; }
+		return distance;
+	};
+
+	auto check = [&](const GTSL::BVH<>& bvh) {
+		for (GTSL::uint32 q = 0; q < 32; ++q) {
+			const auto query = randomBox(); GTSL::AABB grown(query.Min - 8.0f, query.Max + 8.0f);
+
+			GTSL::uint32 expected = 0, found = 0;
+			for (const auto& box : boxes) { expected += box.Overlaps(grown); }
+			EXPECT_EQ(bvh.Overlap(grown, [&](const GTSL::uint32 primitive) { EXPECT_TRUE(boxes[primitive].Overlaps(grown)); ++found; }), expected);
+			EXPECT_EQ(found, expected);
+
+			const GTSL::Vector3 origin(random(-120, 120), random(-120, 120), random(-120, 120)), direction(random(-1, 1), random(-1, 1), random(-1, 1));
+			GTSL::float32 closestDistance = GTSL::FLOAT_MAX;
+			for (const auto& box : boxes) { closestDistance = GTSL::Math::Min(closestDistance, rayBox(box, origin, direction, 1000.0f)); }
+
+			const auto hit = bvh.Raycast(origin, direction, 1000.0f, [&](const GTSL::uint32 primitive, const GTSL::float32) { return rayBox(boxes[primitive], origin, direction, 1000.0f); });
+			EXPECT_EQ(static_cast<bool>(hit), closestDistance != GTSL::FLOAT_MAX);
+			if (hit) { EXPECT_FLOAT_EQ(hit.Distance, closestDistance); }
+
+			GTSL::float32 closestSquared = GTSL::FLOAT_MAX;
+			for (const auto& box : boxes) { closestSquared = GTSL::Math::Min(closestSquared, boxDistanceSquared(box, origin)); }
+
+			const auto closest = bvh.FindClosest(origin, [&](const GTSL::uint32 primitive, const GTSL::float32) { return boxDistanceSquared(boxes[primitive], origin); });
+			ASSERT_TRUE(closest);
+			EXPECT_FLOAT_EQ(closest.DistanceSquared, closestSquared);
+		}
+
+		GTSL::uint32 expectedPairs = 0;
+		for (GTSL::uint32 a = 0; a < COUNT; ++a) { for (GTSL::uint32 b = a + 1; b < COUNT; ++b) { expectedPairs += boxes[a].Overlaps(boxes[b]); } }
+		EXPECT_EQ(bvh.FindOverlappingPairs([&](const GTSL::uint32 a, const GTSL::uint32 b) { EXPECT_LT(a, b); EXPECT_TRUE(boxes[a].Overlaps(boxes[b])); }), expectedPairs);
+	};
+
+	GTSL::BVH<> serial; serial.Build(boxes);
+	EXPECT_EQ(serial.GetPrimitiveCount(), COUNT);
+	check(serial);
+
+	GTSL::BVH<> parallel; parallel.Build(boxes, 4);
+	check(parallel);
+
+	for (GTSL::uint32 i = 0; i < COUNT; i += 7) { boxes[i] = randomBox(); parallel.SetBounds(i, boxes[i]); } // incremental refit
+	check(parallel);
+
+	for (auto& box : boxes) { box = randomBox(); }
+	serial.Refit(boxes);
+	check(serial);
+
+	GTSL::BVH<> single; single.Build(GTSL::Range<const GTSL::AABB*>(1u, boxes.begin()));
+	EXPECT_EQ(single.Overlap(boxes[0], [](GTSL::uint32) {}), 1u);
+
+	GTSL::BVH<> empty; empty.Build(GTSL::Range<const GTSL::AABB*>(boxes.begin(), boxes.begin()));
+	EXPECT_FALSE(empty.Raycast({ 0, 0, 0 }, { 1, 0, 0 }, 100.0f, [](GTSL::uint32, const GTSL::float32 d) { return d; }));
+
+	// exponentially spaced boxes make the surface area heuristic peel one primitive per level, the build has to fall back to halving
+	GTSL::Vector<GTSL::AABB, GTSL::DefaultAllocatorReference> chain(800);
+	GTSL::float32 position = 1.0f;
+	for (GTSL::uint32 i = 0; i < 800; ++i, position *= 1.1f) { chain.EmplaceBack(GTSL::Vector3(position, 0, 0), GTSL::Vector3(position, 1, 1)); }
+
+	GTSL::BVH<> deep; deep.Build(chain);
+	EXPECT_EQ(deep.Overlap(GTSL::AABB(GTSL::Vector3(0, -1, -1), GTSL::Vector3(GTSL::FLOAT_MAX, 2, 2)), [](GTSL::uint32) {}), 800u);
+	EXPECT_EQ(deep.Raycast({ 0, 0.5f, 0.5f }, { 1, 0, 0 }, GTSL::FLOAT_MAX, [](GTSL::uint32, const GTSL::float32 d) { return d; }).Primitive, 0u);
+}
+
+struct SupportBox {
+	SupportBox(const GTSL::Vector3 pos, const GTSL::Vector3 halfSize) : position(pos), halfSize(halfSize) {}
+
+	auto GetPosition() const { return position; }
+
+	auto GetSupportPointInDirection(const GTSL::Vector3 dir) const {
+		return position + GTSL::Vector3(dir.X() >= 0 ? halfSize.X() : -halfSize.X(), dir.Y() >= 0 ? halfSize.Y() : -halfSize.Y(), dir.Z() >= 0 ? halfSize.Z() : -halfSize.Z());
+	}
+
+	GTSL::Vector3 position, halfSize;
+};
+
+TEST(GJK, WarmStartedEPA) {
+	GTSL::CollisionScratch scratch;
+
+	SupportSphere a({ 0, 0, 0 }, 1), b({ 1.5f, 0, 0 }, 1); // aligned centers, GJK ends on a segment through the origin which EPA has to grow into a tetrahedron
+	GTSL::ContactManifold manifold;
+
+	ASSERT_TRUE(GTSL::Collide(a, b, manifold, scratch));
+	EXPECT_NEAR(manifold.Normal.X(), 1.0f, 1e-2f); EXPECT_NEAR(manifold.Normal.Y(), 0.0f, 1e-2f); EXPECT_NEAR(manifold.Normal.Z(), 0.0f, 1e-2f);
+	ASSERT_EQ(manifold.PointCount, 1);
+	EXPECT_NEAR(manifold.Points[0].Depth, 0.5f, 1e-2f);
+	EXPECT_NEAR(manifold.Points[0].PositionA.X(), 1.0f, 1e-2f); EXPECT_NEAR(manifold.Points[0].PositionB.X(), 0.5f, 1e-2f);
+
+	b.position = GTSL::Vector3(1.4f, 0.3f, -0.2f);
+	ASSERT_TRUE(GTSL::Collide(a, b, manifold, scratch));
+	EXPECT_NEAR(manifold.Points[0].Depth, 2.0f - GTSL::Math::SquareRoot(1.4f * 1.4f + 0.3f * 0.3f + 0.2f * 0.2f), 1e-2f);
+	EXPECT_EQ(manifold.Cache.Count, 4);
+
+	GTSL::GJKSimplex simplex;
+	EXPECT_TRUE(GTSL::GJK(a, b, manifold.Cache, simplex)); // warm started from the cached simplex
+	EXPECT_EQ(simplex.Count, 4);
+
+	b.position = GTSL::Vector3(1.5f, 0, 0); manifold = GTSL::ContactManifold();
+	ASSERT_TRUE(GTSL::Collide(a, b, manifold, scratch));
+
+	b.position = GTSL::Vector3(1.45f, 0, 0); // small move keeps the point, merged with the new one
+	ASSERT_TRUE(GTSL::Collide(a, b, manifold, scratch));
+	EXPECT_EQ(manifold.PointCount, 1);
+	EXPECT_NEAR(manifold.Points[0].Depth, 0.55f, 1e-2f);
+
+	b.position = GTSL::Vector3(3.0f, 0, 0);
+	EXPECT_FALSE(GTSL::Collide(a, b, manifold, scratch));
+	EXPECT_EQ(manifold.PointCount, 0);
+	EXPECT_EQ(manifold.Cache.Count, 1); // separating direction
+	EXPECT_FALSE(GTSL::GJK(a, b, manifold.Cache));
+
+	SupportBox boxA({ 0, 0, 0 }, { 1, 1, 1 }), boxB({ 0.3f, 1.9f, -0.2f }, { 1, 1, 1 });
+	GTSL::ContactManifold boxManifold;
+	ASSERT_TRUE(GTSL::Collide(boxA, boxB, boxManifold, scratch));
+	EXPECT_NEAR(boxManifold.Normal.Y(), 1.0f, 1e-3f);
+	EXPECT_NEAR(boxManifold.Points[0].Depth, 0.1f, 1e-3f);
+
+	SupportBox apart({ 2.01f, 0, 0 }, { 1, 1, 1 }); GTSL::GJKCache cache;
+	EXPECT_FALSE(GTSL::GJK(boxA, apart, cache));
+
+	GTSL::Pair<GTSL::uint32, GTSL::uint32> pairs[] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+	SupportSphere spheres[] = { { { 0, 0, 0 }, 1 }, { { 0, 1.8f, 0 }, 1 }, { { 5, 0, 0 }, 1 } };
+	GTSL::ContactManifold manifolds[3];
+	EXPECT_EQ(GTSL::Collide(GTSL::Range<const GTSL::Pair<GTSL::uint32, GTSL::uint32>*>(3, pairs), [&](const GTSL::uint32 i) -> SupportSphere& { return spheres[i]; }, GTSL::Range<GTSL::ContactManifold*>(3, manifolds), scratch), 1u);
+	EXPECT_EQ(manifolds[0].PointCount, 1); EXPECT_EQ(manifolds[1].PointCount, 0); EXPECT_EQ(manifolds[2].PointCount, 0);
+	EXPECT_NEAR(manifolds[0].Points[0].Depth, 0.2f, 1e-2f);
+}
+
+TEST(GJK, ManifoldReduction) {
+	GTSL::ContactManifold manifold; manifold.Normal = GTSL::Vector3(0, 1, 0);
+
+	auto point = [](const GTSL::float32 x, const GTSL::float32 z, const GTSL::float32 depth) {
+		GTSL::ContactPoint contact; contact.PositionA = GTSL::Vector3(x, 0, z); contact.PositionB = GTSL::Vector3(x, -depth, z); contact.Depth = depth;
+		contact.LocalA = contact.PositionA; contact.LocalB = contact.PositionB;
+		return contact;
+	};
+
+	manifold.AddPoint(point(-1, -1, 0.1f), 0.02f); manifold.AddPoint(point(1, -1, 0.1f), 0.02f); manifold.AddPoint(point(0, 0, 0.15f), 0.02f); manifold.AddPoint(point(1, 1, 0.1f), 0.02f);
+	manifold.AddPoint(point(1.005f, 1, 0.12f), 0.02f); // merges with the previous one
+	EXPECT_EQ(manifold.PointCount, 4);
+
+	manifold.AddPoint(point(-1, 1, 0.2f), 0.02f); // deepest, the center point spans the least area and is dropped
+	ASSERT_EQ(manifold.PointCount, 4);
+	for (GTSL::uint8 i = 0; i < manifold.PointCount; ++i) { EXPECT_NE(manifold.Points[i].PositionA.X(), 0.0f); }
+
+	manifold.Refresh(GTSL::Vector3(0, 0, 0), GTSL::Vector3(0, 0, 0), 0.02f);
+	EXPECT_EQ(manifold.PointCount, 4);
+	manifold.Refresh(GTSL::Vector3(0, 0, 0), GTSL::Vector3(0.5f, 0, 0), 0.02f); // B slid away, every point breaks
+	EXPECT_EQ(manifold.PointCount, 0);
+}
+
+TEST(SpatialHashGrid, Queries) {
+	constexpr GTSL::uint32 COUNT = 4000;
+
+	GTSL::Math::RandomSeed seed(4242);
+	auto random = [&](const GTSL::float32 min, const GTSL::float32 max) { return seed.Float32(min, max); };
+
+	GTSL::float32 xs[COUNT], ys[COUNT], zs[COUNT];
+	for (GTSL::uint32 i = 0; i < COUNT; ++i) { xs[i] = random(-50, 50); ys[i] = random(-50, 50); zs[i] = random(-5, 5); }
+
+	GTSL::MultiRange<const GTSL::float32, const GTSL::float32, const GTSL::float32> points(COUNT, xs, ys, zs);
+
+	auto check = [&](const GTSL::SpatialHashGrid<>& grid) {
+		EXPECT_EQ(grid.GetPointCount(), COUNT);
+
+		for (GTSL::uint32 q = 0; q < 16; ++q) {
+			const GTSL::Vector3 center(random(-55, 55), random(-55, 55), random(-6, 6)); const GTSL::float32 radius = random(0.5f, 8.0f);
+
+			GTSL::uint32 expected = 0;
+			for (GTSL::uint32 i = 0; i < COUNT; ++i) { expected += (xs[i] - center.X()) * (xs[i] - center.X()) + (ys[i] - center.Y()) * (ys[i] - center.Y()) + (zs[i] - center.Z()) * (zs[i] - center.Z()) <= radius * radius; }
+
+			bool seen[COUNT]{};
+			EXPECT_EQ(grid.QueryRadius(center, radius, [&](const GTSL::uint32 i) { EXPECT_FALSE(seen[i]); seen[i] = true; }), expected);
+
+			const GTSL::AABB box(center - radius, center + GTSL::Vector3(radius * 2, radius, radius));
+			expected = 0;
+			for (GTSL::uint32 i = 0; i < COUNT; ++i) { expected += box.Overlaps(GTSL::AABB({ xs[i], ys[i], zs[i] }, { xs[i], ys[i], zs[i] })); }
+			EXPECT_EQ(grid.QueryAABB(box, [](GTSL::uint32) {}), expected);
+		}
+
+		EXPECT_EQ(grid.QueryRadius({ 0, 0, 0 }, 1000.0f, [](GTSL::uint32) {}), COUNT); // more cells than buckets
+
+		GTSL::uint32 expectedPairs = 0;
+		for (GTSL::uint32 a = 0; a < COUNT; ++a) {
+			for (GTSL::uint32 b = a + 1; b < COUNT; ++b) { expectedPairs += (xs[a] - xs[b]) * (xs[a] - xs[b]) + (ys[a] - ys[b]) * (ys[a] - ys[b]) + (zs[a] - zs[b]) * (zs[a] - zs[b]) <= 1.5f * 1.5f; }
+		}
+		EXPECT_EQ(grid.ForEachNeighborPair(1.5f, [](const GTSL::uint32 a, const GTSL::uint32 b) { EXPECT_LT(a, b); }), expectedPairs);
+	};
+
+	GTSL::SpatialHashGrid<> grid(2.0f);
+	grid.Build(points);
+	check(grid);
+
+	for (GTSL::uint32 i = 0; i < COUNT; ++i) { xs[i] += random(-1, 1); ys[i] += random(-1, 1); } // next tick
+	grid.Build(points, 4);
+	check(grid);
+
+	EXPECT_EQ(grid.GetCell({ -0.5f, 1.0f, 4.1f }).X, -1); EXPECT_EQ(grid.GetCell({ -0.5f, 1.0f, 4.1f }).Y, 0); EXPECT_EQ(grid.GetCell({ -0.5f, 1.0f, 4.1f }).Z, 2);
+}
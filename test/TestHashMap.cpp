@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "GTSL/HashMap.hpp"
+#include "GTSL/PerfectHash.hpp"
 #include "GTSL/Vector.hpp"
 
 TEST(HashMap, Construct) {
@@ -128,6 +129,21 @@ TEST(HashMap, EmplaceOrUpdate) {
 	GTEST_ASSERT_FALSE(c2); GTEST_ASSERT_EQ(c2.Get(), 2);
 }
 
+TEST(HashMap, AlignedKeys) {
+	GTSL::HashMap<GTSL::uint64, GTSL::uint64, GTSL::DefaultAllocatorReference> hashMap(2);
+
+	for (GTSL::uint64 i = 0; i < 4096; ++i) { // keys sharing their low bits, like aligned pointers, must still spread over buckets
+		hashMap.Emplace(i << 16, i);
+	}
+
+	for (GTSL::uint64 i = 0; i < 4096; ++i) {
+		ASSERT_TRUE(hashMap.Find(i << 16));
+		GTEST_ASSERT_EQ(hashMap[i << 16], i);
+	}
+
+	ASSERT_FALSE(hashMap.Find(1));
+}
+
 TEST(KeyMap, Construct) {
 	GTSL::KeyMap<GTSL::uint64, GTSL::DefaultAllocatorReference> keyMap(4);
 }
@@ -148,4 +164,60 @@ TEST(KeyMap, FindAndResize) {
 	for (GTSL::uint32 i = 0; i < 1025; ++i) {
 		ASSERT_TRUE(keyMap.Find(i));
 	}
-}
\ No newline at end of file
+}
+
+TEST(KeyMap, AlignedKeys) {
+	GTSL::KeyMap<GTSL::uint64, GTSL::DefaultAllocatorReference> keyMap(2);
+
+	for (GTSL::uint64 i = 0; i < 4096; ++i) { keyMap.Emplace(i << 16); }
+	for (GTSL::uint64 i = 0; i < 4096; ++i) { ASSERT_TRUE(keyMap.Find(i << 16)); }
+}
+
+TEST(PerfectHash, Strings) {
+	constexpr GTSL::PerfectHashTable KEYWORDS({ u8"LUT_3D_SIZE", u8"DOMAIN_MIN", u8"DOMAIN_MAX", u8"TITLE", u8"LUT_1D_SIZE", u8"LUT_3D_INPUT_RANGE" });
+
+	static_assert(KEYWORDS.Find(u8"DOMAIN_MAX").Get() == 2 && KEYWORDS.Find(u8"DOMAIN_MAX").State());
+	static_assert(!KEYWORDS.Find(u8"DOMAIN_MID").State());
+
+	const GTSL::StringView keys[] = { u8"LUT_3D_SIZE", u8"DOMAIN_MIN", u8"DOMAIN_MAX", u8"TITLE", u8"LUT_1D_SIZE", u8"LUT_3D_INPUT_RANGE" };
+	for (GTSL::uint32 i = 0; i < 6; ++i) {
+		const auto found = KEYWORDS.Find(keys[i]);
+		ASSERT_TRUE(found.State()); GTEST_ASSERT_EQ(found.Get(), i);
+	}
+
+	ASSERT_FALSE(KEYWORDS.Find(u8"").State());
+	ASSERT_FALSE(KEYWORDS.Find(u8"LUT_3D").State());
+}
+
+TEST(PerfectHash, Integers) {
+	constexpr GTSL::uint32 KEYS[] = { 0, 1, 2, 3, 4096, 8192, 1u << 31, 0xFFFFFFFF, 77, 78, 79, 80, 81, 82, 83, 84, 100000, 65536, 65537, 12 };
+	constexpr GTSL::PerfectHashTable TABLE({ 0u, 1u, 2u, 3u, 4096u, 8192u, 1u << 31, 0xFFFFFFFFu, 77u, 78u, 79u, 80u, 81u, 82u, 83u, 84u, 100000u, 65536u, 65537u, 12u });
+
+	bool seen[20] = {};
+	for (GTSL::uint32 i = 0; i < 20; ++i) {
+		const auto found = TABLE.Find(KEYS[i]);
+		ASSERT_TRUE(found.State()); GTEST_ASSERT_EQ(found.Get(), i);
+		ASSERT_FALSE(seen[found.Get()]); seen[found.Get()] = true;
+	}
+
+	for (GTSL::uint32 i = 13; i < 77; ++i) { ASSERT_FALSE(TABLE.Find(i).State()); }
+}
+
+TEST(PerfectHash, EnumMapping) {
+	enum class Format : GTSL::uint8 { RGBA8 = 3, RGB8 = 7, R16F = 12 };
+
+	constexpr GTSL::PerfectHashMap FROM_NAME({ u8"RGBA8", u8"RGB8", u8"R16F" }, { Format::RGBA8, Format::RGB8, Format::R16F });
+	constexpr GTSL::PerfectHashMap<GTSL::StringView, 3> TO_NAME({ Format::RGBA8, Format::RGB8, Format::R16F }, { u8"RGBA8", u8"RGB8", u8"R16F" });
+
+	static_assert(FROM_NAME.TryGet(u8"RGB8").Get() == Format::RGB8);
+	static_assert(!FROM_NAME.TryGet(u8"RGB16").State());
+
+	for (const auto format : { Format::RGBA8, Format::RGB8, Format::R16F }) {
+		const auto name = TO_NAME.TryGet(format);
+		ASSERT_TRUE(name.State());
+		const auto back = FROM_NAME.TryGet(name.Get());
+		ASSERT_TRUE(back.State()); ASSERT_EQ(back.Get(), format);
+	}
+
+	ASSERT_FALSE(TO_NAME.TryGet(static_cast<Format>(4)).State());
+}
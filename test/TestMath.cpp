@@ -2,6 +2,13 @@
 
 #include "GTSL/Vector.hpp"
 #include "GTSL/Math/Math.hpp"
+#include "GTSL/Math/VectorMath.hpp"
+#include "GTSL/Math/Quantization.hpp"
+#include "GTSL/Dispatch.hpp"
+#include "GTSL/Time.h"
+
+#include <string>
+#include <limits>
 
 using namespace GTSL;
 
@@ -254,6 +261,103 @@ TEST(Math, MatrixInvert) {
 	EXPECT_FLOAT_EQ(matrix[3][0], 23/169.f); EXPECT_FLOAT_EQ(matrix[3][1], 5/169.f); EXPECT_FLOAT_EQ(matrix[3][2], 5/169.f); EXPECT_FLOAT_EQ(matrix[3][3], -8/169.f);
 }
 
+static Matrix4 randomAffine(Math::RandomSeed& randomSeed) {
+	auto random = [&]() { return randomSeed.Float32(-1.0f, 1.0f); };
+
+	Matrix4 matrix(Math::Normalized(Quaternion(random(), random(), random(), random() + 2.0f)));
+	const float32 sx = random() + 2.0f, sy = random() + 2.0f, sz = random() + 2.0f;
+	for (uint32 r = 0; r < 3; ++r) { matrix[r][0] *= sx; matrix[r][1] *= sy; matrix[r][2] *= sz; }
+	matrix[0][1] += random() * 0.3f; // shear
+	Math::SetTranslation(matrix, Vector3(random() * 10.0f, random() * 10.0f, random() * 10.0f));
+	return matrix;
+}
+
+TEST(Math, AffineMatrices) {
+	constexpr uint32 COUNT = 37; // leaves a pair tail
+
+	Math::RandomSeed seed(777);
+	Matrix4 matrices[COUNT], inverses[COUNT]; Matrix3x4 transforms[COUNT], products[COUNT], transformInverses[COUNT];
+
+	for (uint32 i = 0; i < COUNT; ++i) { matrices[i] = randomAffine(seed); transforms[i] = Matrix3x4(matrices[i]); }
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const auto expected = Math::Inverse(matrices[i]), affine = Math::AffineInverse(matrices[i]);
+		const Matrix3x4 product = transforms[i] * transforms[(i + 1) % COUNT]; const Matrix4 expectedProduct = matrices[i] * matrices[(i + 1) % COUNT];
+		const auto identity = Matrix4(Math::Inverse(transforms[i]) * transforms[i]);
+
+		for (uint32 r = 0; r < 4; ++r) {
+			for (uint32 c = 0; c < 4; ++c) {
+				ASSERT_NEAR(affine[r][c], expected[r][c], 1e-4f);
+				ASSERT_NEAR(identity[r][c], r == c ? 1.0f : 0.0f, 1e-4f);
+				if (r < 3) { ASSERT_NEAR(product[r][c], expectedProduct[r][c], 1e-3f); }
+			}
+		}
+	}
+
+	Math::Inverse(Range<Matrix4*>(COUNT, inverses), Range<const Matrix4*>(COUNT, matrices));
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const auto expected = Math::Inverse(matrices[i]);
+		for (uint32 r = 0; r < 4; ++r) { for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(inverses[i][r][c], expected[r][c], 1e-5f); } }
+	}
+
+	Math::AffineInverse(Range<Matrix4*>(COUNT, inverses), Range<const Matrix4*>(COUNT, matrices));
+	Math::Inverse(Range<Matrix3x4*>(COUNT, transformInverses), Range<const Matrix3x4*>(COUNT, transforms));
+	Math::Multiply(Range<Matrix3x4*>(COUNT, products), Range<const Matrix3x4*>(COUNT, transforms), Range<const Matrix3x4*>(COUNT, transformInverses));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const auto expected = Math::AffineInverse(matrices[i]);
+		for (uint32 r = 0; r < 4; ++r) {
+			for (uint32 c = 0; c < 4; ++c) {
+				ASSERT_NEAR(inverses[i][r][c], expected[r][c], 1e-4f); // the batched and single paths only fuse the same products when both are built with FMA
+				if (r < 3) { ASSERT_NEAR(transformInverses[i][r][c], expected[r][c], 1e-4f); ASSERT_NEAR(products[i][r][c], r == c ? 1.0f : 0.0f, 1e-4f); }
+			}
+		}
+	}
+
+	const auto column = matrices[0].GetColumn(3); const auto row = transforms[0].GetRow(1);
+	EXPECT_EQ(column.X(), matrices[0][0][3]); EXPECT_EQ(column.Z(), matrices[0][2][3]); EXPECT_EQ(column.W(), 1.0f);
+	EXPECT_EQ(row.X(), transforms[0][1][0]); EXPECT_EQ(row.W(), transforms[0][1][3]);
+
+	Matrix3x4 transform(transforms[0]);
+	Math::SetRotation(transform, Quaternion(0, 0, 0, 1));
+	EXPECT_EQ(transform[0][0], 1.0f); EXPECT_EQ(transform[0][1], 0.0f); EXPECT_EQ(transform[1][1], 1.0f);
+	EXPECT_EQ(Math::GetTranslation(transform).X(), Math::GetTranslation(matrices[0]).X());
+}
+
+/**
+ * \brief Times the batched matrix kernels against calling the single matrix versions in a loop, recording nanoseconds per matrix as test properties. Only checks results are sane.
+ * Disabled so timing noise stays out of the suite, run with --gtest_also_run_disabled_tests --gtest_output=xml to read the numbers.
+ */
+TEST(Math, DISABLED_MatrixKernelsBenchmark) {
+	constexpr uint32 COUNT = 1 << 14, ITERATIONS = 8;
+
+	Vector<Matrix4, DefaultAllocatorReference> matrices(COUNT, DefaultAllocatorReference()), results(COUNT, DefaultAllocatorReference());
+	Vector<Matrix3x4, DefaultAllocatorReference> transforms(COUNT, DefaultAllocatorReference()), transformResults(COUNT, DefaultAllocatorReference());
+
+	Math::RandomSeed seed(99);
+	for (uint32 i = 0; i < COUNT; ++i) { matrices.EmplaceBack(randomAffine(seed)); results.EmplaceBack(); transforms.EmplaceBack(matrices[i]); transformResults.EmplaceBack(); }
+
+	auto measure = [&](const char* name, auto&& function) {
+		const auto start = GetMonotonicTime();
+		for (uint32 i = 0; i < ITERATIONS; ++i) { function(); }
+		RecordProperty(name, std::to_string(static_cast<float64>((GetMonotonicTime() - start).GetCount()) / (COUNT * ITERATIONS)));
+	};
+
+	measure("Inverse(Matrix4)", [&]() { for (uint32 i = 0; i < COUNT; ++i) { results[i] = Math::Inverse(matrices[i]); } });
+	measure("Inverse(Range<Matrix4>)", [&]() { Math::Inverse(Range<Matrix4*>(COUNT, results.begin()), Range<const Matrix4*>(COUNT, matrices.begin())); });
+	measure("AffineInverse(Matrix4)", [&]() { for (uint32 i = 0; i < COUNT; ++i) { results[i] = Math::AffineInverse(matrices[i]); } });
+	measure("AffineInverse(Range<Matrix4>)", [&]() { Math::AffineInverse(Range<Matrix4*>(COUNT, results.begin()), Range<const Matrix4*>(COUNT, matrices.begin())); });
+	measure("Inverse(Matrix3x4)", [&]() { for (uint32 i = 0; i < COUNT; ++i) { transformResults[i] = Math::Inverse(transforms[i]); } });
+	measure("Inverse(Range<Matrix3x4>)", [&]() { Math::Inverse(Range<Matrix3x4*>(COUNT, transformResults.begin()), Range<const Matrix3x4*>(COUNT, transforms.begin())); });
+	measure("Matrix4 * Matrix4", [&]() { for (uint32 i = 0; i < COUNT; ++i) { results[i] = matrices[i] * matrices[i]; } });
+	measure("Multiply(Range<Matrix4>)", [&]() { Math::Multiply(Range<Matrix4*>(COUNT, results.begin()), Range<const Matrix4*>(COUNT, matrices.begin()), Range<const Matrix4*>(COUNT, matrices.begin())); });
+	measure("Matrix3x4 * Matrix3x4", [&]() { for (uint32 i = 0; i < COUNT; ++i) { transformResults[i] = transforms[i] * transforms[i]; } });
+	measure("Multiply(Range<Matrix3x4>)", [&]() { Math::Multiply(Range<Matrix3x4*>(COUNT, transformResults.begin()), Range<const Matrix3x4*>(COUNT, transforms.begin()), Range<const Matrix3x4*>(COUNT, transforms.begin())); });
+
+	const auto expected = matrices[COUNT - 1] * matrices[COUNT - 1];
+	EXPECT_NEAR(transformResults[COUNT - 1][2][3], expected[2][3], 1e-3f);
+}
+
 TEST(Math, QuaternionMultiply) {
 	{
 		Quaternion quaternionA(1, 0, 0, 0);
@@ -299,4 +403,423 @@ TEST(Math, DotProduct) {
 			ASSERT_FLOAT_EQ(res[i], xxxx[i] * 1.0f + yyyy[i] * 2.0f);
 		}
 	}
-}
\ No newline at end of file
+}
+TEST(Math, BatchTransforms) {
+	constexpr uint32 COUNT = 37; // leaves a tail which doesn't fill a whole vector
+
+	Math::RandomSeed seed(12345);
+	auto random = [&]() { return seed.Float32(-1.0f, 1.0f); };
+
+	float32 x[COUNT], y[COUNT], z[COUNT], rx[COUNT], ry[COUNT], rz[COUNT], sx[COUNT], sy[COUNT], sz[COUNT];
+	float32 ax[COUNT], ay[COUNT], az[COUNT], aw[COUNT], bx[COUNT], by[COUNT], bz[COUNT], bw[COUNT], qx[COUNT], qy[COUNT], qz[COUNT], qw[COUNT];
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		x[i] = random() * 10.0f; y[i] = random() * 10.0f; z[i] = random() * 10.0f;
+		sx[i] = random() + 2.0f; sy[i] = random() + 2.0f; sz[i] = random() + 2.0f;
+		auto a = Math::Normalized(Quaternion(random(), random(), random(), random())), b = Math::Normalized(Quaternion(random(), random(), random(), random()));
+		ax[i] = a.X(); ay[i] = a.Y(); az[i] = a.Z(); aw[i] = a.W(); bx[i] = b.X(); by[i] = b.Y(); bz[i] = b.Z(); bw[i] = b.W();
+	}
+
+	Matrix4 matrix(Quaternion(ax[0], ay[0], az[0], aw[0])); matrix[0][3] = 3.0f; matrix[1][3] = -2.0f; matrix[2][3] = 1.0f;
+
+	Math::TransformPoints(MultiRange<float32, float32, float32>(COUNT, rx, ry, rz), matrix, MultiRange<const float32, const float32, const float32>(COUNT, x, y, z));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const auto expected = matrix * Vector3(x[i], y[i], z[i]);
+		ASSERT_NEAR(rx[i], expected.X(), 1e-4f); ASSERT_NEAR(ry[i], expected.Y(), 1e-4f); ASSERT_NEAR(rz[i], expected.Z(), 1e-4f);
+	}
+
+	Matrix4 transforms[COUNT], products[COUNT];
+
+	Math::ComposeTransforms(Range<Matrix4*>(COUNT, transforms), MultiRange<const float32, const float32, const float32>(COUNT, x, y, z),
+		MultiRange<const float32, const float32, const float32, const float32>(COUNT, ax, ay, az, aw), MultiRange<const float32, const float32, const float32>(COUNT, sx, sy, sz));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const Vector3 point(1.0f, -2.0f, 0.5f);
+		const auto expected = Quaternion(ax[i], ay[i], az[i], aw[i]) * Vector3(point.X() * sx[i], point.Y() * sy[i], point.Z() * sz[i]) + Vector3(x[i], y[i], z[i]);
+		const auto result = transforms[i] * point;
+		ASSERT_NEAR(result.X(), expected.X(), 1e-4f); ASSERT_NEAR(result.Y(), expected.Y(), 1e-4f); ASSERT_NEAR(result.Z(), expected.Z(), 1e-4f);
+		ASSERT_EQ(transforms[i][3][0], 0.0f); ASSERT_EQ(transforms[i][3][3], 1.0f);
+	}
+
+	Math::Multiply(Range<Matrix4*>(COUNT, products), Range<const Matrix4*>(COUNT, transforms), Range<const Matrix4*>(COUNT, transforms));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		const auto expected = transforms[i] * transforms[i];
+		for (uint32 r = 0; r < 4; ++r) { for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(products[i][r][c], expected[r][c], 1e-3f); } }
+	}
+
+	for (const float32 alpha : { 0.0f, 0.3f, 0.5f, 1.0f }) {
+		Math::Slerp(MultiRange<float32, float32, float32, float32>(COUNT, qx, qy, qz, qw), MultiRange<const float32, const float32, const float32, const float32>(COUNT, ax, ay, az, aw),
+			MultiRange<const float32, const float32, const float32, const float32>(COUNT, bx, by, bz, bw), alpha);
+
+		for (uint32 i = 0; i < COUNT; ++i) {
+			const auto expected = Math::Slerp(Quaternion(ax[i], ay[i], az[i], aw[i]), Quaternion(bx[i], by[i], bz[i], bw[i]), alpha);
+			ASSERT_NEAR(qx[i], expected.X(), 1e-4f); ASSERT_NEAR(qy[i], expected.Y(), 1e-4f); ASSERT_NEAR(qz[i], expected.Z(), 1e-4f); ASSERT_NEAR(qw[i], expected.W(), 1e-4f);
+		}
+	}
+
+	x[3] = y[3] = z[3] = 0.0f;
+
+	Math::Normalize(MultiRange<float32, float32, float32>(COUNT, x, y, z));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		ASSERT_NEAR(Math::LengthSquared(Vector3(x[i], y[i], z[i])), i == 3 ? 0.0f : 1.0f, 1e-5f);
+	}
+
+	Math::Normalize(MultiRange<float32, float32, float32, float32>(COUNT, qx, qy, qz, qw));
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		ASSERT_NEAR(Math::LengthSquared(Vector4(qx[i], qy[i], qz[i], qw[i])), 1.0f, 1e-5f);
+	}
+}
+
+TEST(Math, BatchKernelsScalar) { // the fallbacks dispatched to on CPUs without AVX2 must agree with the vector kernels
+	constexpr uint32 COUNT = 13;
+
+	Math::RandomSeed seed(4242);
+	auto random = [&]() { return seed.Float32(-1.0f, 1.0f); };
+
+	alignas(32) float32 x[16], y[16], z[16], dots[2][16]; // DotProduct works on aligned arrays
+	float32 q[2][4][COUNT], vector[3][COUNT], scalar[3][COUNT], slerps[2][4][COUNT];
+	Matrix4 matrices[COUNT], vectorMatrices[COUNT], scalarMatrices[COUNT];
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		x[i] = random() * 10.0f; y[i] = random() * 10.0f; z[i] = random() * 10.0f; matrices[i] = randomAffine(seed);
+		for (uint32 s = 0; s < 2; ++s) {
+			const auto quaternion = Math::Normalized(Quaternion(random(), random(), random(), random()));
+			q[s][0][i] = quaternion.X(); q[s][1][i] = quaternion.Y(); q[s][2][i] = quaternion.Z(); q[s][3][i] = quaternion.W();
+		}
+	}
+
+	const MultiRange<const float32, const float32, const float32> points(COUNT, x, y, z);
+	const MultiRange<const float32, const float32, const float32, const float32> a(COUNT, q[0][0], q[0][1], q[0][2], q[0][3]), b(COUNT, q[1][0], q[1][1], q[1][2], q[1][3]);
+
+	Math::TransformPoints(MultiRange<float32, float32, float32>(COUNT, vector[0], vector[1], vector[2]), matrices[0], points);
+	Math::transformPointsScalar(MultiRange<float32, float32, float32>(COUNT, scalar[0], scalar[1], scalar[2]), matrices[0], points);
+	Math::DotProduct(dots[0], points, points); Math::dotProductScalar(dots[1], points, points);
+	Math::Slerp(MultiRange<float32, float32, float32, float32>(COUNT, slerps[0][0], slerps[0][1], slerps[0][2], slerps[0][3]), a, b, 0.3f);
+	Math::slerpScalar(MultiRange<float32, float32, float32, float32>(COUNT, slerps[1][0], slerps[1][1], slerps[1][2], slerps[1][3]), a, b, 0.3f);
+
+	for (uint32 i = 0; i < COUNT; ++i) {
+		for (uint32 c = 0; c < 3; ++c) { ASSERT_NEAR(vector[c][i], scalar[c][i], 1e-4f); }
+		ASSERT_NEAR(dots[0][i], dots[1][i], 1e-3f);
+		for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(slerps[0][c][i], slerps[1][c][i], 1e-5f); }
+	}
+
+	Math::Inverse(Range<Matrix4*>(COUNT, vectorMatrices), Range<const Matrix4*>(COUNT, matrices)); Math::inverseScalar(Range<Matrix4*>(COUNT, scalarMatrices), Range<const Matrix4*>(COUNT, matrices));
+	for (uint32 i = 0; i < COUNT; ++i) { for (uint32 r = 0; r < 4; ++r) { for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(vectorMatrices[i][r][c], scalarMatrices[i][r][c], 1e-5f); } } }
+
+	Math::AffineInverse(Range<Matrix4*>(COUNT, vectorMatrices), Range<const Matrix4*>(COUNT, matrices)); Math::affineInverseScalar(Range<Matrix4*>(COUNT, scalarMatrices), Range<const Matrix4*>(COUNT, matrices));
+	for (uint32 i = 0; i < COUNT; ++i) { for (uint32 r = 0; r < 4; ++r) { for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(vectorMatrices[i][r][c], scalarMatrices[i][r][c], 1e-4f); } } } // translations reach ~10, FMA contraction differs by an ulp
+
+	Math::ComposeTransforms(Range<Matrix4*>(COUNT, vectorMatrices), points, a, points); Math::composeTransformsScalar(Range<Matrix4*>(COUNT, scalarMatrices), points, a, points);
+	for (uint32 i = 0; i < COUNT; ++i) { for (uint32 r = 0; r < 4; ++r) { for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(vectorMatrices[i][r][c], scalarMatrices[i][r][c], 1e-4f); } } }
+
+	Math::normalizeScalar(MultiRange<float32, float32, float32>(COUNT, x, y, z));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_NEAR(Math::LengthSquared(Vector3(x[i], y[i], z[i])), 1.0f, 1e-5f); }
+}
+
+TEST(Math, HalfAndFixed) {
+	EXPECT_EQ(Math::float16(1.0f).halfFloat, 0x3C00); EXPECT_EQ(Math::float16(-2.0f).halfFloat, 0xC000);
+	EXPECT_EQ(Math::float16(65504.0f).halfFloat, 0x7BFF); EXPECT_EQ(Math::float16(65520.0f).halfFloat, 0x7C00); // max half, and the first value rounding to infinity
+	EXPECT_EQ(Math::float16(5.9604645e-8f).halfFloat, 0x0001); EXPECT_EQ(Math::float16(1e-9f).halfFloat, 0x0000); // smallest subnormal, underflow
+	EXPECT_EQ(Math::float16(1.0f + 1.0f / 2048.0f).halfFloat, 0x3C00); EXPECT_EQ(Math::float16(1.0f + 3.0f / 2048.0f).halfFloat, 0x3C02); // ties to even
+	EXPECT_EQ(Math::float16(std::numeric_limits<float32>::infinity()).halfFloat, 0x7C00);
+	EXPECT_NE(static_cast<float32>(Math::float16(std::numeric_limits<float32>::quiet_NaN())), static_cast<float32>(Math::float16(std::numeric_limits<float32>::quiet_NaN())));
+	EXPECT_EQ(static_cast<float32>(Math::float16::FromBits(0x0001)), 5.9604645e-8f); EXPECT_EQ(static_cast<float32>(Math::float16::FromBits(0xFBFF)), -65504.0f);
+
+	constexpr uint32 COUNT = 45;
+	float32 values[COUNT], results[COUNT]; Math::float16 halves[COUNT];
+	for (uint32 i = 0; i < COUNT; ++i) { values[i] = (static_cast<float32>(i) - 20.0f) * 1234.567f + 0.001f * i; }
+	values[3] = 1e-6f; values[4] = -70000.0f; values[5] = std::numeric_limits<float32>::infinity();
+
+	Math::ToHalf(Range<Math::float16*>(COUNT, halves), Range<const float32*>(COUNT, values));
+	Math::FromHalf(Range<float32*>(COUNT, results), Range<const Math::float16*>(COUNT, halves));
+	for (uint32 i = 0; i < COUNT; ++i) {
+		ASSERT_EQ(halves[i].halfFloat, Math::float16(values[i]).halfFloat) << i;
+		ASSERT_EQ(results[i], static_cast<float32>(halves[i])) << i;
+	}
+
+	using Q16_16 = Fixed<int32, 16>; using Q8_8 = Fixed<int16, 8>;
+	EXPECT_EQ(Q16_16(1.5f) * Q16_16(-2.25f), Q16_16(-3.375f)); EXPECT_EQ(Q16_16(1.0f) / Q16_16(4.0f), Q16_16(0.25f));
+	EXPECT_EQ((Q8_8(3.5f) + Q8_8(0.75f)).Value, 0x0440); EXPECT_EQ(Q8_8(-1.5f).GetInteger(), -2); EXPECT_EQ(Q8_8::FromInteger(7), Q8_8(7.0f));
+	EXPECT_EQ(Q8_8(1000.0f).Value, 32767); EXPECT_EQ(Q16_16(1e10f).Value, 2147483647); EXPECT_EQ(Q16_16(-1e10f).Value, -2147483647 - 1);
+	EXPECT_EQ(static_cast<float32>(Q16_16(0.1f)), 6554.0f / 65536.0f);
+
+	using UQ16_16 = Fixed<uint32, 16>; // products above 2^63 must not overflow, checked at compile time where it would be undefined
+	static_assert((UQ16_16::FromRaw(0xFFFFFFFFu) * UQ16_16::FromRaw(0xFFFFFFFFu)).Value == 0xFFFE0000u);
+	static_assert((UQ16_16::FromRaw(0xFFFF0000u) / UQ16_16::FromRaw(0x30000u)).Value == 0x55550000u);
+
+	Q16_16 wide[COUNT]; Q8_8 narrow[COUNT]; Fixed<uint16, 4> unsignedNarrow[COUNT];
+	values[6] = std::numeric_limits<float32>::quiet_NaN(); values[7] = 40000.0f; values[8] = -40000.0f;
+
+	Math::ToFixed(Range<Q16_16*>(COUNT, wide), Range<const float32*>(COUNT, values));
+	Math::ToFixed(Range<Q8_8*>(COUNT, narrow), Range<const float32*>(COUNT, values));
+	Math::ToFixed(Range<Fixed<uint16, 4>*>(COUNT, unsignedNarrow), Range<const float32*>(COUNT, values));
+	for (uint32 i = 0; i < COUNT; ++i) {
+		ASSERT_EQ(wide[i], Q16_16(values[i])) << i; ASSERT_EQ(narrow[i], Q8_8(values[i])) << i; ASSERT_EQ(unsignedNarrow[i], (Fixed<uint16, 4>(values[i]))) << i;
+	}
+
+	Math::FromFixed(Range<float32*>(COUNT, results), Range<const Q8_8*>(COUNT, narrow));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_EQ(results[i], static_cast<float32>(narrow[i])) << i; }
+	Math::FromFixed(Range<float32*>(COUNT, results), Range<const Q16_16*>(COUNT, wide));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_EQ(results[i], static_cast<float32>(wide[i])) << i; }
+}
+
+TEST(Math, Quantization) {
+	constexpr uint32 COUNT = 37;
+	float32 values[COUNT], results[COUNT]; uint8 bytes[COUNT]; int16 shorts[COUNT];
+	for (uint32 i = 0; i < COUNT; ++i) { values[i] = static_cast<float32>(i) / 17.0f - 1.05f; }
+	values[2] = std::numeric_limits<float32>::quiet_NaN();
+
+	Math::ToUnorm8(Range<uint8*>(COUNT, bytes), Range<const float32*>(COUNT, values));
+	Math::ToSnorm16(Range<int16*>(COUNT, shorts), Range<const float32*>(COUNT, values));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_EQ(bytes[i], Math::ToUnorm8(values[i])) << i; ASSERT_EQ(shorts[i], Math::ToSnorm16(values[i])) << i; }
+	EXPECT_EQ(Math::ToUnorm8(1.0f), 255); EXPECT_EQ(Math::ToUnorm8(-3.0f), 0); EXPECT_EQ(Math::ToSnorm16(-2.0f), -32767); EXPECT_EQ(Math::ToSnorm16(values[2]), 0);
+
+	Math::FromUnorm8(Range<float32*>(COUNT, results), Range<const uint8*>(COUNT, bytes));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_EQ(results[i], Math::FromUnorm8(bytes[i])) << i; }
+	Math::FromSnorm16(Range<float32*>(COUNT, results), Range<const int16*>(COUNT, shorts));
+	for (uint32 i = 0; i < COUNT; ++i) { ASSERT_EQ(results[i], Math::FromSnorm16(shorts[i])) << i; if (i != 2) { ASSERT_NEAR(results[i], Math::Clamp(values[i], -1.0f, 1.0f), 1.0f / 32767.0f); } }
+	EXPECT_EQ(Math::FromSnorm16(-32768), -1.0f);
+
+	const Vector3 min(-100.0f, 0.0f, -50.0f), max(100.0f, 20.0f, 50.0f);
+	const auto position = Math::Unpack(Math::Pack(Vector3(12.345f, 19.99f, -49.0f), min, max), min, max);
+	EXPECT_NEAR(position.X(), 12.345f, 200.0f / 65535.0f); EXPECT_NEAR(position.Y(), 19.99f, 20.0f / 65535.0f); EXPECT_NEAR(position.Z(), -49.0f, 100.0f / 65535.0f);
+	EXPECT_EQ(Math::Pack(Vector3(1000.0f, -1.0f, 0.0f), min, max).X, 65535); EXPECT_EQ(Math::Pack(Vector3(1000.0f, -1.0f, 0.0f), min, max).Y, 0);
+
+	Math::RandomSeed seed(4242);
+	auto random = [&]() { return seed.Float32(-1.0f, 1.0f); };
+
+	for (uint32 i = 0; i < 1000; ++i) {
+		Vector4 v(random(), random(), random(), random()); if (i == 0) { v = Vector4(0.0f, 0.0f, 0.0f, -1.0f); }
+		const float32 length = std::sqrt(v.X() * v.X() + v.Y() * v.Y() + v.Z() * v.Z() + v.W() * v.W());
+		const Quaternion quaternion(v.X() / length, v.Y() / length, v.Z() / length, v.W() / length);
+		const auto unpacked = Math::Unpack(Math::Pack(quaternion));
+
+		const float32 sign = quaternion[0] * unpacked[0] + quaternion[1] * unpacked[1] + quaternion[2] * unpacked[2] + quaternion[3] * unpacked[3] < 0.0f ? -1.0f : 1.0f;
+		for (uint32 c = 0; c < 4; ++c) { ASSERT_NEAR(unpacked[c] * sign, quaternion[c], 2e-3f) << i; }
+	}
+}
+
+static float32 ulpDistance(const float32 a, const float32 b) {
+	if (a == b) { return 0.0f; }
+	if (a != a || b != b) { return a != a && b != b ? 0.0f : 1e30f; }
+
+	auto ordered = [](const float32 f) { int32 i; memcpy(&i, &f, 4); return i < 0 ? static_cast<int64>(0x80000000) - i : static_cast<int64>(i); };
+	return static_cast<float32>(ordered(a) > ordered(b) ? ordered(a) - ordered(b) : ordered(b) - ordered(a));
+}
+
+/**
+ * \brief Samples function over [from, to] x [yFrom, yTo] and returns the largest ULP distance(ulps) or error, relative above 1 and absolute below(!ulps), against the libm reference.
+ */
+template<class V, typename F, typename R>
+static float32 measureError(F&& function, R&& reference, const float32 from, const float32 to, const float32 yFrom, const float32 yTo, const bool ulps) {
+	constexpr uint32 SAMPLES = 4096, Y_SAMPLES = 16;
+	float32 worst = 0.0f;
+
+	for (uint32 j = 0; j < Y_SAMPLES; ++j) {
+		const float32 y = yFrom + (yTo - yFrom) * static_cast<float32>(j) / (Y_SAMPLES - 1);
+
+		for (uint32 i = 0; i < SAMPLES; i += V::ElementCount) {
+			alignas(64) float32 xs[V::ElementCount], results[V::ElementCount];
+			for (uint32 l = 0; l < V::ElementCount; ++l) { xs[l] = from + (to - from) * static_cast<float32>(i + l) / (SAMPLES - 1); }
+
+			function(V(UnalignedPointer<const float32>(xs)), V(y)).CopyTo(UnalignedPointer<float32>(results));
+
+			for (uint32 l = 0; l < V::ElementCount; ++l) {
+				const float64 expected = reference(static_cast<float64>(xs[l]), static_cast<float64>(y));
+				const float32 error = ulps ? ulpDistance(results[l], static_cast<float32>(expected)) : static_cast<float32>(std::abs(results[l] - expected) / std::max(1.0, std::abs(expected)));
+				worst = std::max(worst, error);
+			}
+		}
+	}
+
+	return worst;
+}
+
+template<class V, Math::Accuracy ACCURACY>
+static void checkVectorMath(const float32 bound, const float32 arcTan2Bound) {
+	constexpr bool ULPS = ACCURACY == Math::Accuracy::STANDARD;
+
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Exp<ACCURACY>(x); }, [](float64 x, float64) { return std::exp(x); }, -87.0f, 88.0f, 0, 0, ULPS), bound) << "Exp";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Exp2<ACCURACY>(x); }, [](float64 x, float64) { return std::exp2(x); }, -125.0f, 127.0f, 0, 0, ULPS), bound) << "Exp2";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Log<ACCURACY>(x); }, [](float64 x, float64) { return std::log(x); }, 1e-30f, 1e4f, 0, 0, ULPS), bound) << "Log";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Log<ACCURACY>(x); }, [](float64 x, float64) { return std::log(x); }, 0.5f, 2.0f, 0, 0, ULPS), bound) << "Log near 1";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Log2<ACCURACY>(x); }, [](float64 x, float64) { return std::log2(x); }, 1e-30f, 1e4f, 0, 0, ULPS), bound) << "Log2";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::Log2<ACCURACY>(x); }, [](float64 x, float64) { return std::log2(x); }, 0.5f, 2.0f, 0, 0, ULPS), bound) << "Log2 near 1";
+	EXPECT_LE(measureError<V>([](V x, V y) { return Math::Power<ACCURACY>(x, y); }, [](float64 x, float64 y) { return std::pow(x, y); }, 0.01f, 100.0f, -8.0f, 8.0f, ULPS), bound) << "Power";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::ArcTangent<ACCURACY>(x); }, [](float64 x, float64) { return std::atan(x); }, -100.0f, 100.0f, 0, 0, ULPS), bound) << "ArcTangent";
+	EXPECT_LE(measureError<V>([](V x, V y) { return Math::ArcTan2<ACCURACY>(y, x); }, [](float64 x, float64 y) { return std::atan2(y, x); }, -10.0f, 10.0f, -10.0f, 10.0f, ULPS), arcTan2Bound) << "ArcTan2";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::ArcSine<ACCURACY>(x); }, [](float64 x, float64) { return std::asin(x); }, -1.0f, 1.0f, 0, 0, ULPS), bound) << "ArcSine";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::ArcCosine<ACCURACY>(x); }, [](float64 x, float64) { return std::acos(x); }, -1.0f, 1.0f, 0, 0, ULPS), bound) << "ArcCosine";
+	EXPECT_LE(measureError<V>([](V x, V) { V s, c; Math::SinCos<ACCURACY>(x, s, c); return s; }, [](float64 x, float64) { return std::sin(x); }, -100.0f, 100.0f, 0, 0, false), ULPS ? 1e-7f : 1e-3f) << "Sine";
+	EXPECT_LE(measureError<V>([](V x, V) { V s, c; Math::SinCos<ACCURACY>(x, s, c); return c; }, [](float64 x, float64) { return std::cos(x); }, -100.0f, 100.0f, 0, 0, false), ULPS ? 1e-7f : 1e-3f) << "Cosine";
+	EXPECT_LE(measureError<V>([](V x, V) { return Math::ReciprocalSquareRoot<ACCURACY>(x); }, [](float64 x, float64) { return 1.0 / std::sqrt(x); }, 1e-3f, 1e3f, 0, 0, ULPS), ULPS ? bound : 1e-3f) << "ReciprocalSquareRoot";
+}
+
+TEST(Math, VectorMath) {
+	checkVectorMath<SIMD<float32, 4>, Math::Accuracy::STANDARD>(2.0f, 3.0f);
+	checkVectorMath<SIMD<float32, 4>, Math::Accuracy::FAST>(1e-3f, 1e-3f);
+
+#if defined(__AVX2__) // the checks themselves aren't compiled for the wider targets, only run them when the baseline covers them
+	if (GetSIMDLevel() >= SIMDLevel::AVX2) {
+		checkVectorMath<SIMD<float32, 8>, Math::Accuracy::STANDARD>(2.0f, 3.0f);
+		checkVectorMath<SIMD<float32, 8>, Math::Accuracy::FAST>(1e-3f, 1e-3f);
+	}
+#endif
+
+#if defined(__AVX512F__)
+	if (GetSIMDLevel() >= SIMDLevel::AVX512) {
+		checkVectorMath<SIMD<float32, 16>, Math::Accuracy::STANDARD>(2.0f, 3.0f);
+		checkVectorMath<SIMD<float32, 16>, Math::Accuracy::FAST>(1e-3f, 1e-3f);
+	}
+#endif
+
+	{ // special values
+		const SIMD<float32, 4> x(0.0f, -1.0f, INFINITY, NAN);
+		alignas(16) float32 logs[4], exps[4];
+		Math::Log(x).CopyTo(AlignedPointer<float32, 16>(logs)); Math::Exp(SIMD<float32, 4>(-200.0f, 200.0f, -INFINITY, NAN)).CopyTo(AlignedPointer<float32, 16>(exps));
+
+		EXPECT_EQ(logs[0], -INFINITY); EXPECT_TRUE(std::isnan(logs[1])); EXPECT_EQ(logs[2], INFINITY); EXPECT_TRUE(std::isnan(logs[3]));
+		EXPECT_EQ(exps[0], 0.0f); EXPECT_EQ(exps[1], INFINITY); EXPECT_EQ(exps[2], 0.0f); EXPECT_TRUE(std::isnan(exps[3]));
+	}
+
+	{ // ranges starting at an unaligned address with a partial tail
+		alignas(64) float32 inputs[64], sines[64], cosines[64], logs[64];
+		for (uint32 i = 0; i < 64; ++i) { inputs[i] = static_cast<float32>(i) * 0.37f + 0.1f; }
+
+		Math::SinCos(Range<const float32*>(45, inputs + 3), Range<float32*>(45, sines + 1), Range<float32*>(45, cosines + 5));
+		Math::Log(Range<const float32*>(45, inputs + 3), Range<float32*>(45, logs + 2));
+
+		for (uint32 i = 0; i < 45; ++i) {
+			EXPECT_NEAR(sines[i + 1], std::sin(inputs[i + 3]), 1e-6f); EXPECT_NEAR(cosines[i + 5], std::cos(inputs[i + 3]), 1e-6f);
+			EXPECT_LE(ulpDistance(logs[i + 2], std::log(inputs[i + 3])), 2.0f);
+		}
+	}
+}
+
+// The 256 and 512 bit types are compiled for their own targets, so they are tested from functions compiled for them too.
+GTSL_TARGET_AVX2 static void checkUnsignedIntegers256() {
+	uint8 values[32];
+	for (uint8 i = 0; i < 32; ++i) { values[i] = static_cast<uint8>(i * 8); }
+	const SIMD<uint8, 32> a{ UnalignedPointer<const uint8>(values) };
+
+	GTEST_ASSERT_EQ((a >= SIMD<uint8, 32>(static_cast<uint8>(128))).BitMask(), 0xFFFF0000u);
+	GTEST_ASSERT_EQ((SIMD<uint8, 32>::AddSaturated(a, SIMD<uint8, 32>(static_cast<uint8>(200))).GetElement<31>()), 255);
+
+	uint16 wideValues[16];
+	for (uint16 i = 0; i < 16; ++i) { wideValues[i] = static_cast<uint16>(i * 4096); }
+	const SIMD<uint16, 16> b{ UnalignedPointer<const uint16>(wideValues) };
+
+	GTEST_ASSERT_EQ((b < SIMD<uint16, 16>(static_cast<uint16>(8192))).BitMask(), 0b11);
+	GTEST_ASSERT_EQ(b.BitMask(), 0xFF00);
+}
+
+TEST(SIMD, UnsignedIntegers) {
+	{
+		const SIMD<uint64, 2> a(0xFFFFFFFFFFFFFFF0ull, 1ull), b(2ull, 0x8000000000000000ull);
+		alignas(16) uint64 result[2];
+
+		SIMD<uint64, 2>::Min(a, b).CopyTo(AlignedPointer<uint64, 16>(result)); // set is high to low
+		GTEST_ASSERT_EQ(result[0], 1ull); GTEST_ASSERT_EQ(result[1], 2ull);
+
+		SIMD<uint64, 2>::Max(a, b).CopyTo(AlignedPointer<uint64, 16>(result));
+		GTEST_ASSERT_EQ(result[0], 0x8000000000000000ull); GTEST_ASSERT_EQ(result[1], 0xFFFFFFFFFFFFFFF0ull);
+
+		GTEST_ASSERT_EQ((a > b).BitMask(), 0xFF00);
+		GTEST_ASSERT_EQ((a < b).BitMask(), 0x00FF);
+		GTEST_ASSERT_EQ((a <= a).BitMask(), 0xFFFF);
+	}
+
+	{
+		const uint16 values[8] = { 0, 1, 2, 0xFFFF, 4, 5, 0x8000, 7 };
+		const SIMD<uint16, 8> a{ UnalignedPointer<const uint16>(values) }, b(static_cast<uint16>(3));
+
+		GTEST_ASSERT_EQ((a > b).BitMask(), 0b11111000);
+		GTEST_ASSERT_EQ((a == b).BitMask(), 0);
+		GTEST_ASSERT_EQ((SIMD<uint16, 8>::AddSaturated(a, b).GetElement<3>()), 0xFFFF);
+		GTEST_ASSERT_EQ((a * b).GetElement<2>(), 6);
+		GTEST_ASSERT_EQ(a.ShiftRight<4>().GetElement<6>(), 0x800);
+	}
+
+	{
+		const SIMD<uint32, 4> a(1u, 0x80000000u, 3u, 0xFFFFFFFFu), b(2u);
+
+		GTEST_ASSERT_EQ((a >= b).BitMask(), 0b1110);
+		GTEST_ASSERT_EQ((SIMD<uint32, 4>::Min(a, b).GetElement<1>()), 2u);
+		GTEST_ASSERT_EQ((a * b).GetElement<2>(), 6u);
+	}
+
+	if (GetSIMDLevel() >= SIMDLevel::AVX2) { checkUnsignedIntegers256(); }
+}
+
+GTSL_TARGET_AVX512 static void checkWide() {
+	uint8 bytes[64];
+	for (uint8 i = 0; i < 64; ++i) { bytes[i] = i; }
+	const SIMD<uint8, 64> a{ UnalignedPointer<const uint8>(bytes) };
+
+	GTEST_ASSERT_EQ((a < SIMD<uint8, 64>(static_cast<uint8>(8))).BitMask(), 0xFFull);
+	GTEST_ASSERT_EQ(a.GetElement<40>(), 40);
+
+	uint32 words[16], compressed[16];
+	for (uint32 i = 0; i < 16; ++i) { words[i] = i * 3; }
+	const SIMD<uint32, 16> b{ UnalignedPointer<const uint32>(words) };
+
+	GTEST_ASSERT_EQ(b.CompressTo(UnalignedPointer<uint32>(compressed), (b > SIMD<uint32, 16>(30u)).BitMask()), 5u);
+	GTEST_ASSERT_EQ(compressed[0], 33u); GTEST_ASSERT_EQ(compressed[4], 45u);
+
+	alignas(64) float32 floats[16];
+	for (uint32 i = 0; i < 16; ++i) { floats[i] = static_cast<float32>(i) - 7.5f; }
+	const SIMD<float32, 16> c{ AlignedPointer<const float32, 64>(floats) };
+
+	GTEST_ASSERT_EQ((c < SIMD<float32, 16>(0.0f)).BitMask(), 0xFF);
+	EXPECT_FLOAT_EQ((SIMD<float32, 16>::Abs(c).HorizontalSum()), 64.0f);
+	EXPECT_FLOAT_EQ((SIMD<float64, 8>(2.0).SquareRoot().HorizontalSum()), 8.0 * 1.4142135623730951);
+}
+
+TEST(SIMD, Wide) {
+	if (GetSIMDLevel() < SIMDLevel::AVX512) {
+		GTEST_SKIP_("AVX-512 is not supported on this machine.");
+	}
+
+	checkWide();
+}
+
+static uint32 sumScalar(const uint32* data, const uint32 length) {
+	uint32 sum = 0;
+	for (uint32 i = 0; i < length; ++i) { sum += data[i]; }
+	return sum;
+}
+
+template<class SIMD_TYPE>
+static uint32 sumVectors(const uint32* data, const uint32 length) {
+	SIMD_TYPE sum(0u); uint32 i = 0;
+	for (; i + SIMD_TYPE::ElementCount <= length; i += SIMD_TYPE::ElementCount) { sum += SIMD_TYPE(UnalignedPointer<const uint32>(data + i)); }
+
+	uint32 lanes[SIMD_TYPE::ElementCount]; sum.CopyTo(UnalignedPointer<uint32>(lanes));
+	uint32 result = sumScalar(data + i, length - i);
+	for (auto lane : lanes) { result += lane; }
+	return result;
+}
+
+GTSL_TARGET_SSE4 static uint32 sumSSE4(const uint32* data, const uint32 length) { return sumVectors<SIMD<uint32, 4>>(data, length); }
+GTSL_TARGET_AVX2 static uint32 sumAVX2(const uint32* data, const uint32 length) { return sumVectors<SIMD<uint32, 8>>(data, length); }
+GTSL_TARGET_AVX512 static uint32 sumAVX512(const uint32* data, const uint32 length) { return sumVectors<SIMD<uint32, 16>>(data, length); }
+
+TEST(SIMD, Dispatch) {
+	uint32 data[1003];
+	for (uint32 i = 0; i < 1003; ++i) { data[i] = i * 2654435761u; }
+
+	const uint32 expected = sumScalar(data, 1003);
+
+	for (uint8 level = 0; level <= static_cast<uint8>(GetSIMDLevel()); ++level) {
+		const Dispatcher<uint32(const uint32*, uint32)> sum(sumScalar, sumSSE4, sumAVX2, sumAVX512, static_cast<SIMDLevel>(level));
+		GTEST_ASSERT_EQ(sum.GetLevel(), static_cast<SIMDLevel>(level));
+		GTEST_ASSERT_EQ(sum(data + 1, 1002), expected - data[0]);
+	}
+
+	const Dispatcher<uint32(const uint32*, uint32)> fallback(sumScalar, sumSSE4, nullptr, nullptr);
+	GTEST_ASSERT_EQ(fallback.GetLevel(), GetSIMDLevel() >= SIMDLevel::SSE4 ? SIMDLevel::SSE4 : SIMDLevel::SCALAR);
+}
@@ -1,8 +1,11 @@
 //123 test
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "GTSL/File.hpp"
+#include "GTSL/StringBuilder.hpp"
+#include "GTSL/String.hpp"
 #include "GTSL/DLL.h"
 #include "GTSL/MappedFile.hpp"
 #include "GTSL/Filesystem.hpp"
@@ -16,6 +19,12 @@
 #include "GTSL/ConditionVariable.h"
 #include "GTSL/Atomic.hpp"
 #include "GTSL/Semaphore.h"
+#include "GTSL/SeqLock.hpp"
+#include "GTSL/EpochReclaimer.hpp"
+#include "GTSL/Task.hpp"
+#include "GTSL/ShardedCounter.hpp"
+#include "GTSL/Barrier.hpp"
+#include "GTSL/TimerWheel.hpp"
 
 TEST(File, Construct) {
 	GTSL::File file;
@@ -103,6 +112,42 @@ TEST(File, ReadRaw) {
 	GTEST_ASSERT_EQ(GTSL::Range<const GTSL::byte*>(16, reinterpret_cast<const GTSL::byte*>(array)), GTSL::Range<const GTSL::byte*>(16, buffer));
 }
 
+TEST(File, ContentHash) {
+	GTSL::File file(u8"./test/COOPBL.TTF", GTSL::File::READ, false);
+
+	if(!file) {
+		GTEST_SKIP_("Skipped because file could not be found.");
+	}
+
+	GTSL::Buffer<GTSL::DefaultAllocatorReference> buffer(file.GetSize(), 16);
+	file.Read(buffer);
+
+	GTSL::StreamingHasher hasher;
+	hasher.Update(buffer.GetRange());
+
+	GTEST_ASSERT_EQ(file.GetSize(), hasher.GetLength());
+	ASSERT_TRUE(file.GetContentHash() == hasher.Get128()); // read in chunks smaller than the file
+	ASSERT_TRUE(file.GetContentHash() == hasher.Get128());
+}
+
+TEST(File, WriteGathered) {
+	GTSL::StringBuilder<GTSL::DefaultAllocatorReference> builder(64);
+	for (GTSL::uint32 i = 0; i < 5000; ++i) { GTSL::ToString(builder, i); builder += u8'\n'; } // more chunks than one gathered write takes
+
+	GTSL::File file(u8"./test/WriteGatheredFile", GTSL::File::WRITE, true);
+	file.Resize(0);
+	GTEST_ASSERT_EQ(builder.WriteTo(file), builder.GetBytes());
+	GTEST_ASSERT_EQ(file.GetSize(), builder.GetBytes());
+
+	GTSL::String<GTSL::DefaultAllocatorReference> expected;
+	builder.CopyTo(expected);
+
+	GTSL::Buffer<GTSL::DefaultAllocatorReference> buffer(static_cast<GTSL::uint32>(file.GetSize()), 16);
+	GTSL::File read(u8"./test/WriteGatheredFile", GTSL::File::READ, false);
+	read.Read(buffer);
+	GTEST_ASSERT_EQ(static_cast<GTSL::StringView>(buffer), GTSL::StringView(expected));
+}
+
 TEST(MappedFile, Construct) {
 	GTSL::MappedFile mapped_file;
 }
@@ -399,6 +444,321 @@ TEST(Semaphore, Semaphore) {
 	semaphore.Wait();
 }
 
+TEST(SeqLock, ConcurrentReadWrite) {
+	struct Pair { GTSL::uint64 A, B; };
+
+	GTSL::SeqLock<Pair> seqLock(Pair{ 0, 0 });
+
+	auto write = [](GTSL::SeqLock<Pair>* seqLock) {
+		for (GTSL::uint64 i = 1; i <= 100000; ++i) { seqLock->Write(Pair{ i, i * 2 }); }
+	};
+
+	GTSL::Thread thread(GTSL::DefaultAllocatorReference{}, 1, GTSL::Delegate<void(GTSL::SeqLock<Pair>*)>::Create(write), &seqLock);
+
+	Pair pair;
+
+	do {
+		pair = seqLock.Read();
+		GTEST_ASSERT_EQ(pair.B, pair.A * 2);
+	} while (pair.A != 100000);
+
+	thread.Join(GTSL::DefaultAllocatorReference{});
+}
+
+TEST(EpochReclaimer, Retire) {
+	struct Counted {
+		Counted(GTSL::uint32* counter) : Counter(counter) {}
+		~Counted() { ++(*Counter); }
+		GTSL::uint32* Counter;
+	};
+
+	GTSL::uint32 destroyed = 0;
+
+	auto makeCounted = [&destroyed]() {
+		GTSL::DefaultAllocatorReference allocator; Counted* counted; GTSL::uint64 allocatedSize;
+		allocator.Allocate(sizeof(Counted), alignof(Counted), reinterpret_cast<void**>(&counted), &allocatedSize);
+		return ::new(counted) Counted(&destroyed);
+	};
+
+	{
+		GTSL::EpochReclaimer<GTSL::DefaultAllocatorReference> reclaimer;
+
+		{
+			GTSL::ReadLock lock(reclaimer);
+
+			reclaimer.Retire(makeCounted());
+
+			GTEST_ASSERT_EQ(reclaimer.Collect(), 0u); // the retiring thread can still hold a reference
+			GTEST_ASSERT_EQ(destroyed, 0u);
+		}
+
+		reclaimer.Collect();
+
+		GTEST_ASSERT_EQ(destroyed, 1u);
+		GTEST_ASSERT_EQ(reclaimer.GetPendingCount(), 0u);
+
+		reclaimer.Retire(makeCounted());
+	}
+
+	GTEST_ASSERT_EQ(destroyed, 2u);
+}
+
+TEST(ShardedCounter, ConcurrentAdd) {
+	struct Metrics {
+		GTSL::ShardedCounter<> Requests;
+		GTSL::ShardedHistogram<GTSL::uint64> Latencies;
+	} metrics;
+
+	auto work = [](Metrics* metrics) {
+		for (GTSL::uint64 i = 0; i < 10000; ++i) { ++metrics->Requests; metrics->Latencies.Sample(i); }
+	};
+
+	GTSL::Thread threads[4];
+
+	for (GTSL::uint8 i = 0; i < 4; ++i) {
+		threads[i] = GTSL::Thread(GTSL::DefaultAllocatorReference{}, i + 1, GTSL::Delegate<void(Metrics*)>::Create(work), &metrics);
+	}
+
+	for (auto& thread : threads) { thread.Join(GTSL::DefaultAllocatorReference{}); }
+
+	GTEST_ASSERT_EQ(metrics.Requests.Read(), 40000ull);
+
+	auto statistics = metrics.Latencies.GetStatistics();
+	GTEST_ASSERT_EQ(statistics.Count, 40000ull);
+	GTEST_ASSERT_EQ(statistics.Min, 0ull);
+	GTEST_ASSERT_EQ(statistics.Max, 9999ull);
+	GTEST_ASSERT_EQ(statistics.Sum, 4ull * (9999ull * 10000ull / 2));
+	GTEST_ASSERT_EQ(metrics.Latencies.GetBucket(0), 4ull);
+	GTEST_ASSERT_EQ(metrics.Latencies.GetBucket(3), 4ull * 4); // 4 - 7
+	GTEST_ASSERT_EQ(metrics.Latencies.GetPercentileUpperBound(0.5), 8191ull);
+}
+
+TEST(ShardedCounter, UnregisteredThreads) { // threads not started by GTSL::Thread all share slot 0 with the main thread
+	GTSL::ShardedCounter<> requests;
+	GTSL::ShardedGauge<GTSL::int64> depths;
+
+	auto work = [&](const GTSL::int64 offset) {
+		for (GTSL::int64 i = 0; i < 10000; ++i) { ++requests; depths.Sample(i + offset); }
+	};
+
+	std::thread threads[4];
+	for (GTSL::uint32 i = 0; i < 4; ++i) { threads[i] = std::thread(work, static_cast<GTSL::int64>(i) * 10); }
+	work(-5);
+	for (auto& thread : threads) { thread.join(); }
+
+	GTEST_ASSERT_EQ(requests.Read(), 50000ull);
+
+	const auto statistics = depths.Read();
+	GTEST_ASSERT_EQ(statistics.Count, 50000ull);
+	GTEST_ASSERT_EQ(statistics.Min, -5);
+	GTEST_ASSERT_EQ(statistics.Max, 10029);
+	GTEST_ASSERT_EQ(statistics.Sum, 5 * (9999ll * 10000 / 2) + 10000 * (-5 + 0 + 10 + 20 + 30));
+}
+
+TEST(Barrier, PhaseBarrier) {
+	struct Simulation {
+		Simulation() : Barrier(4, GTSL::Delegate<void()>::Create<Simulation, &Simulation::onPhase>(this)) {}
+
+		void onPhase() { // every thread must have arrived before the completion runs
+			const GTSL::uint32 expected = Phases % 2 ? 16 * ((Phases + 1) / 2) : 16 * (Phases / 2) + 4;
+			if (GTSL::AtomicLoad(Sum) != expected) { Errors = true; }
+			++Phases;
+		}
+
+		GTSL::PhaseBarrier Barrier;
+		GTSL::Latch Done{ 4 };
+		GTSL::uint32 Sum = 0, Phases = 0; bool Errors = false;
+	} simulation;
+
+	auto work = [](Simulation* simulation) {
+		for (GTSL::uint32 i = 0; i < 1000; ++i) {
+			GTSL::AtomicFetchAdd(simulation->Sum, 1u);
+			simulation->Barrier.ArriveAndWait();
+			GTSL::AtomicFetchAdd(simulation->Sum, 3u);
+			simulation->Barrier.ArriveAndWait();
+		}
+
+		simulation->Done.CountDown();
+	};
+
+	GTSL::Thread threads[3];
+
+	for (GTSL::uint8 i = 0; i < 3; ++i) {
+		threads[i] = GTSL::Thread(GTSL::DefaultAllocatorReference{}, i + 1, GTSL::Delegate<void(Simulation*)>::Create(work), &simulation);
+	}
+
+	work(&simulation);
+
+	simulation.Done.Wait();
+	ASSERT_TRUE(simulation.Done.TryWait());
+
+	for (auto& thread : threads) { thread.Join(GTSL::DefaultAllocatorReference{}); }
+
+	GTEST_ASSERT_EQ(simulation.Phases, 2000u);
+	GTEST_ASSERT_EQ(simulation.Barrier.GetPhase(), 2000u);
+	GTEST_ASSERT_EQ(simulation.Sum, 16000u);
+	ASSERT_FALSE(simulation.Errors);
+}
+
+struct CountingAllocator {
+	static inline GTSL::uint32 Allocations = 0;
+
+	void Allocate(GTSL::uint64 size, GTSL::uint64 alignment, void** data, GTSL::uint64* allocatedSize) {
+		++Allocations; GTSL::DefaultAllocatorReference().Allocate(size, alignment, data, allocatedSize);
+	}
+
+	void Deallocate(GTSL::uint64 size, GTSL::uint64 alignment, void* data) {
+		--Allocations; GTSL::DefaultAllocatorReference().Deallocate(size, alignment, data);
+	}
+};
+
+GTSL::Task<GTSL::uint32, CountingAllocator> Square(GTSL::uint32 value) {
+	co_return value * value;
+}
+
+GTSL::Task<GTSL::uint32, CountingAllocator> SumOfSquares(GTSL::uint32 count) {
+	GTSL::uint32 sum = 0;
+	for (GTSL::uint32 i = 0; i < count; ++i) { sum += co_await Square(i); }
+	co_return sum;
+}
+
+TEST(Task, Chain) {
+	{
+		auto task = SumOfSquares(1000);
+		GTEST_ASSERT_EQ(CountingAllocator::Allocations, 1u);
+		task.Start();
+		ASSERT_TRUE(task.IsDone());
+		GTEST_ASSERT_EQ(task.GetResult(), 332833500u);
+	}
+
+	GTEST_ASSERT_EQ(CountingAllocator::Allocations, 0u);
+}
+
+TEST(Task, ThreadPoolExecutor) {
+	GTSL::Semaphore semaphore(1);
+	GTSL::ThreadPoolExecutor<> executor(2); // destroyed first, so it's threads are joined before the semaphore goes away
+
+	auto waiter = [](GTSL::ThreadPoolExecutor<>& executor, GTSL::Semaphore& semaphore) -> GTSL::Task<GTSL::uint32> {
+		co_await GTSL::ScheduleOn(executor);
+		co_await GTSL::AsyncWait(semaphore, executor);
+		co_await GTSL::Delay(executor, GTSL::Milliseconds(2));
+		co_return 7u;
+	};
+
+	auto task = waiter(executor, semaphore);
+	auto poster = [](GTSL::ThreadPoolExecutor<>& executor, GTSL::Semaphore& semaphore) -> GTSL::DetachedTask<> { // runs alongside the waiter, nobody awaits it
+		co_await GTSL::ScheduleOn(executor);
+		semaphore.Post();
+	};
+
+	const auto start = GTSL::GetMonotonicTime();
+	poster(executor, semaphore);
+	GTEST_ASSERT_EQ(GTSL::SyncWait(task), 7u);
+	ASSERT_TRUE(GTSL::GetMonotonicTime() - start > GTSL::Nanoseconds(GTSL::Milliseconds(1)));
+}
+
+TEST(Task, AsyncRead) {
+	GTSL::File file(u8"./test/COOPBL.TTF", GTSL::File::READ, false);
+
+	if (!file) {
+		GTEST_SKIP_("Could not open test file.");
+	}
+
+	GTSL::ThreadPoolExecutor<> executor(1);
+
+	auto read = [](GTSL::ThreadPoolExecutor<>& executor, const GTSL::File& file) -> GTSL::Task<GTSL::uint64> {
+		GTSL::byte buffer[16];
+		co_return co_await GTSL::AsyncRead(executor, file, GTSL::Range<GTSL::byte*>(16, buffer));
+	};
+
+	auto task = read(executor, file);
+	GTEST_ASSERT_EQ(GTSL::SyncWait(task), 16ull);
+}
+
+struct TimerWheelTest {
+	GTSL::TimerWheel<> Wheel;
+	GTSL::Nanoseconds Now;
+	GTSL::uint64 Deadlines[1024]; GTSL::uint32 Fired = 0, Periodic = 0; bool Errors = false;
+
+	void OnTimer(const GTSL::TimerHandle handle) {
+		const auto deadline = Deadlines[reinterpret_cast<GTSL::uint64>(Wheel.GetUserData(handle))];
+		if (Now.GetCount() < deadline || Now.GetCount() - deadline > GTSL::Nanoseconds(GTSL::Milliseconds(8)).GetCount()) { Errors = true; }
+		++Fired;
+	}
+
+	void OnPeriodic(const GTSL::TimerHandle handle) {
+		if (++Periodic == 10) { Wheel.Cancel(handle); }
+	}
+};
+
+TEST(TimerWheel, ScheduleCancel) {
+	TimerWheelTest test;
+	const auto start = GTSL::GetMonotonicTime();
+	GTSL::TimerHandle handles[1024];
+
+	GTSL::uint64 seed = 12345;
+	for (GTSL::uint32 i = 0; i < 1024; ++i) { // spread deadlines over the first three levels
+		seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+		test.Deadlines[i] = start.GetCount() + GTSL::Nanoseconds(GTSL::Milliseconds((seed >> 33) % 100000)).GetCount();
+		handles[i] = test.Wheel.Schedule(GTSL::Nanoseconds(test.Deadlines[i]), GTSL::TimerWheel<>::Callback::Create<TimerWheelTest, &TimerWheelTest::OnTimer>(&test), GTSL::Nanoseconds(0), reinterpret_cast<void*>(static_cast<GTSL::uint64>(i)));
+	}
+
+	for (GTSL::uint32 i = 0; i < 1024; i += 2) { ASSERT_TRUE(test.Wheel.Cancel(handles[i])); }
+	for (GTSL::uint32 i = 0; i < 1024; i += 2) { ASSERT_FALSE(test.Wheel.Cancel(handles[i])); }
+
+	test.Wheel.Schedule(start, GTSL::TimerWheel<>::Callback::Create<TimerWheelTest, &TimerWheelTest::OnPeriodic>(&test), GTSL::Milliseconds(10));
+
+	GTEST_ASSERT_EQ(test.Wheel.GetTimerCount(), 513u);
+
+	for (test.Now = start; test.Now < start + GTSL::Milliseconds(100010); test.Now += GTSL::Milliseconds(7)) { test.Wheel.Advance(test.Now); }
+
+	ASSERT_FALSE(test.Errors);
+	GTEST_ASSERT_EQ(test.Fired, 512u);
+	GTEST_ASSERT_EQ(test.Periodic, 10u);
+	GTEST_ASSERT_EQ(test.Wheel.GetTimerCount(), 0u);
+	ASSERT_FALSE(test.Wheel.IsPending(handles[1]));
+}
+
+TEST(TimerWheel, LevelBoundary) {
+	GTSL::TimerWheel<> wheel(GTSL::Milliseconds(100)); // coarse ticks so the wheel is still at tick 0 when scheduling
+	const auto resolution = wheel.GetResolution().GetCount();
+	const auto now = GTSL::GetMonotonicTime();
+	const auto tickZero = (now + wheel.GetTimeUntilNextTick(now)).GetCount() - resolution;
+
+	auto onTimer = [](GTSL::TimerHandle) {};
+
+	// due at the first tick of level 1's third slot, cascades into level 0 exactly at it's tick
+	wheel.Schedule(GTSL::Nanoseconds(tickZero + 512 * resolution), GTSL::TimerWheel<>::Callback::Create(onTimer));
+
+	for (GTSL::uint64 tick = 1; tick < 512; ++tick) { GTEST_ASSERT_EQ(wheel.Advance(GTSL::Nanoseconds(tickZero + tick * resolution)), 0u); }
+	GTEST_ASSERT_EQ(wheel.Advance(GTSL::Nanoseconds(tickZero + 512 * resolution)), 1u);
+	GTEST_ASSERT_EQ(wheel.GetTimerCount(), 0u);
+}
+
+TEST(TimerWheel, TimerThread) {
+	GTSL::Latch latch(3);
+	GTSL::TimerThread<> timerThread(1);
+
+	auto countDown = [&latch](GTSL::TimerHandle) { latch.CountDown(); };
+
+	const auto start = GTSL::GetMonotonicTime();
+	for (GTSL::uint32 i = 0; i < 3; ++i) { timerThread.ScheduleAfter(GTSL::Milliseconds(2 + i), GTSL::TimerWheel<>::Callback::Create(countDown)); }
+
+	latch.Wait();
+	ASSERT_FALSE(GTSL::GetMonotonicTime() - start < GTSL::Nanoseconds(GTSL::Milliseconds(2)));
+
+	GTSL::SleepFor(GTSL::Milliseconds(20)); // the thread waits for work while the wheel is empty, scheduling has to wake it
+
+	GTSL::Latch idleLatch(1);
+	auto idleCountDown = [&idleLatch](GTSL::TimerHandle) { idleLatch.CountDown(); };
+
+	const auto idleStart = GTSL::GetMonotonicTime();
+	timerThread.ScheduleAfter(GTSL::Milliseconds(2), GTSL::TimerWheel<>::Callback::Create(idleCountDown));
+
+	idleLatch.Wait();
+	ASSERT_FALSE(GTSL::GetMonotonicTime() - idleStart < GTSL::Nanoseconds(GTSL::Milliseconds(2)));
+}
+
 TEST(OS, Path) {
 	auto path = GTSL::Application::GetPathToExecutable();
 
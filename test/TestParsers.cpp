@@ -4,8 +4,11 @@
 #include "GTSL/File.hpp"
 #include "GTSL/LUT.hpp"
 #include "GTSL/JSON.hpp"
+#include "GTSL/StringBuilder.hpp"
 #include "GTSL/Vector.hpp"
 
+#include <cstdio>
+
 TEST(LUT, Valid) {
 	GTSL::File lutFile(u8"./test/Kodak Ektachrome 64.cube", GTSL::File::READ, false);
 
@@ -43,10 +46,108 @@ TEST(LUT, Invalid) {
 	ASSERT_FALSE(parseResult);
 }
 
+// Builds a .cube with a smooth non linear grade, so interpolation modes actually differ.
+static GTSL::String<GTSL::DefaultAllocatorReference> makeCube(const GTSL::uint32 size) {
+	GTSL::String<GTSL::DefaultAllocatorReference> cube(u8"TITLE \"Test\"\n# comment\nLUT_3D_SIZE ");
+	GTSL::ToString(cube, size); cube += u8"\nDOMAIN_MIN 0.0 0.0 0.0\nDOMAIN_MAX 1.0 1.0 1.0\n";
+
+	for (GTSL::uint32 b = 0; b < size; ++b) {
+		for (GTSL::uint32 g = 0; g < size; ++g) {
+			for (GTSL::uint32 r = 0; r < size; ++r) {
+				const float x = r / float(size - 1), y = g / float(size - 1), z = b / float(size - 1);
+				char line[64]; snprintf(line, sizeof(line), "%.6f %.6f %.6f\n", x * x, 0.5f * y + 0.5f * x * z, z * (1.0f - 0.25f * y));
+				cube += GTSL::StringView(reinterpret_cast<const char8_t*>(line));
+			}
+		}
+	}
+
+	return cube;
+}
+
+TEST(LUT, Malformed) {
+	GTSL::LUT3D lut;
+	ASSERT_FALSE(lut.Parse(u8"LUT_3D_SIZE 1\n0.5 0.5 0.5\n")); // a single sample has no cell to interpolate in
+	ASSERT_FALSE(lut.Parse(u8"LUT_3D_SIZE 0\n"));
+	ASSERT_FALSE(lut.Parse(u8"LUT_3D_SIZE 2\n0 0 0\n1 1 1\n")); // too few samples
+	GTEST_ASSERT_EQ(lut.GetSize(), 0);
+}
+
+TEST(LUT, Sample) {
+	GTSL::LUT3D lut;
+	auto cube = makeCube(17);
+	ASSERT_TRUE(lut.Parse(cube));
+	GTEST_ASSERT_EQ(lut.GetSize(), 17);
+
+	// at lattice points both modes return the stored value
+	for (auto interpolation : { GTSL::LUTInterpolation::TRILINEAR, GTSL::LUTInterpolation::TETRAHEDRAL }) {
+		const auto sample = lut.Sample(GTSL::Vector3(0.25f, 0.5f, 0.75f), interpolation);
+		ASSERT_NEAR(sample.X(), 0.0625f, 1e-5f); ASSERT_NEAR(sample.Y(), 0.25f + 0.5f * 0.25f * 0.75f, 1e-5f); ASSERT_NEAR(sample.Z(), 0.75f * 0.875f, 1e-5f);
+	}
+
+	// colors outside the domain clamp to it's edges
+	const auto clamped = lut.Sample(GTSL::Vector3(-1.0f, 2.0f, 0.0f));
+	ASSERT_NEAR(clamped.X(), 0.0f, 1e-5f); ASSERT_NEAR(clamped.Y(), 0.5f, 1e-5f);
+}
+
+TEST(LUT, Apply) {
+	GTSL::LUT3D lut;
+	auto cube = makeCube(33);
+	ASSERT_TRUE(lut.Parse(cube));
+
+	const GTSL::Extent2D extent(37, 23); // not a multiple of 8 wide
+	const GTSL::uint32 pixelCount = extent.Width * extent.Height;
+
+	GTSL::Vector<float, GTSL::DefaultAllocatorReference> source(pixelCount * 3), destination(pixelCount * 3);
+	GTSL::Vector<GTSL::uint8, GTSL::DefaultAllocatorReference> source8(pixelCount * 3), destination8(pixelCount * 3);
+
+	GTSL::Math::RandomSeed random(12345);
+	for (GTSL::uint32 i = 0; i < pixelCount * 3; ++i) {
+		source.EmplaceBack(random.Float32(-0.1f, 1.1f)); // includes out of domain values
+		destination.EmplaceBack(0.0f);
+		source8.EmplaceBack(static_cast<GTSL::uint8>(random())); destination8.EmplaceBack(0);
+	}
+
+	for (auto interpolation : { GTSL::LUTInterpolation::TRILINEAR, GTSL::LUTInterpolation::TETRAHEDRAL }) {
+		for (GTSL::uint8 threads : { 1, 4 }) {
+			lut.Apply(source.begin(), destination.begin(), extent, 0, interpolation, threads);
+
+			for (GTSL::uint32 p = 0; p < pixelCount; ++p) {
+				const auto expected = lut.Sample(GTSL::Vector3(source[p * 3], source[p * 3 + 1], source[p * 3 + 2]), interpolation);
+				for (GTSL::uint8 c = 0; c < 3; ++c) { ASSERT_NEAR(destination[p * 3 + c], expected[c], 1e-5f); }
+			}
+
+			lut.Apply(source8.begin(), destination8.begin(), extent, 0, interpolation, threads);
+
+			for (GTSL::uint32 p = 0; p < pixelCount; ++p) {
+				const auto expected = lut.Sample(GTSL::Vector3(source8[p * 3] / 255.0f, source8[p * 3 + 1] / 255.0f, source8[p * 3 + 2] / 255.0f), interpolation);
+				for (GTSL::uint8 c = 0; c < 3; ++c) { ASSERT_NEAR(destination8[p * 3 + c], expected[c] * 255.0f, 0.51f); }
+			}
+		}
+	}
+}
+
+TEST(LUT, Ektachrome) {
+	GTSL::File lutFile(u8"./test/Kodak Ektachrome 64.cube", GTSL::File::READ, false);
+
+	if(!lutFile) {
+		GTEST_SKIP_("Skipped because file could not be found.");
+	}
+
+	GTSL::Buffer<GTSL::DefaultAllocatorReference> buffer;
+	lutFile.Read(buffer);
+
+	GTSL::LUT3D lut;
+	ASSERT_TRUE(lut.Parse(GTSL::StringView(buffer)));
+	GTEST_ASSERT_EQ(lut.GetSize(), 33);
+
+	const auto first = lut.Sample(GTSL::Vector3(0, 0, 0));
+	ASSERT_TRUE(GTSL::Math::IsNearlyEqual(first, GTSL::Vector3(0.0170, 0.0002, 0.0111), 0.0001));
+}
+
 TEST(JSON, Serialize) {
 	GTSL::uint32 bananas = 5, apples = 2;
 
-	auto jsonString = u8R"({"bananas":5,"apples":2,"string":"test","array":[4,0,8,12],"obj":{"bool":true,"float":3.141000},"empty":[]})";
+	auto jsonString = u8R"({"bananas":5,"apples":2,"string":"test","array":[4,0,8,12],"obj":{"bool":true,"float":3.141},"empty":[]})";
 
 	GTSL::StaticString<256> buffer;
 	GTSL::JSONSerializer serializer = GTSL::MakeSerializer(buffer);
@@ -75,6 +176,29 @@ TEST(JSON, Serialize) {
 	GTEST_ASSERT_EQ(buffer, GTSL::StringView(jsonString));
 }
 
+TEST(JSON, SerializeToBuilder) {
+	GTSL::StringBuilder<GTSL::DefaultAllocatorReference> builder(32); // chunks small enough that trims and values cross them
+	GTSL::JSONSerializer serializer = GTSL::MakeSerializer(builder);
+
+	GTSL::StartArray(serializer, builder, u8"values");
+		for (GTSL::uint32 i = 0; i < 100; ++i) { GTSL::Insert(serializer, builder, i * 1000); }
+	GTSL::EndArray(serializer, builder);
+
+	GTSL::StartObject(serializer, builder, u8"obj");
+		GTSL::Insert(serializer, builder, u8"float", 3.141f);
+	GTSL::EndObject(serializer, builder);
+
+	EndSerializer(builder, serializer);
+
+	GTSL::String<GTSL::DefaultAllocatorReference> expected(u8R"({"values":[)");
+	for (GTSL::uint32 i = 0; i < 100; ++i) { if (i) { expected += u8','; } GTSL::ToString(expected, i * 1000); }
+	expected += u8R"(],"obj":{"float":3.141}})";
+
+	GTSL::String<GTSL::DefaultAllocatorReference> result;
+	builder.CopyTo(result);
+	GTEST_ASSERT_EQ(result, GTSL::StringView(expected));
+}
+
 TEST(JSON, Deserialize) {
 	auto jsonString = u8R"({
     "name":"ComputeShader",
@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "GTSL/Buffer.hpp"
 #include "GTSL/String.hpp"
 #include "GTSL/Serialize.hpp"
+#include "GTSL/ShortString.hpp"
+#include "GTSL/StringBuilder.hpp"
 
 using namespace GTSL;
 
@@ -50,10 +54,10 @@ TEST(String, MoveConstruct) {
 	String string1(static_cast<String<DefaultAllocatorReference>&&>(string0)); //force move constructor
 
 	//test original string have been modified
-	GTEST_ASSERT_EQ(string0.GetBytes(), 0); GTEST_ASSERT_EQ(string0.GetCodepoints(), 0); GTEST_ASSERT_EQ(string0.c_str(), nullptr); GTEST_ASSERT_EQ(string0.IsEmpty(), true);
+	GTEST_ASSERT_EQ(string0.GetBytes(), 0); GTEST_ASSERT_EQ(string0.GetCodepoints(), 0); GTEST_ASSERT_EQ(string0.c_str()[0], u8'\0'); GTEST_ASSERT_EQ(string0.IsEmpty(), true);
 
 	//test information has been moved
-	GTEST_ASSERT_EQ(string1.GetCodepoints(), string0Codepoints); GTEST_ASSERT_EQ(string1.GetBytes(), string0Bytes); GTEST_ASSERT_EQ(string1.c_str(), string0pointer); //remember static allocators DO switch pointers so this may not be a necessarily true test
+	GTEST_ASSERT_EQ(string1.GetCodepoints(), string0Codepoints); GTEST_ASSERT_EQ(string1.GetBytes(), string0Bytes); GTEST_ASSERT_NE(string1.c_str(), string0pointer); //short strings are stored inline, so they are copied to the new object
 
 	for (uint32 i = 0; i < StringByteLength(testString); ++i) {
 		GTEST_ASSERT_EQ(string1.c_str()[i], testString[i]); //test string has been moved correctly
@@ -107,10 +111,10 @@ TEST(String, MoveAssignment) {
 	string1 = static_cast<String<DefaultAllocatorReference>&&>(string0);
 
 	//test original string have been modified
-	GTEST_ASSERT_EQ(string0.GetBytes(), 0); GTEST_ASSERT_EQ(string0.GetCodepoints(), 0); GTEST_ASSERT_EQ(string0.c_str(), nullptr); GTEST_ASSERT_EQ(string0.IsEmpty(), true);
+	GTEST_ASSERT_EQ(string0.GetBytes(), 0); GTEST_ASSERT_EQ(string0.GetCodepoints(), 0); GTEST_ASSERT_EQ(string0.c_str()[0], u8'\0'); GTEST_ASSERT_EQ(string0.IsEmpty(), true);
 
 	//test information has been moved
-	GTEST_ASSERT_EQ(string1.GetCodepoints(), string0Codepoints); GTEST_ASSERT_EQ(string1.GetBytes(), string0Bytes); GTEST_ASSERT_EQ(string1.c_str(), string0pointer); //remember static allocators DO switch pointers so this may not be a necessarily true test
+	GTEST_ASSERT_EQ(string1.GetCodepoints(), string0Codepoints); GTEST_ASSERT_EQ(string1.GetBytes(), string0Bytes); GTEST_ASSERT_NE(string1.c_str(), string0pointer); //short strings are stored inline, so they are copied to the new object
 
 	for (uint32 i = 0; i < StringByteLength(testString); ++i) {
 		GTEST_ASSERT_EQ(string1.c_str()[i], testString[i]); //test string has been moved correctly
@@ -282,4 +286,93 @@ TEST(String, Serialize) {
 	GTEST_ASSERT_EQ(stringDestination.GetBytes(), stringSource.GetBytes());
 	GTEST_ASSERT_EQ(stringDestination.GetCodepoints(), stringSource.GetCodepoints());
 	GTEST_ASSERT_GE(stringDestination.GetCapacity(), stringSource.GetBytes());
-}
\ No newline at end of file
+}
+
+TEST(String, Inline) {
+	String<DefaultAllocatorReference> string;
+	ASSERT_TRUE(string.IsInline()); GTEST_ASSERT_EQ(string.c_str()[0], u8'\0');
+
+	std::string expected;
+
+	for (uint32 i = 0; i < 40; ++i) { // spills to the allocator when the text and it's padding no longer fit
+		string += static_cast<char8_t>(u8'a' + i % 26); expected += static_cast<char>('a' + i % 26);
+		GTEST_ASSERT_EQ(string.IsInline(), expected.size() + 3 <= 24);
+		GTEST_ASSERT_EQ(string, StringView(Byte(expected.size()), reinterpret_cast<const char8_t*>(expected.data())));
+		for (uint32 p = 0; p < 3; ++p) { GTEST_ASSERT_EQ(string.c_str()[expected.size() + p], u8'\0'); }
+	}
+
+	auto pointer = string.c_str();
+	String<DefaultAllocatorReference> moved(static_cast<String<DefaultAllocatorReference>&&>(string)); // allocated text is stolen, not copied
+	GTEST_ASSERT_EQ(moved.c_str(), pointer); ASSERT_TRUE(string.IsInline()); ASSERT_TRUE(string.IsEmpty());
+
+	String<DefaultAllocatorReference> shortString(u8"name \U0001F34C");
+	ASSERT_TRUE(shortString.IsInline());
+	moved = static_cast<String<DefaultAllocatorReference>&&>(shortString); // frees moved's allocation
+	GTEST_ASSERT_EQ(moved, StringView(u8"name \U0001F34C")); GTEST_ASSERT_EQ(moved.GetCodepoints(), 6u); ASSERT_TRUE(moved.IsInline());
+
+	ShortString<32> view(moved); // converts both ways with ShortString
+	String<DefaultAllocatorReference> fromView(view);
+	GTEST_ASSERT_EQ(fromView, StringView(view)); GTEST_ASSERT_EQ(fromView.GetCodepoints(), 6u);
+}
+
+TEST(String, TrimFullInline) {
+	String<DefaultAllocatorReference> path(u8"abcdefghijklmnopqrst/"); // 21 bytes, the most that stays inline
+	ASSERT_TRUE(path.IsInline());
+	ASSERT_TRUE(RTrimLast(path, u8'/', 1)); // drops nothing but rewrites the padding right at the end of the inline buffer
+	GTEST_ASSERT_EQ(path, StringView(u8"abcdefghijklmnopqrst/"));
+
+	String<DefaultAllocatorReference> full(u8"abcdefghijklmnopqrstu");
+	full.Drop(full.GetCodepoints());
+	GTEST_ASSERT_EQ(full, StringView(u8"abcdefghijklmnopqrstu"));
+
+	String<DefaultAllocatorReference> directory(u8"abcdefghij/klmnopqrst");
+	ASSERT_TRUE(LTrimLast(directory, u8'/'));
+	GTEST_ASSERT_EQ(directory, StringView(u8"klmnopqrst"));
+	for (uint32 p = 0; p < 3; ++p) { GTEST_ASSERT_EQ(directory.c_str()[10 + p], u8'\0'); }
+}
+
+TEST(StringBuilder, Append) {
+	StringBuilder<DefaultAllocatorReference> builder(40);
+	std::string expected;
+
+	for (uint32 i = 0; i < 300; ++i) {
+		builder += u8"\U0001F34C banana "; expected += reinterpret_cast<const char*>(u8"\U0001F34C banana ");
+		ToString(builder, i); expected += std::to_string(i);
+		builder += u8' '; expected += ' ';
+		ToString(builder, -0.5); expected += "-0.5";
+		builder << u8", "; expected += ", ";
+	}
+
+	builder += StringView(u8"a long string which doesn't fit in one chunk, so it gets a chunk of it's own \u00F1\u00F1"); expected += reinterpret_cast<const char*>(u8"a long string which doesn't fit in one chunk, so it gets a chunk of it's own \u00F1\u00F1");
+
+	GTEST_ASSERT_EQ(builder.GetBytes(), expected.size());
+	GTEST_ASSERT_GT(builder.GetChunkCount(), 1u);
+
+	uint64 codepoints = 0, chunks = 0;
+	builder.ForEachChunk([&](const StringView chunk) { // chunks split on code points
+		GTEST_ASSERT_EQ(CountUTF8Codepoints(chunk.GetData(), chunk.GetBytes()), chunk.GetCodepoints());
+		codepoints += chunk.GetCodepoints(); ++chunks;
+	});
+	GTEST_ASSERT_EQ(codepoints, builder.GetCodepoints());
+	GTEST_ASSERT_EQ(chunks, builder.GetChunkCount());
+
+	String<DefaultAllocatorReference> string;
+	builder.CopyTo(string);
+	GTEST_ASSERT_EQ(string, StringView(Byte(expected.size()), reinterpret_cast<const char8_t*>(expected.data())));
+	GTEST_ASSERT_EQ(string.GetCodepoints(), builder.GetCodepoints());
+
+	ASSERT_TRUE(RTrimLast(builder, u8'9')); // in an earlier chunk than the last
+	expected.resize(expected.rfind('9'));
+	string = StringView(); builder.CopyTo(string);
+	GTEST_ASSERT_EQ(string, StringView(Byte(expected.size()), reinterpret_cast<const char8_t*>(expected.data())));
+	GTEST_ASSERT_EQ(string.GetCodepoints(), builder.GetCodepoints());
+	ASSERT_FALSE(RTrimLast(builder, u8'#'));
+
+	builder.Clear();
+	ASSERT_TRUE(builder.IsEmpty());
+	GTEST_ASSERT_EQ(builder.GetChunkCount(), 1u);
+	builder += u8"again";
+	string = StringView(); builder.CopyTo(string);
+	GTEST_ASSERT_EQ(string, StringView(u8"again"));
+}
+
@@ -1,9 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <charconv>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "GTSL/Buffer.hpp"
+#include "GTSL/Hashing.hpp"
 #include "GTSL/ShortString.hpp"
 #include "GTSL/String.hpp"
 #include "GTSL/StringCommon.h"
+#include "GTSL/StringInterner.hpp"
+#include "GTSL/StringSearch.h"
 #include "GTSL/Unicode.hpp"
+#include "GTSL/Thread.hpp"
 #include "GTSL/Vector.hpp"
 
 using namespace GTSL;
@@ -30,13 +41,13 @@ TEST(StringCommon, NumberToString) {
 	{
 		GTSL::ShortString<32> string;
 		ToString(string, 3.141f);
-		GTEST_ASSERT_EQ(string, Range(u8"3.141000"));
+		GTEST_ASSERT_EQ(string, Range(u8"3.141"));
 	}
 
 	{
 		GTSL::ShortString<32> string;
 		ToString(string, -3.141f);
-		GTEST_ASSERT_EQ(string, Range(u8"-3.141000"));
+		GTEST_ASSERT_EQ(string, Range(u8"-3.141"));
 	}
 }
 
@@ -95,6 +106,102 @@ TEST(StringCommon, StringToNumber) {
 	}
 }
 
+TEST(StringCommon, NumberFormatting) {
+	auto format = [](auto number) { ShortString<48> string; ToString(string, number); return string; };
+
+	GTEST_ASSERT_EQ(format(0.1), Range(u8"0.1"));
+	GTEST_ASSERT_EQ(format(100.0f), Range(u8"100"));
+	GTEST_ASSERT_EQ(format(1e20), Range(u8"100000000000000000000"));
+	GTEST_ASSERT_EQ(format(1e21), Range(u8"1e21"));
+	GTEST_ASSERT_EQ(format(0.000001), Range(u8"0.000001"));
+	GTEST_ASSERT_EQ(format(1.5e-7f), Range(u8"1.5e-7"));
+	GTEST_ASSERT_EQ(format(-0.0), Range(u8"-0"));
+	GTEST_ASSERT_EQ(format(5e-324), Range(u8"5e-324"));
+	GTEST_ASSERT_EQ(format(1.7976931348623157e308), Range(u8"1.7976931348623157e308"));
+	GTEST_ASSERT_EQ(format(std::numeric_limits<float32>::infinity()), Range(u8"inf"));
+	GTEST_ASSERT_EQ(format(-std::numeric_limits<float64>::infinity()), Range(u8"-inf"));
+	GTEST_ASSERT_EQ(format(std::numeric_limits<float32>::quiet_NaN()), Range(u8"nan"));
+	GTEST_ASSERT_EQ(format(std::numeric_limits<int64>::min()), Range(u8"-9223372036854775808"));
+	GTEST_ASSERT_EQ(format(std::numeric_limits<uint64>::max()), Range(u8"18446744073709551615"));
+
+	std::mt19937_64 random(42);
+
+	for (uint32 i = 0; i < 100000; ++i) { // shortest digits round trip, and are as short as the standard library's
+		const float64 d = std::bit_cast<float64>(random()); const float32 f = std::bit_cast<float32>(static_cast<uint32>(random()));
+		if (d != d || f != f || d - d != 0 || f - f != 0) { continue; }
+
+		char expected[64];
+		auto dString = format(d); auto fString = format(f);
+		GTEST_ASSERT_EQ(ToNumber<float64>(dString).Get(), d);
+		GTEST_ASSERT_EQ(ToNumber<float32>(fString).Get(), f);
+
+		auto significantDigits = [](const char* begin, const char* end) {
+			uint32 count = 0; bool leading = true; uint32 zeros = 0;
+			for (const char* c = begin; c < end && *c != 'e'; ++c) {
+				if (*c < '1' || *c > '9') { if (*c == '0' && !leading) { ++zeros; } continue; }
+				leading = false; count += zeros + 1; zeros = 0;
+			}
+			return count;
+		};
+
+		auto end = std::to_chars(expected, expected + 64, d, std::chars_format::scientific).ptr;
+		GTEST_ASSERT_EQ(significantDigits(reinterpret_cast<const char*>(dString.begin()), reinterpret_cast<const char*>(dString.end())), significantDigits(expected, end));
+		end = std::to_chars(expected, expected + 64, f, std::chars_format::scientific).ptr;
+		GTEST_ASSERT_EQ(significantDigits(reinterpret_cast<const char*>(fString.begin()), reinterpret_cast<const char*>(fString.end())), significantDigits(expected, end));
+	}
+}
+
+TEST(StringCommon, NumberParsing) {
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"1.5e3").Get(), 1500.0);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"+2.5E-3").Get(), 0.0025);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8".5").Get(), 0.5);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"7.").Get(), 7.0);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"0.1").Get(), 0.1);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"2.2250738585072011e-308").Get(), 2.2250738585072011e-308);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"4.9406564584124654e-324").Get(), 5e-324);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"1e-400").Get(), 0.0);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"1e400").Get(), std::numeric_limits<float64>::infinity());
+	GTEST_ASSERT_EQ(ToNumber<float32>(u8"3.4028236e38").Get(), std::numeric_limits<float32>::infinity());
+	GTEST_ASSERT_EQ(ToNumber<float32>(u8"1.17549435e-38").Get(), std::numeric_limits<float32>::min());
+	GTEST_ASSERT_EQ(ToNumber<float32>(u8"16777217").Get(), 16777216.0f); // halfway, ties to even
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"9007199254740993").Get(), 9007199254740992.0);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"9007199254740993.0000000000000000001").Get(), 9007199254740994.0); // needs every digit
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"0.000000000000000000000000000001234567890123456789012").Get(), 1.234567890123456789012e-30);
+	GTEST_ASSERT_EQ(ToNumber<float64>(StringView(Byte(7), u8"3.141\0\0")).Get(), 3.141);
+
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"-").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"1e").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<float64>(u8"1.2.3").State(), false);
+
+	GTEST_ASSERT_EQ(ToNumber<int64>(u8"-9223372036854775808").Get(), std::numeric_limits<int64>::min());
+	GTEST_ASSERT_EQ(ToNumber<int64>(u8"9223372036854775807").Get(), std::numeric_limits<int64>::max());
+	GTEST_ASSERT_EQ(ToNumber<uint64>(u8"18446744073709551615").Get(), std::numeric_limits<uint64>::max());
+	GTEST_ASSERT_EQ(ToNumber<uint32>(u8"0000000000000000000000004294967295").Get(), 4294967295u);
+	GTEST_ASSERT_EQ(ToNumber<int8>(u8"-128").Get(), -128);
+
+	GTEST_ASSERT_EQ(ToNumber<int64>(u8"9223372036854775808").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<uint64>(u8"18446744073709551616").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<uint64>(u8"98446744073709551616").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<uint64>(u8"100000000000000000000").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<uint32>(u8"4294967296").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<int8>(u8"128").State(), false);
+	GTEST_ASSERT_EQ(ToNumber<uint32>(u8"").State(), false);
+
+	std::mt19937_64 random(7);
+
+	for (uint32 i = 0; i < 100000; ++i) { // against the standard library, on digits formatted by it
+		char text[64];
+		const float64 d = std::bit_cast<float64>(random());
+		if (d != d || d - d != 0) { continue; }
+		auto end = std::to_chars(text, text + 64, d, std::chars_format::general, static_cast<int>(random() % 25) + 1).ptr;
+		float64 expected; // out of range inputs are left to the explicit cases above, from_chars doesn't write a value for them
+		if (std::from_chars(text, end, expected).ec == std::errc()) { GTEST_ASSERT_EQ(ToNumber<float64>(StringView(Byte(end - text), reinterpret_cast<const char8_t*>(text))).Get(), expected); }
+		float32 expectedFloat;
+		if (std::from_chars(text, end, expectedFloat).ec == std::errc()) { GTEST_ASSERT_EQ(ToNumber<float32>(StringView(Byte(end - text), reinterpret_cast<const char8_t*>(text))).Get(), expectedFloat); }
+	}
+}
+
 TEST(StringCommon, ForEachSubstring) {
 	StaticString<64> string(u8"a bcd efghi  j");
 
@@ -128,6 +235,42 @@ TEST(StringCommon, ForEachSubstring) {
 	GTEST_ASSERT_EQ(vector[3], u8"j");
 }
 
+TEST(StringCommon, ForEachSubstringLong) {
+	std::mt19937 random(5);
+	const char8_t* words[] = { u8"a", u8"bcd", u8"módulo", u8"日本語", u8"assets/textures/ground_albedo.png", u8"x" };
+
+	for (uint32 trial = 0; trial < 200; ++trial) {
+		std::u8string text; std::vector<std::u8string> expected;
+
+		for (uint32 i = random() % 40; i; --i) {
+			for (uint32 d = 1 + random() % 2; d; --d) { text += random() % 2 ? u8',' : u8'\n'; }
+			expected.emplace_back(words[random() % 6]); text += expected.back();
+		}
+
+		for (uint32 d = random() % 3; d; --d) { text += u8','; }
+
+		const StringView view(Byte(text.size()), text.data());
+		uint32 i = 0;
+
+		ForEachSubstring(view, [&](const StringView substring) {
+			ASSERT_LT(i, expected.size());
+			const StringView word(Byte(expected[i].size()), expected[i].data());
+			GTEST_ASSERT_EQ(substring, word); // compares code point counts too
+			++i;
+		}, u8',', u8'\n');
+
+		GTEST_ASSERT_EQ(i, expected.size());
+
+		SubstringIterator iterator(view); i = 0;
+		while (iterator(u8',', u8'\n')) { GTEST_ASSERT_EQ(*iterator, StringView(Byte(expected[i].size()), expected[i].data())); ++i; }
+		GTEST_ASSERT_EQ(i, expected.size());
+	}
+
+	uint32 lines = 0;
+	ForEachLine(u8"first\n\nsecond\nthird\n", [&](StringView) { ++lines; });
+	GTEST_ASSERT_EQ(lines, 3u);
+}
+
 TEST(StringCommon, Join) {
 	{
 		GTSL::StaticString<128> string;
@@ -147,3 +290,263 @@ TEST(StringCommon, Join) {
 		GTEST_ASSERT_EQ(string, u8"a-b-c");
 	}
 }
+
+TEST(StringCommon, CharacterClasses) {
+	GTEST_ASSERT_EQ(ToUpperCase(u8'a'), u8'A'); GTEST_ASSERT_EQ(ToLowerCase(u8'Z'), u8'z'); GTEST_ASSERT_EQ(ToUpperCase(u8'{'), u8'{');
+	ASSERT_TRUE(IsLetter(U'q')); ASSERT_FALSE(IsLetter(U'\u00F1')); ASSERT_TRUE(IsNumber(U'7')); ASSERT_TRUE(IsSymbol(U'~')); ASSERT_FALSE(IsSymbol(U'@')); ASSERT_TRUE(IsWhitespace(U'\t'));
+
+	GTEST_ASSERT_EQ(static_cast<uint8>(GetCharacterClasses(u8"abc123")), static_cast<uint8>(CharacterClasses::LOWER | CharacterClasses::DIGIT));
+	GTEST_ASSERT_EQ(static_cast<uint8>(GetCharacterClasses(u8"Path/\u00F1")), static_cast<uint8>(CharacterClasses::LETTER | CharacterClasses::SYMBOL | CharacterClasses::NON_ASCII));
+
+	std::mt19937 random(17);
+
+	for (uint32 length = 0; length < 100; ++length) {
+		std::vector<char8_t> bytes(length); std::vector<uint8> classes(length);
+		for (auto& e : bytes) { e = static_cast<char8_t>(random()); }
+
+		const StringView string(length, length, bytes.data()); // only the bytes matter
+		uint8 all = 0;
+		for (const auto e : bytes) { all |= CHARACTER_CLASSES[static_cast<uint8>(e)]; }
+
+		GTEST_ASSERT_EQ(static_cast<uint8>(ClassifyCharacters(string, classes.data())), all);
+		GTEST_ASSERT_EQ(static_cast<uint8>(GetCharacterClasses(string)), all);
+		for (uint32 i = 0; i < length; ++i) { GTEST_ASSERT_EQ(classes[i], CHARACTER_CLASSES[static_cast<uint8>(bytes[i])]); }
+	}
+
+	ASSERT_TRUE(IsNumber(u8"-1,000.5")); ASSERT_FALSE(IsNumber(u8"")); ASSERT_FALSE(IsNumber(u8"12a"));
+	ASSERT_TRUE(IsDecimalNumber(u8"-1.5")); ASSERT_FALSE(IsDecimalNumber(u8"15")); ASSERT_FALSE(IsDecimalNumber(u8"1,5"));
+
+	std::string digits(70, '4');
+	ASSERT_TRUE(IsNumber(StringView(Byte(digits.size()), reinterpret_cast<const char8_t*>(digits.data()))));
+	ASSERT_FALSE(IsDecimalNumber(StringView(Byte(digits.size()), reinterpret_cast<const char8_t*>(digits.data()))));
+	digits[50] = '.'; ASSERT_TRUE(IsDecimalNumber(StringView(Byte(digits.size()), reinterpret_cast<const char8_t*>(digits.data()))));
+	digits[45] = 'x'; ASSERT_FALSE(IsNumber(StringView(Byte(digits.size()), reinterpret_cast<const char8_t*>(digits.data()))));
+}
+
+TEST(StringCommon, CaseInsensitive) {
+	std::mt19937 random(23);
+	const char8_t alphabet[] = u8"aAbBzZ09/_.@[`{\u00F1\u00D1";
+
+	const auto fold = [](std::string string) { for (auto& e : string) { if (e >= 'A' && e <= 'Z') { e += 'a' - 'A'; } } return string; };
+	const auto sign = [](const int32 value) { return (value > 0) - (value < 0); };
+	const auto view = [](const std::string& string) { return StringView(Byte(string.size()), reinterpret_cast<const char8_t*>(string.data())); };
+
+	for (uint32 trial = 0; trial < 2000; ++trial) {
+		std::string a, b;
+		const uint32 length = random() % 80;
+		for (uint32 i = 0; i < length; ++i) { a += static_cast<char>(alphabet[random() % (sizeof(alphabet) - 1)]); }
+
+		b = a;
+		for (auto& e : b) { if (random() % 2 && std::isalpha(static_cast<unsigned char>(e))) { e ^= 0x20; } } // same letters, mixed case
+		if (random() % 2 && length) { b[random() % length] = static_cast<char>(alphabet[random() % (sizeof(alphabet) - 1)]); }
+		if (random() % 4 == 0) { b.resize(random() % (length + 1)); }
+
+		GTEST_ASSERT_EQ(EqualsCaseInsensitive(view(a), view(b)), fold(a) == fold(b));
+		GTEST_ASSERT_EQ(sign(CompareCaseInsensitive(view(a), view(b))), sign(fold(a).compare(fold(b))));
+		GTEST_ASSERT_EQ(sign(Compare(view(a), view(b))), sign(a.compare(b)));
+
+		String<DefaultAllocatorReference> lower(view(a)), upper(view(a));
+		ToLowerCase(lower); ToUpperCase(upper);
+		std::string upperExpected = a; for (auto& e : upperExpected) { if (e >= 'a' && e <= 'z') { e -= 'a' - 'A'; } }
+		GTEST_ASSERT_EQ(lower, view(fold(a))); GTEST_ASSERT_EQ(upper, view(upperExpected));
+	}
+}
+
+TEST(Hashing, HashBytes) {
+	constexpr Id64 id(u8"a string longer than sixteen bytes, and longer than forty eight bytes too");
+	static_assert(id.GetID() == Hash(StringView(u8"a string longer than sixteen bytes, and longer than forty eight bytes too")));
+
+	std::mt19937 random(5);
+	std::vector<char8_t> bytes(300);
+	for (auto& e : bytes) { e = static_cast<char8_t>(random()); }
+
+	std::vector<uint64> hashes;
+
+	for (uint32 length = 0; length < bytes.size(); ++length) {
+		const uint64 hash = HashBytes(bytes.data(), length);
+		GTEST_ASSERT_EQ(Id64(StringView(length, length, bytes.data())).GetID(), hash);
+		GTEST_ASSERT_NE(HashBytes(bytes.data(), length, 1), hash);
+
+		for (uint32 i = 0; i < length; ++i) { // every byte, including ones only covered by overlapping reads, counts
+			bytes[i] ^= 1;
+			ASSERT_NE(HashBytes(bytes.data(), length), hash);
+			bytes[i] ^= 1;
+		}
+
+		hashes.emplace_back(hash);
+	}
+
+	std::sort(hashes.begin(), hashes.end());
+	ASSERT_TRUE(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+
+	std::vector<bool> buckets(1024); uint32 used = 0; // aligned values spread over the low bits like random ones would, about 63% of buckets
+	for (uint64 i = 0; i < 1024; ++i) { const uint64 bucket = MixHash(i << 16) & 1023; used += !buckets[bucket]; buckets[bucket] = true; }
+	ASSERT_GT(used, 580u);
+}
+
+TEST(Hashing, StreamingHasher) {
+	std::mt19937 random(9);
+	std::vector<byte> data(5000);
+	for (auto& e : data) { e = static_cast<byte>(random()); }
+
+	StreamingHasher whole;
+	whole.Update(data.size(), data.data());
+
+	for (uint32 trial = 0; trial < 50; ++trial) { // the same stream split at random points hashes the same
+		StreamingHasher pieces;
+		for (uint64 offset = 0; offset < data.size();) {
+			const uint64 piece = std::min<uint64>(random() % 200, data.size() - offset);
+			pieces.Update(Range<const byte*>(piece, data.data() + offset));
+			offset += piece;
+		}
+
+		ASSERT_TRUE(pieces.Get128() == whole.Get128());
+		GTEST_ASSERT_EQ(pieces.Get64(), whole.Get64());
+	}
+
+	for (uint32 i = 0; i < data.size(); i += 97) {
+		data[i] ^= 0x80;
+		StreamingHasher changed; changed.Update(data.size(), data.data());
+		ASSERT_FALSE(changed.Get128() == whole.Get128());
+		data[i] ^= 0x80;
+	}
+
+	StreamingHasher shorter, padded; // trailing zeros aren't confused with the padding of the last stripe
+	shorter.Update(3, data.data()); data[3] = 0; padded.Update(4, data.data());
+	ASSERT_FALSE(shorter.Get128() == padded.Get128());
+	ASSERT_FALSE(StreamingHasher(1).Get128() == StreamingHasher(2).Get128());
+}
+
+TEST(StringSearch, Find) {
+	std::mt19937 random(11);
+	std::string text;
+	for (uint32 i = 0; i < 5000; ++i) { text += static_cast<char>('a' + random() % 3); } // small alphabet, lots of partial matches
+
+	const StringView view(Byte(text.size()), reinterpret_cast<const char8_t*>(text.data()));
+
+	for (uint32 length = 0; length < 80; ++length) {
+		for (uint32 trial = 0; trial < 10; ++trial) {
+			std::string pattern;
+			if (trial % 2 && length <= text.size()) { pattern = text.substr(random() % (text.size() - length + 1), length); } else { for (uint32 i = 0; i < length; ++i) { pattern += static_cast<char>('a' + random() % 3); } }
+
+			const StringView patternView(Byte(pattern.size()), reinterpret_cast<const char8_t*>(pattern.data()));
+			const uint32 from = random() % 100;
+			const auto expected = text.find(pattern, from);
+
+			const auto found = Find(view, patternView, from);
+			GTEST_ASSERT_EQ(found.State(), expected != std::string::npos);
+			if (found.State()) { GTEST_ASSERT_EQ(found.Get(), expected); }
+
+			const auto horspool = BoyerMooreHorspool(patternView).Find(view, from);
+			GTEST_ASSERT_EQ(horspool.State(), expected != std::string::npos);
+			if (horspool.State()) { GTEST_ASSERT_EQ(horspool.Get(), expected); }
+		}
+	}
+
+	GTEST_ASSERT_EQ(Find(u8"log: error in módulo", u8"módulo").Get(), 14u);
+	GTEST_ASSERT_EQ(Find(u8"abc", u8"abcd").State(), false);
+	GTEST_ASSERT_EQ(Find(u8"abc", u8"", 3).Get(), 3u);
+}
+
+TEST(StringSearch, AhoCorasick) {
+	AhoCorasick searcher;
+	const char8_t* patterns[] = { u8"he", u8"she", u8"his", u8"hers", u8"error", u8"warning", u8"he" };
+	for (uint32 i = 0; i < 7; ++i) { GTEST_ASSERT_EQ(searcher.AddPattern(patterns[i]), i); }
+	searcher.Build();
+
+	const StringView text(u8"ushers had his error: warning, she hers");
+	std::string textString(reinterpret_cast<const char*>(text.GetData()), text.GetBytes());
+
+	uint32 expectedCount = 0;
+	for (uint32 i = 0; i < 7; ++i) {
+		const std::string pattern(reinterpret_cast<const char*>(patterns[i]));
+		for (auto at = textString.find(pattern); at != std::string::npos; at = textString.find(pattern, at + 1)) { ++expectedCount; }
+	}
+
+	uint32 previousEnd = 0;
+	const uint32 count = searcher.ForEachMatch(text, [&](const uint32 pattern, const uint32 offset) {
+		const StringView patternView(patterns[pattern]);
+		GTEST_ASSERT_EQ(StringView(Byte(patternView.GetBytes()), text.GetData() + offset), patternView);
+		GTEST_ASSERT_GE(offset + patternView.GetBytes(), previousEnd);
+		previousEnd = offset + patternView.GetBytes();
+	});
+
+	GTEST_ASSERT_EQ(count, expectedCount);
+
+	const auto first = searcher.FindFirst(text);
+	GTEST_ASSERT_EQ(first.State(), true);
+	GTEST_ASSERT_EQ(first.Get().First, 1u); // "she" ends on the same byte as "he" and is longer
+	GTEST_ASSERT_EQ(first.Get().Second, 1u);
+
+	GTEST_ASSERT_EQ(searcher.FindFirst(u8"nothing to see").State(), false);
+}
+
+TEST(StringInterner, Intern) {
+	StringInterner interner(4);
+
+	const auto albedo = interner.Intern(u8"albedo");
+	GTEST_ASSERT_EQ(albedo.State(), true);
+	GTEST_ASSERT_EQ(albedo.Get(), Id64(u8"albedo")); // same ids as hashing directly
+	GTEST_ASSERT_EQ(interner.Intern(u8"albedo").Get(), albedo.Get());
+	GTEST_ASSERT_EQ(interner.GetString(albedo.Get()).Get(), StringView(u8"albedo"));
+	GTEST_ASSERT_EQ(interner.Find(u8"normal").State(), false);
+	GTEST_ASSERT_EQ(interner.GetString(Id64(u8"normal")).State(), false);
+
+	std::u8string big(100000, u8'x'); // own block
+	const auto bigId = interner.Intern(StringView(Byte(big.size()), big.data()));
+	GTEST_ASSERT_EQ(interner.GetString(bigId.Get()).Get().GetBytes(), 100000u);
+
+	for (uint32 i = 0; i < 5000; ++i) { // grows the table many times
+		ShortString<32> name(u8"parameter_"); ToString(name, i);
+		GTEST_ASSERT_EQ(interner.Intern(name).State(), true);
+	}
+
+	for (uint32 i = 0; i < 5000; ++i) {
+		ShortString<32> name(u8"parameter_"); ToString(name, i);
+		GTEST_ASSERT_EQ(interner.GetString(Id64(StringView(name))).Get(), StringView(name));
+	}
+
+	GTEST_ASSERT_EQ(interner.GetCount(), 5002u);
+	GTEST_ASSERT_EQ(interner.GetString(albedo.Get()).Get(), StringView(u8"albedo"));
+
+	Buffer<DefaultAllocatorReference> buffer(64, 16);
+	const char8_t names[] = u8"mesh.gltf\0\0shader.glsl\0mesh.gltf";
+	buffer.Write(sizeof(names) - 1, reinterpret_cast<const byte*>(names));
+
+	uint32 i = 0;
+	GTEST_ASSERT_EQ(interner.InternAll(buffer, [&](const Result<Id64> id, const StringView string) {
+		GTEST_ASSERT_EQ(id.State(), true);
+		GTEST_ASSERT_EQ(string, i == 1 ? StringView(u8"shader.glsl") : StringView(u8"mesh.gltf"));
+		GTEST_ASSERT_EQ(id.Get(), Id64(string));
+		++i;
+	}), 3u);
+}
+
+TEST(StringInterner, Concurrent) {
+	StringInterner interner(16);
+
+	struct context { StringInterner<>* Interner; uint32 Thread; bool Failed = false; };
+
+	auto work = [](context* c) {
+		for (uint32 i = 0; i < 20000; ++i) {
+			ShortString<32> name(u8"asset_"); ToString(name, (i * 7 + c->Thread * 13) % 3000); // threads overlap on most names
+			const auto id = c->Interner->Intern(name);
+			if (!id.State() || id.Get() != Id64(StringView(name))) { c->Failed = true; }
+			const auto string = c->Interner->GetString(id.Get());
+			if (!string.State() || !(string.Get() == StringView(name))) { c->Failed = true; }
+		}
+	};
+
+	context contexts[4] = { { &interner, 0 }, { &interner, 1 }, { &interner, 2 }, { &interner, 3 } };
+	Thread threads[3] = {
+		Thread(DefaultAllocatorReference{}, 1, Delegate<void(context*)>::Create(work), &contexts[1]),
+		Thread(DefaultAllocatorReference{}, 2, Delegate<void(context*)>::Create(work), &contexts[2]),
+		Thread(DefaultAllocatorReference{}, 3, Delegate<void(context*)>::Create(work), &contexts[3])
+	};
+
+	work(&contexts[0]);
+	for (auto& e : threads) { e.Join(DefaultAllocatorReference{}); }
+
+	for (const auto& e : contexts) { GTEST_ASSERT_EQ(e.Failed, false); }
+	GTEST_ASSERT_EQ(interner.GetCount(), 3000u);
+}
@@ -3,6 +3,8 @@
 #include "GTSL/StringCommon.h"
 #include "GTSL/Unicode.hpp"
 
+#include <string>
+
 using namespace GTSL;
 
 TEST(Unicode, StringLength) {
@@ -51,4 +53,96 @@ TEST(Unicode, Malformed) {
 TEST(Unicode, Wellformed) {
 	char8_t good[] = { 0b11110000, 0b10011111 ,0b10001101 ,0b10001100 };
 	ASSERT_EQ(ToUTF32(good[0], good[1], good[2], good[3], 4).State(), true);
-}
\ No newline at end of file
+}
+// builds a long mixed text so the vector paths, block boundaries and tails are all exercised
+static std::u8string mixedText(const uint32 repetitions) {
+	std::u8string text;
+	for (uint32 i = 0; i < repetitions; ++i) { text += u8"log line "; text += u8"ñandú "; text += u8"⚙ gear "; text += u8"\U0001F975 hot\n"; text.append(i % 7, u8'x'); }
+	return text;
+}
+
+TEST(Unicode, Validate) {
+	const auto text = mixedText(50);
+	ASSERT_TRUE(ValidateUTF8(text.data(), text.size()));
+	ASSERT_TRUE(ValidateUTF8(text.data(), 0));
+
+	const char8_t* invalid[] = {
+		u8"\x80", u8"\xC0\xAF", u8"\xE0\x80\xAF", u8"\xED\xA0\x80", u8"\xF4\x90\x80\x80", u8"\xF8\x88\x80\x80\x80", u8"\xC3", u8"\xE2\x82", u8"\xF0\x9F\x98", u8"\xC3\xA9\xA9", u8"\xFF"
+	};
+
+	for (uint32 position : { 0u, 13u, 31u, 32u, 63u }) { // the bad sequence at, across and before vector boundaries
+		for (auto bad : invalid) {
+			std::u8string candidate(position, u8'a'); candidate += reinterpret_cast<const char8_t*>(bad); candidate += u8"tail";
+			EXPECT_FALSE(ValidateUTF8(candidate.data(), candidate.size())) << position;
+
+			std::u8string truncated(position, u8'a'); truncated += reinterpret_cast<const char8_t*>(bad); // ending mid sequence
+			EXPECT_FALSE(ValidateUTF8(truncated.data(), truncated.size())) << position;
+		}
+
+		std::u8string valid(position, u8'a'); valid += u8"\U0010FFFF�߿ࠀ";
+		EXPECT_TRUE(ValidateUTF8(valid.data(), valid.size())) << position;
+	}
+}
+
+TEST(Unicode, CountCodepoints) {
+	for (uint32 repetitions : { 0u, 1u, 3u, 40u }) {
+		const auto text = mixedText(repetitions);
+
+		uint32 expected = 0;
+		for (uint32 i = 0; i < text.size(); i += UTF8CodePointLength(text[i])) { ++expected; }
+
+		GTEST_ASSERT_EQ(CountUTF8Codepoints(text.data(), text.size()), expected);
+
+		for (uint32 offset = 0; offset < 33 && offset <= text.size(); ++offset) { // every alignment of the null terminated scan
+			const auto lengths = UTF8Lengths(text.c_str() + (text.size() - offset));
+			GTEST_ASSERT_EQ(lengths.First, offset);
+			GTEST_ASSERT_EQ(lengths.Second, CountUTF8Codepoints(text.data() + text.size() - offset, offset));
+		}
+
+		const StringView view(Byte(text.size()), text.data());
+		GTEST_ASSERT_EQ(view.GetCodepoints(), expected);
+		GTEST_ASSERT_EQ(StringLengths(text.c_str()).Second, expected);
+	}
+
+	static_assert(StringView(u8"ña").GetCodepoints() == 2); // constant evaluation keeps the scalar path
+}
+
+TEST(Unicode, Transcode) {
+	const auto text = mixedText(30);
+
+	std::u32string utf32(text.size(), U'\0'); std::u16string utf16(text.size(), u'\0'); std::u8string back(text.size() * 4, u8'\0');
+
+	const auto codePoints = UTF8ToUTF32(text.data(), text.size(), utf32.data());
+	ASSERT_TRUE(codePoints.State());
+	GTEST_ASSERT_EQ(codePoints.Get(), CountUTF8Codepoints(text.data(), text.size()));
+
+	uint32 i = 0, c = 0;
+	for (; i < text.size(); i += UTF8CodePointLength(text[i]), ++c) { GTEST_ASSERT_EQ(utf32[c], ToUTF32(text.data() + i)); }
+
+	const auto units = UTF8ToUTF16(text.data(), text.size(), utf16.data());
+	ASSERT_TRUE(units.State());
+	GTEST_ASSERT_EQ(units.Get(), codePoints.Get() + 30); // one surrogate pair per repetition
+
+	auto bytes = UTF16ToUTF8(utf16.data(), units.Get(), back.data());
+	ASSERT_TRUE(bytes.State());
+	ASSERT_TRUE(back.compare(0, bytes.Get(), text) == 0 && bytes.Get() == text.size());
+
+	bytes = UTF32ToUTF8(utf32.data(), codePoints.Get(), back.data());
+	ASSERT_TRUE(bytes.State());
+	ASSERT_TRUE(back.compare(0, bytes.Get(), text) == 0 && bytes.Get() == text.size());
+
+	std::u32string utf32Again(units.Get(), U'\0'); std::u16string utf16Again(codePoints.Get() * 2, u'\0');
+	ASSERT_EQ(UTF16ToUTF32(utf16.data(), units.Get(), utf32Again.data()).Get(), codePoints.Get());
+	ASSERT_TRUE(std::equal(utf32.begin(), utf32.begin() + codePoints.Get(), utf32Again.begin()));
+	ASSERT_EQ(UTF32ToUTF16(utf32.data(), codePoints.Get(), utf16Again.data()).Get(), units.Get());
+	ASSERT_TRUE(std::equal(utf16.begin(), utf16.begin() + units.Get(), utf16Again.begin()));
+
+	const char8_t overlong[] = { u8'a', 0xC0, 0xAF };
+	ASSERT_FALSE(UTF8ToUTF32(overlong, 3, utf32.data()).State());
+	const char16_t loneSurrogate[] = { u'a', 0xDC00, u'b' };
+	ASSERT_FALSE(UTF16ToUTF8(loneSurrogate, 3, back.data()).State());
+	ASSERT_FALSE(UTF16ToUTF32(loneSurrogate, 3, utf32.data()).State());
+	const char32_t surrogate[] = { 0xD800 }, tooLarge[] = { 0x110000 };
+	ASSERT_FALSE(UTF32ToUTF8(surrogate, 1, back.data()).State());
+	ASSERT_FALSE(UTF32ToUTF16(tooLarge, 1, utf16.data()).State());
+}